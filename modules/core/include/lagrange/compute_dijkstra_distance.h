@@ -17,7 +17,12 @@
 
 #include <lagrange/SurfaceMesh.h>
 #include <lagrange/utils/SmallVector.h>
+#include <lagrange/utils/function_ref.h>
+#include <lagrange/utils/invalid.h>
+
 #include <optional>
+#include <string_view>
+#include <vector>
 
 namespace lagrange {
 ///
@@ -67,6 +72,89 @@ std::optional<std::vector<Index>> compute_dijkstra_distance(
     SurfaceMesh<Scalar, Index>& mesh,
     const DijkstraDistanceOptions<Scalar, Index>& options = {});
 
+///
+/// Option struct for compute_multi_seed_dijkstra_distance
+///
+template <typename Scalar, typename Index>
+struct MultiSeedDijkstraDistanceOptions
+{
+    /// Seed facet indices
+    std::vector<Index> seed_facets;
+
+    /// Seed facet barycentric coordinates, concatenated in seed order (one value per vertex of
+    /// the seed facet). If empty, each seed is placed at the centroid of its facet.
+    std::vector<Scalar> barycentric_coords;
+
+    /// Maximum radius of the dijkstra distance. A non-positive value means no limit.
+    Scalar radius = 0.0;
+
+    /// Width of the distance buckets whose vertices are relaxed in parallel. A non-positive value
+    /// uses the mean edge length.
+    Scalar bucket_width = 0.0;
+
+    /// Output attribute name for dijkstra distance to the nearest seed.
+    std::string_view output_attribute_name = "@dijkstra_distance";
+
+    /// Output attribute name for the index of the nearest seed.
+    std::string_view output_seed_attribute_name = "@dijkstra_seed";
+};
+
+///
+/// Option struct for compute_batched_dijkstra_distance
+///
+template <typename Scalar, typename Index>
+struct BatchedDijkstraDistanceOptions
+{
+    /// Seed facet index of each query
+    std::vector<Index> seed_facets;
+
+    /// Seed facet barycentric coordinates, concatenated in query order (one value per vertex of
+    /// the seed facet). If empty, each seed is placed at the centroid of its facet.
+    std::vector<Scalar> barycentric_coords;
+
+    /// Maximum radius of each query. A non-positive value means no limit.
+    Scalar radius = 0.0;
+};
+
+///
+/// Computes dijkstra distance from the nearest of multiple seeds (a geodesic Voronoi diagram of
+/// the seeds along mesh edges). Vertices are processed by buckets of increasing distance, and the
+/// vertices of a bucket are relaxed in parallel (delta-stepping). The output does not depend on
+/// the number of threads.
+///
+/// Vertices farther than the radius from every seed are assigned a distance of -1 and an invalid
+/// seed index.
+///
+/// @param mesh Input mesh.
+/// @param options Options for computing dijkstra distance.
+///
+/// @tparam     Scalar  Mesh scalar type.
+/// @tparam     Index   Mesh index type.
+///
+template <typename Scalar, typename Index>
+void compute_multi_seed_dijkstra_distance(
+    SurfaceMesh<Scalar, Index>& mesh,
+    const MultiSeedDijkstraDistanceOptions<Scalar, Index>& options);
+
+///
+/// Runs independent radius-limited dijkstra queries from many seeds concurrently. Each thread
+/// reuses its own scratch buffers across queries, so the cost of a query is proportional to the
+/// size of the region it reaches rather than to the mesh size.
+///
+/// @param mesh Input mesh.
+/// @param options Options for the queries.
+/// @param process Callback receiving the query index, a reached vertex and its distance. It is
+///                called in order of increasing distance within a query, and concurrently across
+///                queries.
+///
+/// @tparam     Scalar  Mesh scalar type.
+/// @tparam     Index   Mesh index type.
+///
+template <typename Scalar, typename Index>
+void compute_batched_dijkstra_distance(
+    SurfaceMesh<Scalar, Index>& mesh,
+    const BatchedDijkstraDistanceOptions<Scalar, Index>& options,
+    function_ref<void(Index, Index, Scalar)> process);
 
 /// @}
 } // namespace lagrange
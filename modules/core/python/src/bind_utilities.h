@@ -1457,6 +1457,46 @@ well-defined and will be set to the special value 2 * π.
 :param output_attribute_name: The output attribute name to store the dijkstra distance.
 :param output_involved_vertices: Whether to output the list of involved vertices.)");
 
+    m.def(
+        "compute_multi_seed_dijkstra_distance",
+        [](MeshType& mesh,
+           std::vector<Index> seed_facets,
+           std::vector<Scalar> barycentric_coords,
+           std::optional<Scalar> radius,
+           std::string_view output_attribute_name,
+           std::string_view output_seed_attribute_name) {
+            MultiSeedDijkstraDistanceOptions<Scalar, Index> options;
+            options.seed_facets = std::move(seed_facets);
+            options.barycentric_coords = std::move(barycentric_coords);
+            if (radius.has_value()) {
+                options.radius = radius.value();
+            }
+            options.output_attribute_name = output_attribute_name;
+            options.output_seed_attribute_name = output_seed_attribute_name;
+            compute_multi_seed_dijkstra_distance(mesh, options);
+            return std::make_tuple(
+                mesh.get_attribute_id(output_attribute_name),
+                mesh.get_attribute_id(output_seed_attribute_name));
+        },
+        "mesh"_a,
+        "seed_facets"_a,
+        "barycentric_coords"_a = std::vector<Scalar>(),
+        "radius"_a = nb::none(),
+        "output_attribute_name"_a =
+            MultiSeedDijkstraDistanceOptions<Scalar, Index>{}.output_attribute_name,
+        "output_seed_attribute_name"_a =
+            MultiSeedDijkstraDistanceOptions<Scalar, Index>{}.output_seed_attribute_name,
+        R"(Compute Dijkstra distance from the nearest of multiple seed facets.
+
+:param mesh:                       The source mesh.
+:param seed_facets:                The seed facet indices.
+:param barycentric_coords:         The barycentric coordinates of the seeds, concatenated in seed order. If empty, seeds are placed at facet centroids.
+:param radius:                     The maximum radius of the dijkstra distance.
+:param output_attribute_name:      The output attribute name to store the dijkstra distance.
+:param output_seed_attribute_name: The output attribute name to store the nearest seed index.
+
+:return: The attribute ids of the distance and nearest seed attributes.)");
+
     m.def(
         "weld_indexed_attribute",
         [](MeshType& mesh,
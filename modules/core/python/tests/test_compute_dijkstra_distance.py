@@ -41,3 +41,14 @@ class TestComputeDijkstraDistance:
         )
         assert maybe_vertices is not None
         assert mesh.has_attribute("@dijkstra_distance")
+
+    def test_multi_seed(self, cube):
+        mesh = cube
+        dist_id, seed_id = lagrange.compute_multi_seed_dijkstra_distance(
+            mesh,
+            seed_facets=[0, 1],
+        )
+        assert mesh.get_attribute_id("@dijkstra_distance") == dist_id
+        assert mesh.get_attribute_id("@dijkstra_seed") == seed_id
+        seeds = mesh.attribute(seed_id).data
+        assert all(s in (0, 1) for s in seeds)
@@ -15,10 +15,181 @@
 #include <lagrange/internal/dijkstra.h>
 #include <lagrange/internal/find_attribute_utils.h>
 #include <lagrange/utils/assert.h>
+#include <lagrange/utils/invalid.h>
 #include <lagrange/views.h>
 
+// clang-format off
+#include <lagrange/utils/warnoff.h>
+#include <tbb/enumerable_thread_specific.h>
+#include <tbb/parallel_for.h>
+#include <tbb/parallel_sort.h>
+#include <lagrange/utils/warnon.h>
+// clang-format on
+
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <limits>
+#include <numeric>
+
 namespace lagrange {
 
+namespace {
+
+///
+/// Edge graph of a mesh in compressed row format, with edge lengths as weights.
+///
+template <typename Scalar, typename Index>
+struct EdgeGraph
+{
+    std::vector<size_t> offsets;
+    std::vector<Index> neighbors;
+    std::vector<Scalar> lengths;
+
+    explicit EdgeGraph(SurfaceMesh<Scalar, Index>& mesh)
+    {
+        mesh.initialize_edges();
+        const Index num_vertices = mesh.get_num_vertices();
+        const Index num_edges = mesh.get_num_edges();
+        const auto vertices = vertex_view(mesh);
+
+        offsets.assign(num_vertices + 1, 0);
+        for (Index e = 0; e < num_edges; ++e) {
+            auto v = mesh.get_edge_vertices(e);
+            offsets[v[0] + 1]++;
+            offsets[v[1] + 1]++;
+        }
+        std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+
+        neighbors.resize(offsets.back());
+        lengths.resize(offsets.back());
+        std::vector<size_t> next(offsets.begin(), offsets.end() - 1);
+        for (Index e = 0; e < num_edges; ++e) {
+            auto v = mesh.get_edge_vertices(e);
+            const Scalar l = (vertices.row(v[0]) - vertices.row(v[1])).norm();
+            neighbors[next[v[0]]] = v[1];
+            lengths[next[v[0]]++] = l;
+            neighbors[next[v[1]]] = v[0];
+            lengths[next[v[1]]++] = l;
+        }
+    }
+
+    template <typename Func>
+    void foreach_neighbor(Index v, Func&& func) const
+    {
+        for (size_t i = offsets[v]; i < offsets[v + 1]; ++i) {
+            func(neighbors[i], lengths[i]);
+        }
+    }
+
+    Scalar mean_edge_length() const
+    {
+        if (lengths.empty()) return 0;
+        return std::accumulate(lengths.begin(), lengths.end(), Scalar(0)) /
+               static_cast<Scalar>(lengths.size());
+    }
+};
+
+///
+/// Calls a function on each vertex of each seed facet, with its distance to the seed point.
+///
+template <typename Scalar, typename Index, typename Func>
+void foreach_seed_vertex(
+    const SurfaceMesh<Scalar, Index>& mesh,
+    span<const Index> seed_facets,
+    span<const Scalar> barycentric_coords,
+    Func&& func)
+{
+    const auto vertices = vertex_view(mesh);
+    size_t offset = 0;
+    for (size_t s = 0; s < seed_facets.size(); ++s) {
+        la_runtime_assert(seed_facets[s] < mesh.get_num_facets(), "Invalid seed facet index");
+        const auto seed_vertices = mesh.get_facet_vertices(seed_facets[s]);
+        const size_t n = seed_vertices.size();
+        la_runtime_assert(
+            barycentric_coords.empty() || offset + n <= barycentric_coords.size(),
+            "Invalid dimension of barycentric coordinates, must match facet sizes");
+        auto bc = [&](size_t i) {
+            return barycentric_coords.empty() ? Scalar(1) / static_cast<Scalar>(n)
+                                              : barycentric_coords[offset + i];
+        };
+
+        Vector<Scalar> pt = Vector<Scalar>::Zero(vertices.cols());
+        for (size_t i = 0; i < n; ++i) {
+            pt += vertices.row(seed_vertices[i]).transpose() * bc(i);
+        }
+        for (size_t i = 0; i < n; ++i) {
+            func(
+                static_cast<Index>(s),
+                seed_vertices[i],
+                static_cast<Scalar>((vertices.row(seed_vertices[i]).transpose() - pt).norm()));
+        }
+        offset += n;
+    }
+    la_runtime_assert(
+        barycentric_coords.empty() || offset == barycentric_coords.size(),
+        "Invalid dimension of barycentric coordinates, must match facet sizes");
+}
+
+///
+/// Lowers an atomic distance. Returns true if the value was lowered.
+///
+template <typename Scalar>
+bool atomic_min(std::atomic<Scalar>& target, Scalar value)
+{
+    Scalar current = target.load(std::memory_order_relaxed);
+    while (value < current) {
+        if (target.compare_exchange_weak(current, value, std::memory_order_relaxed)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+///
+/// Scratch buffers for a dijkstra query, reused across queries run by the same thread. Buffers
+/// are reset lazily using a query stamp.
+///
+template <typename Scalar, typename Index>
+struct DijkstraScratch
+{
+    using Entry = std::pair<Scalar, Index>;
+
+    std::vector<uint32_t> stamps;
+    std::vector<Scalar> distances;
+    std::vector<bool> settled;
+    std::vector<Entry> heap;
+    uint32_t current = 0;
+
+    void reset(Index num_vertices)
+    {
+        if (stamps.size() != num_vertices || current == std::numeric_limits<uint32_t>::max()) {
+            stamps.assign(num_vertices, 0);
+            distances.resize(num_vertices);
+            settled.resize(num_vertices);
+            current = 0;
+        }
+        ++current;
+        heap.clear();
+    }
+
+    // Lowers the tentative distance of a vertex, and pushes it to the heap if it was lowered.
+    void relax(Index v, Scalar d)
+    {
+        if (stamps[v] != current) {
+            stamps[v] = current;
+            settled[v] = false;
+        } else if (settled[v] || distances[v] <= d) {
+            return;
+        }
+        distances[v] = d;
+        heap.emplace_back(d, v);
+        std::push_heap(heap.begin(), heap.end(), std::greater<Entry>());
+    }
+};
+
+} // namespace
+
 
 template <typename Scalar, typename Index>
 std::optional<std::vector<Index>> compute_dijkstra_distance(
@@ -88,11 +259,211 @@ std::optional<std::vector<Index>> compute_dijkstra_distance(
     return involved_vts;
 }
 
-#define LA_X_compute_dijkstra_distance(_, Scalar, Index)   \
-    template LA_CORE_API std::optional<std::vector<Index>> \
-    compute_dijkstra_distance<Scalar, Index>(              \
-        SurfaceMesh<Scalar, Index>&,                       \
-        const DijkstraDistanceOptions<Scalar, Index>& options);
+template <typename Scalar, typename Index>
+void compute_multi_seed_dijkstra_distance(
+    SurfaceMesh<Scalar, Index>& mesh,
+    const MultiSeedDijkstraDistanceOptions<Scalar, Index>& options)
+{
+    const Index num_vertices = mesh.get_num_vertices();
+    const Scalar radius =
+        options.radius > 0 ? options.radius : std::numeric_limits<Scalar>::infinity();
+    const EdgeGraph<Scalar, Index> graph(mesh);
+
+    Scalar bucket_width = options.bucket_width;
+    if (bucket_width <= 0) bucket_width = graph.mean_edge_length();
+    if (bucket_width <= 0) bucket_width = 1;
+    auto get_bucket = [&](Scalar d) { return static_cast<size_t>(d / bucket_width); };
+
+    // Initialize the distance of seed vertices, keeping track of the closest seed.
+    std::vector<std::atomic<Scalar>> distances(num_vertices);
+    std::vector<Scalar> seed_distances(num_vertices, std::numeric_limits<Scalar>::infinity());
+    std::vector<Index> seed_labels(num_vertices, invalid<Index>());
+    std::vector<std::vector<Index>> buckets;
+    foreach_seed_vertex<Scalar, Index>(
+        mesh,
+        options.seed_facets,
+        options.barycentric_coords,
+        [&](Index s, Index v, Scalar d) {
+            if (d < radius && d < seed_distances[v]) {
+                seed_distances[v] = d;
+                seed_labels[v] = s;
+            }
+        });
+    for (Index v = 0; v < num_vertices; ++v) {
+        distances[v].store(seed_distances[v], std::memory_order_relaxed);
+        if (seed_labels[v] != invalid<Index>()) {
+            const size_t b = get_bucket(seed_distances[v]);
+            if (b >= buckets.size()) buckets.resize(b + 1);
+            buckets[b].push_back(v);
+        }
+    }
+
+    // Delta-stepping: buckets are settled in order of increasing distance, and the vertices of
+    // the current bucket are relaxed in parallel until no vertex falls back into it.
+    tbb::enumerable_thread_specific<std::vector<Index>> updated;
+    for (size_t b = 0; b < buckets.size(); ++b) {
+        std::vector<Index> frontier = std::move(buckets[b]);
+        while (!frontier.empty()) {
+            tbb::parallel_sort(frontier.begin(), frontier.end());
+            frontier.erase(std::unique(frontier.begin(), frontier.end()), frontier.end());
+
+            tbb::parallel_for(
+                tbb::blocked_range<size_t>(0, frontier.size()),
+                [&](const tbb::blocked_range<size_t>& range) {
+                    auto& local = updated.local();
+                    for (size_t i = range.begin(); i != range.end(); ++i) {
+                        const Index v = frontier[i];
+                        const Scalar dv = distances[v].load(std::memory_order_relaxed);
+                        graph.foreach_neighbor(v, [&](Index u, Scalar l) {
+                            const Scalar du = dv + l;
+                            if (du < radius && atomic_min(distances[u], du)) {
+                                local.push_back(u);
+                            }
+                        });
+                    }
+                });
+
+            frontier.clear();
+            for (auto& local : updated) {
+                for (Index u : local) {
+                    const size_t k = get_bucket(distances[u].load(std::memory_order_relaxed));
+                    if (k <= b) {
+                        frontier.push_back(u);
+                    } else {
+                        if (k >= buckets.size()) buckets.resize(k + 1);
+                        buckets[k].push_back(u);
+                    }
+                }
+                local.clear();
+            }
+        }
+    }
+
+    // Assign seed labels in order of increasing distance, so that the label of each vertex is
+    // propagated from its tightest neighbor. Ties are broken by seed index to be deterministic.
+    std::vector<Index> order;
+    order.reserve(num_vertices);
+    for (Index v = 0; v < num_vertices; ++v) {
+        if (distances[v].load(std::memory_order_relaxed) < radius) order.push_back(v);
+    }
+    tbb::parallel_sort(order.begin(), order.end(), [&](Index a, Index b) {
+        const Scalar da = distances[a].load(std::memory_order_relaxed);
+        const Scalar db = distances[b].load(std::memory_order_relaxed);
+        return da < db || (da == db && a < b);
+    });
+
+    const auto dist_attr_id = internal::find_or_create_attribute<Scalar>(
+        mesh,
+        options.output_attribute_name,
+        AttributeElement::Vertex,
+        AttributeUsage::Scalar,
+        1,
+        internal::ResetToDefault::No);
+    const auto seed_attr_id = internal::find_or_create_attribute<Index>(
+        mesh,
+        options.output_seed_attribute_name,
+        AttributeElement::Vertex,
+        AttributeUsage::Scalar,
+        1,
+        internal::ResetToDefault::No);
+    auto dist_data = attribute_vector_ref<Scalar>(mesh, dist_attr_id);
+    auto seed_data = attribute_vector_ref<Index>(mesh, seed_attr_id);
+    dist_data.setConstant(Scalar(-1));
+    seed_data.setConstant(invalid<Index>());
+
+    auto assign_label = [&](Index v) {
+        const Scalar dv = distances[v].load(std::memory_order_relaxed);
+        Scalar best = seed_distances[v];
+        Index label = seed_labels[v];
+        graph.foreach_neighbor(v, [&](Index u, Scalar l) {
+            if (seed_data[u] == invalid<Index>()) return;
+            const Scalar du = dist_data[u] + l;
+            if (du < best || (du == best && seed_data[u] < label)) {
+                best = du;
+                label = seed_data[u];
+            }
+        });
+        if (label == invalid<Index>()) return false;
+        dist_data[v] = dv;
+        seed_data[v] = label;
+        return true;
+    };
+
+    // Vertices connected by zero-length edges share the same distance, and may be visited before
+    // the neighbor they inherit their label from. They are resolved in subsequent passes.
+    while (!order.empty()) {
+        std::vector<Index> pending;
+        for (Index v : order) {
+            if (!assign_label(v)) pending.push_back(v);
+        }
+        if (pending.size() == order.size()) break;
+        order = std::move(pending);
+    }
+}
+
+template <typename Scalar, typename Index>
+void compute_batched_dijkstra_distance(
+    SurfaceMesh<Scalar, Index>& mesh,
+    const BatchedDijkstraDistanceOptions<Scalar, Index>& options,
+    function_ref<void(Index, Index, Scalar)> process)
+{
+    const Index num_vertices = mesh.get_num_vertices();
+    const Scalar radius =
+        options.radius > 0 ? options.radius : std::numeric_limits<Scalar>::infinity();
+    const EdgeGraph<Scalar, Index> graph(mesh);
+
+    // Gather the seed vertices of all queries upfront, so that validation happens before any
+    // query runs.
+    const size_t num_queries = options.seed_facets.size();
+    std::vector<size_t> seed_offsets(num_queries + 1, 0);
+    std::vector<std::pair<Index, Scalar>> seeds;
+    foreach_seed_vertex<Scalar, Index>(
+        mesh,
+        options.seed_facets,
+        options.barycentric_coords,
+        [&](Index s, Index v, Scalar d) {
+            seeds.emplace_back(v, d);
+            seed_offsets[s + 1] = seeds.size();
+        });
+
+    using Scratch = DijkstraScratch<Scalar, Index>;
+    using Entry = typename Scratch::Entry;
+    tbb::enumerable_thread_specific<Scratch> scratches;
+    tbb::parallel_for(size_t(0), num_queries, [&](size_t q) {
+        auto& scratch = scratches.local();
+        scratch.reset(num_vertices);
+        for (size_t i = seed_offsets[q]; i < seed_offsets[q + 1]; ++i) {
+            if (seeds[i].second < radius) scratch.relax(seeds[i].first, seeds[i].second);
+        }
+
+        while (!scratch.heap.empty()) {
+            std::pop_heap(scratch.heap.begin(), scratch.heap.end(), std::greater<Entry>());
+            const auto [d, v] = scratch.heap.back();
+            scratch.heap.pop_back();
+            if (scratch.settled[v] || d > scratch.distances[v]) continue;
+            scratch.settled[v] = true;
+            process(static_cast<Index>(q), v, d);
+
+            graph.foreach_neighbor(v, [&](Index u, Scalar l) {
+                const Scalar du = d + l;
+                if (du < radius) scratch.relax(u, du);
+            });
+        }
+    });
+}
+
+#define LA_X_compute_dijkstra_distance(_, Scalar, Index)                    \
+    template LA_CORE_API std::optional<std::vector<Index>>                  \
+    compute_dijkstra_distance<Scalar, Index>(                               \
+        SurfaceMesh<Scalar, Index>&,                                        \
+        const DijkstraDistanceOptions<Scalar, Index>& options);             \
+    template LA_CORE_API void compute_multi_seed_dijkstra_distance(         \
+        SurfaceMesh<Scalar, Index>&,                                        \
+        const MultiSeedDijkstraDistanceOptions<Scalar, Index>& options);    \
+    template LA_CORE_API void compute_batched_dijkstra_distance(            \
+        SurfaceMesh<Scalar, Index>&,                                        \
+        const BatchedDijkstraDistanceOptions<Scalar, Index>& options,       \
+        function_ref<void(Index, Index, Scalar)> process);
 LA_SURFACE_MESH_X(compute_dijkstra_distance, 0)
 
 } // namespace lagrange
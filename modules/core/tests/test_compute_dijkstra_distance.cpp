@@ -117,3 +117,106 @@ TEST_CASE("DijkstraDistance", "[dijkstra][surface][triangle]")
         }
     }
 }
+
+TEST_CASE("MultiSeedDijkstraDistance", "[dijkstra][surface][triangle]")
+{
+    using namespace lagrange;
+    using Scalar = double;
+    using Index = uint32_t;
+
+    // A strip of unit squares along the x axis.
+    SurfaceMesh<Scalar, Index> mesh;
+    const Index num_squares = 10;
+    for (Index i = 0; i <= num_squares; ++i) {
+        mesh.add_vertex({Scalar(i), 0, 0});
+        mesh.add_vertex({Scalar(i), 1, 0});
+    }
+    for (Index i = 0; i < num_squares; ++i) {
+        mesh.add_triangle(2 * i, 2 * i + 2, 2 * i + 1);
+        mesh.add_triangle(2 * i + 1, 2 * i + 2, 2 * i + 3);
+    }
+
+    MultiSeedDijkstraDistanceOptions<Scalar, Index> options;
+    options.seed_facets = {0, 2 * (num_squares - 1)};
+    options.barycentric_coords = {1, 0, 0, 0, 1, 0};
+
+    SECTION("voronoi")
+    {
+        compute_multi_seed_dijkstra_distance(mesh, options);
+        auto dist = attribute_vector_view<Scalar>(mesh, options.output_attribute_name);
+        auto seed = attribute_vector_view<Index>(mesh, options.output_seed_attribute_name);
+
+        // Seeds are the bottom vertices at x = 0 and x = num_squares.
+        for (Index i = 0; i <= num_squares; ++i) {
+            const Scalar d0 = Scalar(i);
+            const Scalar d1 = Scalar(num_squares - i);
+            REQUIRE(dist[2 * i] == Catch::Approx(std::min(d0, d1)));
+            if (d0 < d1) REQUIRE(seed[2 * i] == 0);
+            if (d1 < d0) REQUIRE(seed[2 * i] == 1);
+        }
+    }
+
+    SECTION("radius")
+    {
+        options.radius = 2.5;
+        options.bucket_width = 0.5;
+        compute_multi_seed_dijkstra_distance(mesh, options);
+        auto dist = attribute_vector_view<Scalar>(mesh, options.output_attribute_name);
+        auto seed = attribute_vector_view<Index>(mesh, options.output_seed_attribute_name);
+        for (Index v = 0; v < mesh.get_num_vertices(); ++v) {
+            REQUIRE(dist[v] < options.radius);
+            REQUIRE((dist[v] < 0) == (seed[v] == invalid<Index>()));
+        }
+        REQUIRE(dist[num_squares] == -1);
+    }
+
+    SECTION("single seed")
+    {
+        DijkstraDistanceOptions<Scalar, Index> single_options;
+        single_options.seed_facet = 3;
+        single_options.barycentric_coords = {0.2, 0.3, 0.5};
+        compute_dijkstra_distance(mesh, single_options);
+        auto expected = attribute_vector_view<Scalar>(mesh, single_options.output_attribute_name);
+
+        options.seed_facets = {3};
+        options.barycentric_coords = {0.2, 0.3, 0.5};
+        options.output_attribute_name = "@multi_seed_dijkstra_distance";
+        compute_multi_seed_dijkstra_distance(mesh, options);
+        auto dist = attribute_vector_view<Scalar>(mesh, options.output_attribute_name);
+        for (Index v = 0; v < mesh.get_num_vertices(); ++v) {
+            REQUIRE(dist[v] == Catch::Approx(expected[v]));
+        }
+    }
+
+    SECTION("batched")
+    {
+        compute_multi_seed_dijkstra_distance(mesh, options);
+        auto dist = attribute_vector_view<Scalar>(mesh, options.output_attribute_name);
+
+        BatchedDijkstraDistanceOptions<Scalar, Index> batched_options;
+        batched_options.seed_facets = options.seed_facets;
+        batched_options.barycentric_coords = options.barycentric_coords;
+        batched_options.radius = 4.5;
+
+        const Index num_vertices = mesh.get_num_vertices();
+        std::vector<Scalar> query_dist(2 * num_vertices, Scalar(-1));
+        compute_batched_dijkstra_distance<Scalar, Index>(
+            mesh,
+            batched_options,
+            [&](Index q, Index v, Scalar d) { query_dist[q * num_vertices + v] = d; });
+
+        for (Index v = 0; v < num_vertices; ++v) {
+            const Scalar d0 = query_dist[v];
+            const Scalar d1 = query_dist[num_vertices + v];
+            REQUIRE(d0 < batched_options.radius);
+            REQUIRE(d1 < batched_options.radius);
+            if (d0 >= 0 && d1 >= 0) {
+                REQUIRE(std::min(d0, d1) == Catch::Approx(dist[v]));
+            } else if (d0 >= 0 || d1 >= 0) {
+                REQUIRE(std::max(d0, d1) == Catch::Approx(dist[v]));
+            } else {
+                REQUIRE(dist[v] >= batched_options.radius);
+            }
+        }
+    }
+}
@@ -16,6 +16,10 @@
 
 #include <string_view>
 
+namespace lagrange::solver {
+class SolverCache;
+} // namespace lagrange::solver
+
 namespace lagrange::filtering {
 
 /**
@@ -59,6 +63,15 @@ struct AttributeSmoothingOptions
      * Positive values increase gradient modulation, while negative values decrease it.
      */
     double gradient_modulation_scale = 0.;
+
+    /**
+     * Optional cache of factorized solvers.
+     *
+     * When provided, smoothing attributes of a mesh with the same connectivity again reuses the
+     * symbolic analysis of the systems, and their numeric factorization when the metric and
+     * weights are unchanged.
+     */
+    solver::SolverCache* solver_cache = nullptr;
 };
 
 /**
@@ -16,6 +16,10 @@
 
 #include <string_view>
 
+namespace lagrange::solver {
+class SolverCache;
+} // namespace lagrange::solver
+
 namespace lagrange::filtering {
 
 /// @addtogroup module-filtering
@@ -122,6 +126,11 @@ struct SmoothingOptions
     double normal_projection_weight = 1e2;
 
     /// @}
+
+    /// Optional cache of factorized solvers. When provided, smoothing a mesh with the same
+    /// connectivity again reuses the symbolic analysis of the systems, and their numeric
+    /// factorization when the metric and weights are unchanged.
+    solver::SolverCache* solver_cache = nullptr;
 };
 
 ///
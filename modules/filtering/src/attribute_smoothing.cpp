@@ -49,7 +49,6 @@ void scalar_attribute_smoothing(
     SurfaceMesh<Scalar, Index> _mesh;
     std::vector<SimplexIndex<K, int>> triangles;
     std::vector<Vector<Real, Dim>> vertices, normals;
-    Solver solver;
     Real original_area;
 
     // Setup for smoothing
@@ -59,8 +58,9 @@ void scalar_attribute_smoothing(
         triangles,
         vertices,
         normals,
-        solver,
         original_area);
+    std::optional<Solver> local_solver;
+    Solver& solver = smoothing_utils::get_solver(*r_mesh, options.solver_cache, local_solver);
 
     // Adjust the metric to take into account the curvature
     if (options.curvature_weight > 0) {
@@ -45,7 +45,6 @@ void mesh_smoothing(SurfaceMesh<Scalar, Index>& mesh, const SmoothingOptions& op
     SurfaceMesh<Scalar, Index> _mesh;
     std::vector<SimplexIndex<K, int>> triangles;
     std::vector<Vector<Real, Dim>> vertices, normals;
-    Solver solver;
     Real original_area;
 
     // Setup for smoothing
@@ -55,8 +54,9 @@ void mesh_smoothing(SurfaceMesh<Scalar, Index>& mesh, const SmoothingOptions& op
         triangles,
         vertices,
         normals,
-        solver,
         original_area);
+    std::optional<Solver> local_solver;
+    Solver& solver = smoothing_utils::get_solver(*r_mesh, options.solver_cache, local_solver);
 
     // Adjust the metric to take into account the curvature
     if (options.curvature_weight > 0) {
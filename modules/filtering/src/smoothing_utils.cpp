@@ -114,7 +114,6 @@ std::unique_ptr<FEM::RiemannianMesh<Real>> setup_for_smoothing(
     std::vector<SimplexIndex<K, int>>& triangles,
     std::vector<Vector<Real, Dim>>& vertices,
     std::vector<Vector<Real, Dim>>& normals,
-    Solver& solver,
     Real& original_area)
 {
     _mesh = mesh;
@@ -166,13 +165,24 @@ std::unique_ptr<FEM::RiemannianMesh<Real>> setup_for_smoothing(
     }
     r_mesh_timer.tock();
 
-    // System matrix symbolic factorization
+    return r_mesh;
+}
+
+Solver& get_solver(
+    const FEM::RiemannianMesh<Real>& r_mesh,
+    solver::SolverCache* solver_cache,
+    std::optional<Solver>& local_solver)
+{
+    // System matrix symbolic factorization (skipped if the cached solver has the same pattern)
     VerboseTimer factorization_timer("├── Symbolic factorization");
     factorization_timer.tick();
-    solver.analyzePattern(r_mesh->template stiffnessMatrix<FEM::BASIS_0_WHITNEY, true>());
+    Eigen::SparseMatrix<Real> S = r_mesh.template stiffnessMatrix<FEM::BASIS_0_WHITNEY, true>();
+    S.makeCompressed();
+    Solver& solver = solver_cache ? solver_cache->get(S) : local_solver.emplace();
+    solver.analyzePattern(S);
     factorization_timer.tock();
 
-    return r_mesh;
+    return solver;
 }
 
 void adjust_metric_for_curvature(
@@ -257,7 +267,6 @@ void adjust_metric_for_curvature(
             std::vector<SimplexIndex<K, int>> & triangles,                  \
             std::vector<Vector<Real, Dim>> & vertices,                      \
             std::vector<Vector<Real, Dim>> & normals,                       \
-            Solver & solver,                                                \
             Real & original_area);
 LA_SURFACE_MESH_X(smoothing_utils, 0)
 
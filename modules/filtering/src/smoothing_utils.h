@@ -13,7 +13,8 @@
 
 #include <lagrange/SurfaceMesh.h>
 
-#include <lagrange/solver/DirectSolver.h>
+#include <lagrange/solver/CachedSolver.h>
+#include <lagrange/solver/SolverCache.h>
 
 // Include before any ShapeGradientDomain header to override their threadpool implementation.
 #include "ThreadPool.h"
@@ -30,6 +31,8 @@ using namespace lagrange::filtering::threadpool;
 #include <lagrange/utils/warnon.h>
 // clang-format on
 
+#include <memory>
+#include <optional>
 #include <string_view>
 #include <vector>
 
@@ -51,7 +54,7 @@ static const unsigned int Dim = 3;
 
 using Real = double;
 
-using Solver = lagrange::solver::SolverLDLT<Eigen::SparseMatrix<Real>>;
+using Solver = lagrange::solver::CachedSolver<Real>;
 
 } // namespace
 
@@ -117,7 +120,6 @@ void set_vertices(SurfaceMesh<Scalar, Index>& mesh, const std::vector<Vector<Rea
  * @param triangles Output vector of triangles
  * @param vertices Output vector of vertices
  * @param normals Output vector of normals
- * @param solver The solver to use
  * @param original_area Output original mesh area
  *
  * @return The Riemannian mesh
@@ -129,9 +131,22 @@ std::unique_ptr<FEM::RiemannianMesh<Real>> setup_for_smoothing(
     std::vector<SimplexIndex<K, int>>& triangles,
     std::vector<Vector<Real, Dim>>& vertices,
     std::vector<Vector<Real, Dim>>& normals,
-    Solver& solver,
     Real& original_area);
 
+/**
+ * Get the solver for the systems of a Riemannian mesh, and perform its symbolic factorization
+ *
+ * @param r_mesh The Riemannian mesh
+ * @param solver_cache Optional solver cache. If null, the local solver is used instead
+ * @param local_solver Storage for the solver when no cache is provided
+ *
+ * @return The solver, analyzed for the sparsity pattern of the mesh systems
+ */
+Solver& get_solver(
+    const FEM::RiemannianMesh<Real>& r_mesh,
+    solver::SolverCache* solver_cache,
+    std::optional<Solver>& local_solver);
+
 /**
  * Adjust the metric based on curvature
  *
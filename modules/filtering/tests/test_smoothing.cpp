@@ -16,6 +16,7 @@
 #include <lagrange/Logger.h>
 #include <lagrange/SurfaceMeshTypes.h>
 #include <lagrange/filtering/mesh_smoothing.h>
+#include <lagrange/solver/SolverCache.h>
 #include <lagrange/testing/common.h>
 #include <lagrange/utils/assert.h>
 #include <lagrange/views.h>
@@ -85,6 +86,20 @@ TEST_CASE("Mesh Smoothing", "[filtering]")
         REQUIRE(facet_view(mesh1) == facet_view(mesh2));
         // TODO: fuzzy comparison
         // REQUIRE(vertex_view(mesh1) == vertex_view(mesh2));
+
+        // Smoothing with a solver cache gives the same result, and reuses the cached solvers
+        lagrange::solver::SolverCache cache;
+        auto options_with_cache = smoothing_options;
+        options_with_cache.solver_cache = &cache;
+        for (int run = 0; run < 2; ++run) {
+            auto mesh3 =
+                lagrange::testing::load_surface_mesh<Scalar, Index>("open/core/bunny_simple.obj");
+            lagrange::filtering::mesh_smoothing(mesh3, options_with_cache);
+            REQUIRE(cache.size() == 1);
+            auto v1 = vertex_view(mesh1);
+            auto v3 = vertex_view(mesh3);
+            REQUIRE((v1 - v3).lpNorm<Eigen::Infinity>() < 1e-8);
+        }
     }
 
     // Check that a noisy sphere becomes less noisy
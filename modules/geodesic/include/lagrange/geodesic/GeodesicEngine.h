@@ -14,7 +14,10 @@
 #include <lagrange/SurfaceMesh.h>
 #include <lagrange/geodesic/api.h>
 
+#include <Eigen/Core>
+
 #include <functional>
+#include <vector>
 
 namespace lagrange::geodesic {
 
@@ -92,6 +95,45 @@ struct LA_GEODESIC_API PointToPointGeodesicOptions
     std::array<double, 2> target_facet_bc = {0.0f, 0.0f};
 };
 
+///
+/// General options for many-to-many geodesic computations.
+///
+struct LA_GEODESIC_API MultiSourceGeodesicOptions
+{
+    /// The facet ids of the seed facets.
+    std::vector<size_t> source_facet_ids;
+
+    /// The barycentric coordinates of each seed point within its seed facet. Given a triangle (p1,
+    /// p2, p3), the barycentric coordinates (u, v) are such that the surface point is represented
+    /// by p = (1 - u - v) * p1 + u * p2 + v * p3. If empty, every seed is placed at the first
+    /// corner of its facet.
+    std::vector<std::array<double, 2>> source_facet_bcs;
+
+    /// The maximum geodesic distance from the seed points to consider.
+    ///
+    /// @note Negative value means there is no limit, and the entire mesh will be considered.
+    double radius = -1.0f;
+
+    /// The name of the output attribute to store the geodesic distance to the nearest seed.
+    std::string_view output_geodesic_attribute_name = "@geodesic_distance";
+
+    /// The name of the output attribute to store the index of the nearest seed. If empty, the
+    /// index is not computed.
+    std::string_view output_source_attribute_name = "@geodesic_source";
+};
+
+///
+/// Result of a multi-source geodesic computation.
+///
+struct LA_GEODESIC_API MultiSourceGeodesicResult
+{
+    /// The attribute id of the geodesic distance attribute.
+    AttributeId geodesic_distance_id = invalid_attribute_id();
+
+    /// The attribute id of the nearest seed index attribute.
+    AttributeId source_index_id = invalid_attribute_id();
+};
+
 ///
 /// Engine that is used to compute geodesic distances on a surface mesh.
 ///
@@ -138,6 +180,44 @@ public:
     ///
     virtual Scalar point_to_point_geodesic(const PointToPointGeodesicOptions& options);
 
+    ///
+    /// Computes the geodesic distance from each vertex to the nearest of a set of sources, along
+    /// with the index of that source. Vertices farther than the radius from every source are
+    /// assigned an invalid distance and an invalid source index.
+    ///
+    /// @param[in]  options  Input options for multi-source geodesic computation.
+    ///
+    /// @return     The attribute ids of the nearest source distance and index attributes.
+    ///
+    virtual MultiSourceGeodesicResult multi_source_geodesic(
+        const MultiSourceGeodesicOptions& options);
+
+    ///
+    /// Computes the geodesic distance from each of a set of sources to every vertex of the mesh.
+    /// The output attribute names of the options are ignored, as no attribute is created.
+    ///
+    /// The default implementation runs one single-source computation per source. Engines that
+    /// can share precomputed data across sources override it.
+    ///
+    /// @param[in]  options  Input options for multi-source geodesic computation.
+    ///
+    /// @return     A #V x #S matrix, where column j holds the distances from source j.
+    ///
+    virtual Eigen::Matrix<Scalar, Eigen::Dynamic, Eigen::Dynamic> batched_geodesic(
+        const MultiSourceGeodesicOptions& options);
+
+    ///
+    /// Computes the matrix of pairwise geodesic distances between a set of sources (e.g. a
+    /// landmark set). The result is symmetrized by averaging the distances computed in each
+    /// direction.
+    ///
+    /// @param[in]  options  Input options for multi-source geodesic computation.
+    ///
+    /// @return     A #S x #S symmetric matrix of geodesic distances.
+    ///
+    Eigen::Matrix<Scalar, Eigen::Dynamic, Eigen::Dynamic> pairwise_geodesic(
+        const MultiSourceGeodesicOptions& options);
+
 protected:
     const Mesh& mesh() const { return m_mesh.get(); }
     Mesh& mesh() { return m_mesh.get(); }
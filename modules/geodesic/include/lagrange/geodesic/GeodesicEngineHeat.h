@@ -18,7 +18,8 @@ namespace lagrange::geodesic {
 ///
 /// Computes surface geodesics using the heat method. The heat method offers fast geodesic
 /// computation for all points on the mesh, at the expense of some accuracy compared to exact
-/// methods.
+/// methods. Since its linear systems only depend on the mesh, they are factorized once and shared
+/// by all subsequent queries.
 ///
 /// @tparam     Scalar  Mesh scalar type.
 /// @tparam     Index   Mesh index type.
@@ -61,6 +62,43 @@ public:
     SingleSourceGeodesicResult single_source_geodesic(
         const SingleSourceGeodesicOptions& options) override;
 
+    ///
+    /// Compute the geodesic distance to the nearest of a set of sources using the heat method.
+    ///
+    /// The distance comes from a single heat flow started from all the sources at once, so it
+    /// costs one heat flow and one Poisson solve regardless of the number of sources. The index of
+    /// the nearest source cannot be recovered from that flow: when it is requested (i.e. when
+    /// `output_source_attribute_name` is not empty), the distance field of every source is also
+    /// computed, as in batched_geodesic(), and each vertex is assigned the source whose field is
+    /// the smallest. This costs one block solve per 64 sources, and near the boundaries between
+    /// sources the index may disagree with the combined distance.
+    ///
+    /// @note The radius option is ignored, distances are computed over the entire mesh.
+    ///
+    /// @param      options  The options for the computation.
+    ///
+    /// @return     The attribute ids of the nearest source distance and index attributes. The
+    ///             index id is invalid if no source attribute name is given.
+    ///
+    MultiSourceGeodesicResult multi_source_geodesic(
+        const MultiSourceGeodesicOptions& options) override;
+
+    ///
+    /// Compute geodesic distances from a batch of sources using the heat method. The right-hand
+    /// sides of all sources are stacked into a matrix, so the heat flow and Poisson systems are
+    /// each solved once for the whole batch against factorizations computed on the first call and
+    /// reused afterwards. Unlike the default implementation, no intermediate attribute is written
+    /// to the mesh.
+    ///
+    /// @note The radius option is ignored, distances are computed over the entire mesh.
+    ///
+    /// @param      options  The options for the computation.
+    ///
+    /// @return     A #V x #S matrix, where column j holds the distances from source j.
+    ///
+    Eigen::Matrix<Scalar, Eigen::Dynamic, Eigen::Dynamic> batched_geodesic(
+        const MultiSourceGeodesicOptions& options) override;
+
 protected:
     struct Impl;
     lagrange::value_ptr<Impl> m_impl;
@@ -19,6 +19,7 @@
 #include <array>
 #include <string>
 #include <variant>
+#include <vector>
 
 namespace nb = nanobind;
 using namespace nb::literals;
@@ -62,6 +63,43 @@ void populate_geodesic_module(nb::module_& m)
 :returns: The geodesic distance between the two points.)");
     };
 
+    auto def_multi_source_geodesic = [](auto& cls) {
+        using EngineType = typename std::decay_t<decltype(cls)>::Type;
+        cls.def(
+            "multi_source_geodesic",
+            [](EngineType& self,
+               std::vector<size_t> source_facet_ids,
+               std::vector<std::array<double, 2>> source_facet_bcs,
+               double radius,
+               std::string_view output_geodesic_attribute_name,
+               std::string_view output_source_attribute_name) {
+                geodesic::MultiSourceGeodesicOptions options;
+                options.source_facet_ids = std::move(source_facet_ids);
+                options.source_facet_bcs = std::move(source_facet_bcs);
+                options.radius = radius;
+                options.output_geodesic_attribute_name = output_geodesic_attribute_name;
+                options.output_source_attribute_name = output_source_attribute_name;
+                auto result = self.multi_source_geodesic(options);
+                return std::make_tuple(result.geodesic_distance_id, result.source_index_id);
+            },
+            "source_facet_ids"_a,
+            "source_facet_bcs"_a = std::vector<std::array<double, 2>>(),
+            "radius"_a = geodesic::MultiSourceGeodesicOptions().radius,
+            "output_geodesic_attribute_name"_a =
+                geodesic::MultiSourceGeodesicOptions().output_geodesic_attribute_name,
+            "output_source_attribute_name"_a =
+                geodesic::MultiSourceGeodesicOptions().output_source_attribute_name,
+            R"(Compute the geodesic distance from each vertex to the nearest of a set of sources.
+
+:param source_facet_ids: Facets containing the source points.
+:param source_facet_bcs: Barycentric coordinates of each source point within its facet. If empty, every source is placed at the first corner of its facet.
+:param radius: The maximum geodesic distance from the sources to consider. Negative value means no limit.
+:param output_geodesic_attribute_name: The name of the output attribute to store the geodesic distance to the nearest source.
+:param output_source_attribute_name: The name of the output attribute to store the index of the nearest source. If empty, the index is not computed and its returned attribute ID is invalid.
+
+:returns: The attribute IDs of the nearest source distance and index attributes.)");
+    };
+
     // DGPC engine
     nb::class_<GeodesicEngineDGPC<Scalar, Index>> cls_dgpc(m, "GeodesicEngineDGPC");
     cls_dgpc.def(nb::init<lagrange::SurfaceMesh<Scalar, Index>&>())
@@ -107,6 +145,7 @@ void populate_geodesic_module(nb::module_& m)
 
 :returns: The attribute IDs of the computed geodesic distance and polar angle attributes.)");
     def_point_to_point_geodesic(cls_dgpc);
+    def_multi_source_geodesic(cls_dgpc);
 
     // Heat engine
     nb::class_<GeodesicEngineHeat<Scalar, Index>> cls_heat(m, "GeodesicEngineHeat");
@@ -135,6 +174,7 @@ void populate_geodesic_module(nb::module_& m)
 
 :returns: The attribute ID of the computed geodesic distance attributes.)");
     def_point_to_point_geodesic(cls_heat);
+    def_multi_source_geodesic(cls_heat);
 
     // MMP engine
     nb::class_<GeodesicEngineMMP<Scalar, Index>> cls_mmp(m, "GeodesicEngineMMP");
@@ -167,6 +207,7 @@ void populate_geodesic_module(nb::module_& m)
 
 :returns: The attribute ID of the computed geodesic distance attributes.)");
     def_point_to_point_geodesic(cls_mmp);
+    def_multi_source_geodesic(cls_mmp);
 }
 
 } // namespace lagrange::python
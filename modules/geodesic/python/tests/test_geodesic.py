@@ -106,3 +106,25 @@ class TestMMPEngine:
         )
         assert mesh.has_attribute("@geodesic_distance")
         assert distance >= 0.0
+
+
+class TestMultiSource:
+    @pytest.mark.parametrize(
+        "engine_type",
+        [
+            lagrange.geodesic.GeodesicEngineDGPC,
+            lagrange.geodesic.GeodesicEngineHeat,
+            lagrange.geodesic.GeodesicEngineMMP,
+        ],
+    )
+    def test_multi_source(self, mesh, engine_type):
+        engine = engine_type(mesh)
+        dist_id, source_id = engine.multi_source_geodesic(
+            source_facet_ids=[0, 0],
+            source_facet_bcs=[[0.0, 0.0], [1.0, 0.0]],
+        )
+        assert mesh.get_attribute_id("@geodesic_distance") == dist_id
+        assert mesh.get_attribute_id("@geodesic_source") == source_id
+        sources = mesh.attribute(source_id).data
+        assert sources[0] == 0
+        assert sources[1] == 1
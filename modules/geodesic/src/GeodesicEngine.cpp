@@ -12,10 +12,61 @@
 #include <lagrange/geodesic/GeodesicEngine.h>
 
 #include <lagrange/SurfaceMeshTypes.h>
+#include <lagrange/internal/find_attribute_utils.h>
+#include <lagrange/utils/assert.h>
+#include <lagrange/utils/invalid.h>
 #include <lagrange/views.h>
 
+#include <algorithm>
+
 namespace lagrange::geodesic {
 
+namespace {
+
+// Number of sources whose distance fields are held in memory at once when reducing them to the
+// nearest source.
+constexpr size_t s_source_chunk_size = 64;
+
+// Temporary attribute names used to collect per-source results in the default implementation.
+constexpr std::string_view s_tmp_geodesic_attribute_name = "@__batched_geodesic_distance__";
+constexpr std::string_view s_tmp_polar_angle_attribute_name = "@__batched_geodesic_polar_angle__";
+
+std::array<double, 2> get_source_bc(const MultiSourceGeodesicOptions& options, size_t i)
+{
+    return options.source_facet_bcs.empty() ? std::array<double, 2>{0.0, 0.0}
+                                            : options.source_facet_bcs[i];
+}
+
+template <typename Scalar, typename Index>
+void check_sources(
+    const SurfaceMesh<Scalar, Index>& mesh,
+    const MultiSourceGeodesicOptions& options)
+{
+    la_runtime_assert(
+        options.source_facet_bcs.empty() ||
+            options.source_facet_bcs.size() == options.source_facet_ids.size(),
+        "Number of source barycentric coordinates must match the number of source facets.");
+    for (size_t f : options.source_facet_ids) {
+        la_runtime_assert(f < mesh.get_num_facets(), "Source facet id is out of range.");
+    }
+}
+
+// Interpolates a per-vertex field at a point given by its facet and barycentric coordinates.
+template <typename Scalar, typename Index, typename Derived>
+Scalar interpolate_at(
+    const SurfaceMesh<Scalar, Index>& mesh,
+    const Eigen::MatrixBase<Derived>& field,
+    size_t facet_id,
+    const std::array<double, 2>& bc)
+{
+    auto facets = facet_view(mesh);
+    return static_cast<Scalar>(
+        field(facets(facet_id, 0)) * (1.0 - bc[0] - bc[1]) + field(facets(facet_id, 1)) * bc[0] +
+        field(facets(facet_id, 2)) * bc[1]);
+}
+
+} // namespace
+
 template <typename Scalar, typename Index>
 GeodesicEngine<Scalar, Index>::GeodesicEngine(Mesh& mesh)
     : m_mesh(mesh)
@@ -41,12 +92,117 @@ Scalar GeodesicEngine<Scalar, Index>::point_to_point_geodesic(
 
     auto result = single_source_geodesic(s_options);
     auto geo_dists = attribute_vector_view<Scalar>(mesh(), result.geodesic_distance_id);
+    return interpolate_at(mesh(), geo_dists, options.target_facet_id, options.target_facet_bc);
+}
+
+template <typename Scalar, typename Index>
+MultiSourceGeodesicResult GeodesicEngine<Scalar, Index>::multi_source_geodesic(
+    const MultiSourceGeodesicOptions& options)
+{
+    check_sources(mesh(), options);
+    const Index num_vertices = mesh().get_num_vertices();
+    const size_t num_sources = options.source_facet_ids.size();
+
+    Eigen::Matrix<Scalar, Eigen::Dynamic, 1> nearest_distance(num_vertices);
+    Eigen::Matrix<Index, Eigen::Dynamic, 1> nearest_source(num_vertices);
+    nearest_distance.setConstant(invalid<Scalar>());
+    nearest_source.setConstant(invalid<Index>());
 
-    auto facets = facet_view(mesh());
-    return geo_dists(facets(options.target_facet_id, 0)) *
-               (1.0 - options.target_facet_bc[0] - options.target_facet_bc[1]) +
-           geo_dists(facets(options.target_facet_id, 1)) * options.target_facet_bc[0] +
-           geo_dists(facets(options.target_facet_id, 2)) * options.target_facet_bc[1];
+    // Reduce the per-source distance fields chunk by chunk to bound memory usage.
+    MultiSourceGeodesicOptions chunk_options;
+    chunk_options.radius = options.radius;
+    for (size_t begin = 0; begin < num_sources; begin += s_source_chunk_size) {
+        const size_t end = std::min(begin + s_source_chunk_size, num_sources);
+        chunk_options.source_facet_ids.assign(
+            options.source_facet_ids.begin() + begin,
+            options.source_facet_ids.begin() + end);
+        chunk_options.source_facet_bcs.clear();
+        for (size_t i = begin; i < end; ++i) {
+            chunk_options.source_facet_bcs.push_back(get_source_bc(options, i));
+        }
+
+        auto distances = batched_geodesic(chunk_options);
+        for (Index v = 0; v < num_vertices; ++v) {
+            for (size_t j = 0; j < end - begin; ++j) {
+                if (distances(v, j) < nearest_distance[v]) {
+                    nearest_distance[v] = distances(v, j);
+                    nearest_source[v] = static_cast<Index>(begin + j);
+                }
+            }
+        }
+    }
+
+    auto geodesic_distance_id = internal::find_or_create_attribute<Scalar>(
+        mesh(),
+        options.output_geodesic_attribute_name,
+        AttributeElement::Vertex,
+        AttributeUsage::Scalar,
+        1,
+        internal::ResetToDefault::No);
+    attribute_vector_ref<Scalar>(mesh(), geodesic_distance_id) = nearest_distance;
+    if (options.output_source_attribute_name.empty()) {
+        return {geodesic_distance_id, invalid_attribute_id()};
+    }
+
+    auto source_index_id = internal::find_or_create_attribute<Index>(
+        mesh(),
+        options.output_source_attribute_name,
+        AttributeElement::Vertex,
+        AttributeUsage::Scalar,
+        1,
+        internal::ResetToDefault::No);
+    attribute_vector_ref<Index>(mesh(), source_index_id) = nearest_source;
+
+    return {geodesic_distance_id, source_index_id};
+}
+
+template <typename Scalar, typename Index>
+auto GeodesicEngine<Scalar, Index>::batched_geodesic(const MultiSourceGeodesicOptions& options)
+    -> Eigen::Matrix<Scalar, Eigen::Dynamic, Eigen::Dynamic>
+{
+    check_sources(mesh(), options);
+    const size_t num_sources = options.source_facet_ids.size();
+    Eigen::Matrix<Scalar, Eigen::Dynamic, Eigen::Dynamic> distances(
+        mesh().get_num_vertices(),
+        num_sources);
+
+    SingleSourceGeodesicOptions s_options;
+    s_options.radius = options.radius;
+    s_options.output_geodesic_attribute_name = s_tmp_geodesic_attribute_name;
+    s_options.output_polar_angle_attribute_name = s_tmp_polar_angle_attribute_name;
+    for (size_t j = 0; j < num_sources; ++j) {
+        s_options.source_facet_id = options.source_facet_ids[j];
+        s_options.source_facet_bc = get_source_bc(options, j);
+        auto result = single_source_geodesic(s_options);
+        distances.col(j) = attribute_vector_view<Scalar>(mesh(), result.geodesic_distance_id);
+    }
+
+    for (auto name : {s_tmp_geodesic_attribute_name, s_tmp_polar_angle_attribute_name}) {
+        if (mesh().has_attribute(name)) {
+            mesh().delete_attribute(name);
+        }
+    }
+    return distances;
+}
+
+template <typename Scalar, typename Index>
+auto GeodesicEngine<Scalar, Index>::pairwise_geodesic(const MultiSourceGeodesicOptions& options)
+    -> Eigen::Matrix<Scalar, Eigen::Dynamic, Eigen::Dynamic>
+{
+    const auto distances = batched_geodesic(options);
+    const Eigen::Index num_sources = distances.cols();
+
+    Eigen::Matrix<Scalar, Eigen::Dynamic, Eigen::Dynamic> result(num_sources, num_sources);
+    for (Eigen::Index j = 0; j < num_sources; ++j) {
+        for (Eigen::Index i = 0; i < num_sources; ++i) {
+            result(i, j) = interpolate_at(
+                mesh(),
+                distances.col(j),
+                options.source_facet_ids[i],
+                get_source_bc(options, i));
+        }
+    }
+    return (result + result.transpose()) / Scalar(2);
 }
 
 #define LA_X_GeodesicEngine(_, Scalar, Index) \
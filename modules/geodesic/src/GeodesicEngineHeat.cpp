@@ -14,18 +14,26 @@
 #include <lagrange/SurfaceMeshTypes.h>
 #include <lagrange/geodesic/api.h>
 #include <lagrange/internal/find_attribute_utils.h>
+#include <lagrange/utils/assert.h>
+#include <lagrange/utils/invalid.h>
 #include <lagrange/views.h>
 
 #include "geometry_central_utils.h"
 
 // clang-format off
 #include <lagrange/utils/warnoff.h>
+#include <Eigen/SparseCholesky>
 #include <geometrycentral/surface/vector_heat_method.h>
+#include <tbb/parallel_for.h>
 #include <lagrange/utils/warnon.h>
 // clang-format on
 
+#include <algorithm>
+#include <array>
+#include <limits>
 #include <memory>
 #include <optional>
+#include <vector>
 
 namespace lagrange::geodesic {
 
@@ -33,12 +41,190 @@ using gcSurfaceMesh = gc::gcSurfaceMesh;
 using gcGeometry = gc::gcGeometry;
 using gcSurfacePoint = gc::gcSurfacePoint;
 
+namespace {
+
+// Regularization of the Poisson system, which is otherwise singular (constant kernel).
+constexpr double s_poisson_regularization = 1e-8;
+
+// Number of sources solved together when computing the nearest source index, which bounds the
+// size of the right-hand side blocks.
+constexpr size_t s_source_chunk_size = 64;
+
+std::array<double, 2> get_source_bc(const MultiSourceGeodesicOptions& options, size_t i)
+{
+    return options.source_facet_bcs.empty() ? std::array<double, 2>{0.0, 0.0}
+                                            : options.source_facet_bcs[i];
+}
+
+template <typename Scalar, typename Index>
+void check_sources(
+    const SurfaceMesh<Scalar, Index>& mesh,
+    const MultiSourceGeodesicOptions& options)
+{
+    la_runtime_assert(
+        options.source_facet_bcs.empty() ||
+            options.source_facet_bcs.size() == options.source_facet_ids.size(),
+        "Number of source barycentric coordinates must match the number of source facets.");
+    for (size_t f : options.source_facet_ids) {
+        la_runtime_assert(f < mesh.get_num_facets(), "Source facet id is out of range.");
+    }
+}
+
+} // namespace
+
 template <typename Scalar, typename Index>
 struct GeodesicEngineHeat<Scalar, Index>::Impl
 {
+    using SparseMatrix = Eigen::SparseMatrix<double>;
+    using Solver = Eigen::SimplicialLDLT<SparseMatrix>;
+
     std::unique_ptr<gcSurfaceMesh> m_gc_mesh;
     std::unique_ptr<gcGeometry> m_gc_geom;
     std::optional<geometrycentral::surface::HeatMethodDistanceSolver> m_solver;
+
+    // Block solver state, built on the first batched query. The factorizations of m_solver are
+    // private and only accept one right-hand side at a time, so the same heat flow and Poisson
+    // systems are factorized here, from the geometry-central operators, to solve all sources of a
+    // batch in one pass.
+    bool m_has_block_solver = false;
+    Solver m_heat_solver;
+    Solver m_poisson_solver;
+
+    // Per facet, column k of the gradient operator maps the value at corner k to the gradient of
+    // the interpolated field, and column k of the divergence operator is the vector whose dot
+    // product with a facet vector field gives its integrated divergence at corner k.
+    std::vector<Eigen::Matrix3d> m_facet_gradients;
+    std::vector<Eigen::Matrix3d> m_facet_divergences;
+
+    // Computes the distance field from a source point, reusing the solver factorizations.
+    geometrycentral::surface::VertexData<double> compute_distance(
+        size_t source_facet_id,
+        const std::array<double, 2>& source_facet_bc)
+    {
+        return m_solver->computeDistance(make_surface_point(source_facet_id, source_facet_bc));
+    }
+
+    gcSurfacePoint make_surface_point(size_t facet_id, const std::array<double, 2>& bc) const
+    {
+        return gcSurfacePoint(
+            m_gc_mesh->face(facet_id),
+            geometrycentral::Vector3{1.0 - bc[0] - bc[1], bc[0], bc[1]});
+    }
+
+    void initialize_block_solver(const SurfaceMesh<Scalar, Index>& mesh)
+    {
+        if (m_has_block_solver) return;
+
+        m_gc_geom->requireEdgeLengths();
+        m_gc_geom->requireCotanLaplacian();
+        m_gc_geom->requireVertexLumpedMassMatrix();
+
+        // Diffusion time is the squared mean edge length, as in HeatMethodDistanceSolver.
+        double mean_edge_length = 0;
+        for (auto e : m_gc_mesh->edges()) {
+            mean_edge_length += m_gc_geom->edgeLengths[e];
+        }
+        mean_edge_length /= static_cast<double>(std::max<size_t>(m_gc_mesh->nEdges(), 1));
+        const double t = mean_edge_length * mean_edge_length;
+
+        const SparseMatrix& laplacian = m_gc_geom->cotanLaplacian;
+        const SparseMatrix& mass = m_gc_geom->vertexLumpedMassMatrix;
+        m_heat_solver.compute(mass + t * laplacian);
+        la_runtime_assert(
+            m_heat_solver.info() == Eigen::Success,
+            "Failed to factorize the heat flow system.");
+        m_poisson_solver.compute(laplacian + s_poisson_regularization * mass);
+        la_runtime_assert(
+            m_poisson_solver.info() == Eigen::Success,
+            "Failed to factorize the Poisson system.");
+
+        auto vertices = vertex_view(mesh);
+        auto facets = facet_view(mesh);
+        const Index num_facets = mesh.get_num_facets();
+        m_facet_gradients.assign(num_facets, Eigen::Matrix3d::Zero());
+        m_facet_divergences.assign(num_facets, Eigen::Matrix3d::Zero());
+        for (Index f = 0; f < num_facets; ++f) {
+            std::array<Eigen::Vector3d, 3> p;
+            for (Index k = 0; k < 3; ++k) {
+                p[k] = vertices.row(facets(f, k)).transpose().template cast<double>();
+            }
+            const Eigen::Vector3d n = (p[1] - p[0]).cross(p[2] - p[0]);
+            const double double_area = n.norm();
+            if (double_area == 0) continue; // Degenerate facets do not carry any flow.
+            const Eigen::Vector3d unit_normal = n / double_area;
+            for (Index k = 0; k < 3; ++k) {
+                const Eigen::Vector3d& pi = p[k];
+                const Eigen::Vector3d& pj = p[(k + 1) % 3];
+                const Eigen::Vector3d& pl = p[(k + 2) % 3];
+                // The gradient of the hat function of corner k is orthogonal to its opposite edge.
+                m_facet_gradients[f].col(k) = unit_normal.cross(pl - pj) / double_area;
+                // Cotangents of the angles at the two other corners.
+                const double cot_j = (pi - pj).dot(pl - pj) / double_area;
+                const double cot_l = (pi - pl).dot(pj - pl) / double_area;
+                m_facet_divergences[f].col(k) = 0.5 * (cot_l * (pj - pi) + cot_j * (pl - pi));
+            }
+        }
+        m_has_block_solver = true;
+    }
+
+    // Computes the distance fields of a batch of sources. The heat flow and Poisson right-hand
+    // sides of all sources are stacked as the columns of a matrix, and each system is solved for
+    // the whole batch in one pass over its factorization.
+    Eigen::MatrixXd compute_distances(
+        const SurfaceMesh<Scalar, Index>& mesh,
+        const MultiSourceGeodesicOptions& options,
+        size_t begin,
+        size_t end)
+    {
+        initialize_block_solver(mesh);
+        auto facets = facet_view(mesh);
+        const Eigen::Index num_vertices = static_cast<Eigen::Index>(mesh.get_num_vertices());
+        const Eigen::Index num_sources = static_cast<Eigen::Index>(end - begin);
+
+        Eigen::MatrixXd sources = Eigen::MatrixXd::Zero(num_vertices, num_sources);
+        for (Eigen::Index j = 0; j < num_sources; ++j) {
+            const size_t f = options.source_facet_ids[begin + static_cast<size_t>(j)];
+            const auto bc = get_source_bc(options, begin + static_cast<size_t>(j));
+            sources(facets(f, 0), j) += 1.0 - bc[0] - bc[1];
+            sources(facets(f, 1), j) += bc[0];
+            sources(facets(f, 2), j) += bc[1];
+        }
+        const Eigen::MatrixXd heat = m_heat_solver.solve(sources);
+
+        // Normalize the heat gradient, and integrate the divergence of the resulting unit field.
+        // Columns are independent, but facets scatter into shared vertices.
+        Eigen::MatrixXd divergence = Eigen::MatrixXd::Zero(num_vertices, num_sources);
+        tbb::parallel_for(Eigen::Index(0), num_sources, [&](Eigen::Index j) {
+            for (Eigen::Index f = 0; f < facets.rows(); ++f) {
+                const Eigen::Vector3d u(
+                    heat(facets(f, 0), j),
+                    heat(facets(f, 1), j),
+                    heat(facets(f, 2), j));
+                const Eigen::Vector3d grad = m_facet_gradients[f] * u;
+                const double norm = grad.norm();
+                if (norm == 0) continue;
+                const Eigen::Vector3d flow = -grad / norm;
+                const Eigen::Vector3d corner_div = m_facet_divergences[f].transpose() * flow;
+                for (Eigen::Index k = 0; k < 3; ++k) {
+                    divergence(facets(f, k), j) += corner_div[k];
+                }
+            }
+        });
+
+        // The geometry-central Laplacian is positive semi-definite, hence the sign flip.
+        Eigen::MatrixXd distances = m_poisson_solver.solve(-divergence);
+
+        // Shift each field so that its source is at distance zero.
+        for (Eigen::Index j = 0; j < num_sources; ++j) {
+            const size_t f = options.source_facet_ids[begin + static_cast<size_t>(j)];
+            const auto bc = get_source_bc(options, begin + static_cast<size_t>(j));
+            const double shift = (1.0 - bc[0] - bc[1]) * distances(facets(f, 0), j) +
+                                 bc[0] * distances(facets(f, 1), j) +
+                                 bc[1] * distances(facets(f, 2), j);
+            distances.col(j).array() -= shift;
+        }
+        return distances;
+    }
 };
 
 template <typename Scalar, typename Index>
@@ -65,14 +251,10 @@ template <typename Scalar, typename Index>
 SingleSourceGeodesicResult GeodesicEngineHeat<Scalar, Index>::single_source_geodesic(
     const SingleSourceGeodesicOptions& options)
 {
-    gcSurfacePoint seed_point(
-        m_impl->m_gc_mesh->face(options.source_facet_id),
-        geometrycentral::Vector3{
-            1.0 - options.source_facet_bc[0] - options.source_facet_bc[1],
-            options.source_facet_bc[0],
-            options.source_facet_bc[1]});
-
-    auto gc_distances = m_impl->m_solver->computeDistance(seed_point);
+    la_runtime_assert(
+        options.source_facet_id < this->mesh().get_num_facets(),
+        "Source facet id is out of range.");
+    auto gc_distances = m_impl->compute_distance(options.source_facet_id, options.source_facet_bc);
 
     auto geodesic_distance_id = internal::find_or_create_attribute<Scalar>(
         this->mesh(),
@@ -92,6 +274,82 @@ SingleSourceGeodesicResult GeodesicEngineHeat<Scalar, Index>::single_source_geod
     return {geodesic_distance_id, invalid_attribute_id()};
 }
 
+template <typename Scalar, typename Index>
+MultiSourceGeodesicResult GeodesicEngineHeat<Scalar, Index>::multi_source_geodesic(
+    const MultiSourceGeodesicOptions& options)
+{
+    check_sources(this->mesh(), options);
+    const size_t num_sources = options.source_facet_ids.size();
+    if (num_sources == 0) return Super::multi_source_geodesic(options);
+
+    // A single heat flow from all the sources gives the distance to the nearest one.
+    std::vector<gcSurfacePoint> seed_points;
+    seed_points.reserve(num_sources);
+    for (size_t i = 0; i < num_sources; ++i) {
+        seed_points.push_back(
+            m_impl->make_surface_point(options.source_facet_ids[i], get_source_bc(options, i)));
+    }
+    auto gc_distances = m_impl->m_solver->computeDistance(seed_points);
+
+    auto geodesic_distance_id = internal::find_or_create_attribute<Scalar>(
+        this->mesh(),
+        options.output_geodesic_attribute_name,
+        AttributeElement::Vertex,
+        AttributeUsage::Scalar,
+        1,
+        internal::ResetToDefault::No);
+    auto la_distance = attribute_vector_ref<Scalar>(this->mesh(), geodesic_distance_id);
+    Index count = 0;
+    for (auto v : m_impl->m_gc_mesh->vertices()) {
+        la_distance[count] = static_cast<Scalar>(gc_distances[v]);
+        count++;
+    }
+    if (options.output_source_attribute_name.empty()) {
+        return {geodesic_distance_id, invalid_attribute_id()};
+    }
+
+    // The nearest source is not recoverable from the combined flow, so it requires the per-source
+    // distance fields, solved in blocks of sources.
+    const Index num_vertices = this->mesh().get_num_vertices();
+    Eigen::VectorXd nearest_distance =
+        Eigen::VectorXd::Constant(num_vertices, std::numeric_limits<double>::infinity());
+    Eigen::Matrix<Index, Eigen::Dynamic, 1> nearest_source(num_vertices);
+    nearest_source.setConstant(invalid<Index>());
+    for (size_t begin = 0; begin < num_sources; begin += s_source_chunk_size) {
+        const size_t end = std::min(begin + s_source_chunk_size, num_sources);
+        const auto distances = m_impl->compute_distances(this->mesh(), options, begin, end);
+        for (Index v = 0; v < num_vertices; ++v) {
+            for (size_t j = 0; j < end - begin; ++j) {
+                if (distances(v, j) < nearest_distance[v]) {
+                    nearest_distance[v] = distances(v, j);
+                    nearest_source[v] = static_cast<Index>(begin + j);
+                }
+            }
+        }
+    }
+
+    auto source_index_id = internal::find_or_create_attribute<Index>(
+        this->mesh(),
+        options.output_source_attribute_name,
+        AttributeElement::Vertex,
+        AttributeUsage::Scalar,
+        1,
+        internal::ResetToDefault::No);
+    attribute_vector_ref<Index>(this->mesh(), source_index_id) = nearest_source;
+
+    return {geodesic_distance_id, source_index_id};
+}
+
+template <typename Scalar, typename Index>
+auto GeodesicEngineHeat<Scalar, Index>::batched_geodesic(const MultiSourceGeodesicOptions& options)
+    -> Eigen::Matrix<Scalar, Eigen::Dynamic, Eigen::Dynamic>
+{
+    check_sources(this->mesh(), options);
+    return m_impl
+        ->compute_distances(this->mesh(), options, 0, options.source_facet_ids.size())
+        .template cast<Scalar>();
+}
+
 #define LA_X_GeodesicEngineHeat(_, Scalar, Index) \
     template class LA_GEODESIC_API GeodesicEngineHeat<Scalar, Index>;
 LA_SURFACE_MESH_X(GeodesicEngineHeat, 0)
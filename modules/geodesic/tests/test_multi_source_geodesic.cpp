@@ -0,0 +1,134 @@
+/*
+ * Copyright 2025 Adobe. All rights reserved.
+ * This file is licensed to you under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License. You may obtain a copy
+ * of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR REPRESENTATIONS
+ * OF ANY KIND, either express or implied. See the License for the specific language
+ * governing permissions and limitations under the License.
+ */
+#include <lagrange/geodesic/GeodesicEngineDGPC.h>
+#include <lagrange/geodesic/GeodesicEngineHeat.h>
+#include <lagrange/geodesic/GeodesicEngineMMP.h>
+#include <lagrange/testing/common.h>
+#include <lagrange/views.h>
+
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+namespace {
+
+using Scalar = float;
+using Index = uint32_t;
+
+// The heat engine solves batches with its own factorizations, and its nearest source distance
+// comes from a single heat flow from all sources, so it only approximates the per-source results.
+void test_engine(
+    lagrange::SurfaceMesh<Scalar, Index>& mesh,
+    lagrange::geodesic::GeodesicEngine<Scalar, Index>& engine,
+    Scalar batched_tolerance = 1e-4f,
+    Scalar nearest_tolerance = 1e-4f)
+{
+    lagrange::geodesic::MultiSourceGeodesicOptions options;
+    options.source_facet_ids = {0, 10, 20, 30};
+    options.source_facet_bcs = {{0.0, 0.0}, {0.3, 0.2}, {0.1, 0.4}, {0.5, 0.5}};
+
+    auto distances = engine.batched_geodesic(options);
+    REQUIRE(distances.rows() == mesh.get_num_vertices());
+    REQUIRE(distances.cols() == 4);
+
+    SECTION("Batched distances match single source")
+    {
+        for (size_t j = 0; j < options.source_facet_ids.size(); ++j) {
+            lagrange::geodesic::SingleSourceGeodesicOptions s_options;
+            s_options.source_facet_id = options.source_facet_ids[j];
+            s_options.source_facet_bc = options.source_facet_bcs[j];
+            auto result = engine.single_source_geodesic(s_options);
+            auto single =
+                lagrange::attribute_vector_view<Scalar>(mesh, result.geodesic_distance_id);
+            REQUIRE(distances.col(j).isApprox(single, batched_tolerance));
+        }
+    }
+
+    SECTION("Nearest source")
+    {
+        auto result = engine.multi_source_geodesic(options);
+        auto nearest_distance =
+            lagrange::attribute_vector_view<Scalar>(mesh, result.geodesic_distance_id);
+        auto nearest_source = lagrange::attribute_vector_view<Index>(mesh, result.source_index_id);
+        for (Index v = 0; v < mesh.get_num_vertices(); ++v) {
+            Eigen::Index j;
+            const Scalar d = distances.row(v).minCoeff(&j);
+            REQUIRE_THAT(nearest_distance[v], Catch::Matchers::WithinAbs(d, nearest_tolerance));
+            REQUIRE(distances(v, nearest_source[v]) == d);
+        }
+    }
+
+    SECTION("Nearest source distance only")
+    {
+        options.output_source_attribute_name = "";
+        auto result = engine.multi_source_geodesic(options);
+        REQUIRE(result.source_index_id == lagrange::invalid_attribute_id());
+        auto nearest_distance =
+            lagrange::attribute_vector_view<Scalar>(mesh, result.geodesic_distance_id);
+        for (Index v = 0; v < mesh.get_num_vertices(); ++v) {
+            const Scalar d = distances.row(v).minCoeff();
+            REQUIRE_THAT(nearest_distance[v], Catch::Matchers::WithinAbs(d, nearest_tolerance));
+        }
+    }
+
+    SECTION("Pairwise distances")
+    {
+        auto pairwise = engine.pairwise_geodesic(options);
+        REQUIRE(pairwise.rows() == 4);
+        REQUIRE(pairwise.cols() == 4);
+        REQUIRE(pairwise.isApprox(pairwise.transpose()));
+        for (Eigen::Index i = 0; i < 4; ++i) {
+            REQUIRE_THAT(pairwise(i, i), Catch::Matchers::WithinAbs(0.0f, 1e-3f));
+            for (Eigen::Index j = 0; j < 4; ++j) {
+                if (i != j) REQUIRE(pairwise(i, j) > 0);
+            }
+        }
+    }
+}
+
+} // namespace
+
+TEST_CASE("compute_geodesic_multi_source", "[geodesic][multi_source]")
+{
+    auto mesh = lagrange::testing::load_surface_mesh<Scalar, Index>("open/core/ball.obj");
+
+    SECTION("DGPC Engine")
+    {
+        auto dgpc_engine = lagrange::geodesic::make_dgpc_engine(mesh);
+        test_engine(mesh, dgpc_engine);
+    }
+
+    SECTION("MMP Engine")
+    {
+        auto mmp_engine = lagrange::geodesic::make_mmp_engine(mesh);
+        test_engine(mesh, mmp_engine);
+    }
+
+    SECTION("Heat Engine")
+    {
+        auto heat_engine = lagrange::geodesic::make_heat_engine(mesh);
+        test_engine(mesh, heat_engine, 1e-3f, 0.5f);
+    }
+}
+
+TEST_CASE("compute_geodesic_multi_source_invalid", "[geodesic][multi_source]")
+{
+    auto mesh = lagrange::testing::load_surface_mesh<Scalar, Index>("open/core/ball.obj");
+    auto engine = lagrange::geodesic::make_heat_engine(mesh);
+
+    lagrange::geodesic::MultiSourceGeodesicOptions options;
+    options.source_facet_ids = {0, 1};
+    options.source_facet_bcs = {{0.0, 0.0}};
+    LA_REQUIRE_THROWS(engine.batched_geodesic(options));
+
+    options.source_facet_bcs.clear();
+    options.source_facet_ids = {mesh.get_num_facets()};
+    LA_REQUIRE_THROWS(engine.multi_source_geodesic(options));
+}
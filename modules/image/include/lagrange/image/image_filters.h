@@ -74,7 +74,11 @@ void make_diff_xkernel(image::ImageView<float>& kernel);
 void make_diff_ykernel(image::ImageView<float>& kernel);
 
 /**
- * Convolves the given image with the specified kernel, using periodic boundary conditions.
+ * Convolves the given image with the specified kernel, using mirrored boundary conditions. The
+ * absolute value of the convolution is stored in the result.
+ *
+ * Separable kernels are applied as two 1D passes, and constant (box) kernels use running sums
+ * whose cost does not depend on the kernel size. Rows are processed in parallel.
  *
  * @param[in]  image The input image. Must be larger than the kernel
  * @param[in]  kernel The kernel.
@@ -28,5 +28,37 @@ LA_IMAGE_API image::RawInputImage raw_input_image_from_image_view(
     image::ImageViewBase& in,
     bool copy_buffer = false);
 
+/**
+ * Transfer function of 8-bit color channels.
+ */
+enum class ColorTransfer {
+    Linear, ///< [0, 255] maps linearly to [0, 1], as in convert_image_pixel
+    SRGB ///< color channels are sRGB-encoded, alpha channels are linear
+};
+
+/**
+ * Converts an image into a caller-provided view of the same size, without allocating. Unlike
+ * ImageView::convert_from, the destination view is not resized, so it can point into an existing
+ * buffer (e.g. a sub-region of a larger image). Rows are converted in parallel, with vectorizable
+ * kernels for contiguous rows.
+ *
+ * Supported pairs, in both directions, are 8-bit / float32 images with 1 <=> 1 channel, or with
+ * 3 or 4 <=> 3 or 4 channels. Channel values follow convert_image_pixel: a missing alpha channel
+ * is set to opaque, and an extra one is dropped. With ColorTransfer::SRGB, color channels are
+ * decoded to (or encoded from) linear values through lookup tables, and float values are rounded
+ * to the nearest 8-bit value.
+ *
+ * @param[in]  src      The source image.
+ * @param[out] dst      The destination view. Must have the same size as the source image.
+ * @param[in]  transfer The transfer function of the 8-bit image.
+ *
+ * @return     False if the sizes of the two images do not match.
+ */
+template <typename S, typename T>
+bool convert_image(
+    const ImageView<S>& src,
+    ImageView<T>& dst,
+    ColorTransfer transfer = ColorTransfer::Linear);
+
 } // namespace image
 } // namespace lagrange
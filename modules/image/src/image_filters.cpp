@@ -13,9 +13,207 @@
 #include <lagrange/utils/assert.h>
 #include <lagrange/utils/range.h>
 
+// clang-format off
+#include <lagrange/utils/warnoff.h>
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <lagrange/utils/warnon.h>
+// clang-format on
+
+#include <Eigen/Core>
+
+#include <cmath>
+#include <vector>
+
 namespace lagrange {
 namespace image {
 
+namespace {
+
+// Kernel coefficients, indexed by (row, column).
+using KernelMatrix = Eigen::Matrix<float, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>;
+
+using RowArray = Eigen::Map<Eigen::ArrayXf>;
+using ConstRowArray = Eigen::Map<const Eigen::ArrayXf>;
+
+// Compact single channel image buffer.
+struct ImageBuffer
+{
+    float* data;
+    int width;
+    int height;
+
+    float* row_data(int j) const { return data + (size_t)j * width; }
+    RowArray row(int j) const { return RowArray(row_data(j), width); }
+};
+
+// Number of rows processed by a task.
+constexpr int ROW_GRAIN_SIZE = 16;
+
+// Mirrors an out-of-range pixel index back into [0, size).
+int reflect_index(int index, int size)
+{
+    if (index < 0) index = -index;
+    if (index >= size) index = (size - 1) + (size - index);
+    return index;
+}
+
+// Copies a row of the image into `padded`, extended by reflection by `before` pixels on the left
+// and `after` pixels on the right.
+template <typename T>
+void pad_row(const float* row, int width, int before, int after, std::vector<T>& padded)
+{
+    padded.resize(width + before + after);
+    for (int i = 0; i < before; ++i) {
+        padded[i] = (T)row[reflect_index(i - before, width)];
+    }
+    for (int i = 0; i < width; ++i) {
+        padded[before + i] = (T)row[i];
+    }
+    for (int i = 0; i < after; ++i) {
+        padded[before + width + i] = (T)row[reflect_index(width + i, width)];
+    }
+}
+
+bool is_box_kernel(const KernelMatrix& K)
+{
+    return (K.array() == K(0, 0)).all();
+}
+
+// Checks whether the kernel is the outer product of a vertical and a horizontal 1D kernel.
+bool is_separable_kernel(
+    const KernelMatrix& K,
+    Eigen::VectorXf& kernel_x,
+    Eigen::VectorXf& kernel_y)
+{
+    Eigen::Index p, q;
+    const float max_coeff = K.cwiseAbs().maxCoeff(&p, &q);
+    if (max_coeff == 0.0f) return false;
+    kernel_x = K.row(p).transpose();
+    kernel_y = K.col(q) / K(p, q);
+    const float error = (K - kernel_y * kernel_x.transpose()).cwiseAbs().maxCoeff();
+    return error <= 1e-6f * max_coeff;
+}
+
+// out(i, j) = scale * sum_k kernel[k] * in(i + k - center, j)
+void convolve_x(const ImageBuffer& in, const Eigen::VectorXf& kernel, float scale, ImageBuffer& out)
+{
+    const int size = (int)kernel.size();
+    const int center = size / 2;
+    const Eigen::VectorXf weights = kernel * scale;
+    tbb::parallel_for(
+        tbb::blocked_range<int>(0, in.height, ROW_GRAIN_SIZE),
+        [&](const tbb::blocked_range<int>& rows) {
+            std::vector<float> padded;
+            for (int j = rows.begin(); j != rows.end(); ++j) {
+                pad_row(in.row_data(j), in.width, center, size - 1 - center, padded);
+                auto out_row = out.row(j);
+                out_row.setZero();
+                for (int k = 0; k < size; ++k) {
+                    out_row += weights[k] * ConstRowArray(padded.data() + k, in.width);
+                }
+            }
+        });
+}
+
+// out(i, j) = scale * sum_k kernel[k] * in(i, j + k - center)
+void convolve_y(const ImageBuffer& in, const Eigen::VectorXf& kernel, float scale, ImageBuffer& out)
+{
+    const int size = (int)kernel.size();
+    const int center = size / 2;
+    const Eigen::VectorXf weights = kernel * scale;
+    tbb::parallel_for(
+        tbb::blocked_range<int>(0, in.height, ROW_GRAIN_SIZE),
+        [&](const tbb::blocked_range<int>& rows) {
+            for (int j = rows.begin(); j != rows.end(); ++j) {
+                auto out_row = out.row(j);
+                out_row.setZero();
+                for (int k = 0; k < size; ++k) {
+                    out_row += weights[k] * in.row(reflect_index(j + k - center, in.height));
+                }
+            }
+        });
+}
+
+// Non-separable kernel: one vectorized pass per kernel coefficient.
+void convolve_2d(const ImageBuffer& in, const KernelMatrix& K, ImageBuffer& out)
+{
+    const int kernel_height = (int)K.rows();
+    const int kernel_width = (int)K.cols();
+    const int kernel_h_center = kernel_height / 2;
+    const int kernel_w_center = kernel_width / 2;
+    tbb::parallel_for(
+        tbb::blocked_range<int>(0, in.height, ROW_GRAIN_SIZE),
+        [&](const tbb::blocked_range<int>& rows) {
+            std::vector<float> padded;
+            for (int j = rows.begin(); j != rows.end(); ++j) {
+                auto out_row = out.row(j);
+                out_row.setZero();
+                for (int kh = 0; kh < kernel_height; ++kh) {
+                    const int h_index = reflect_index(j + kh - kernel_h_center, in.height);
+                    pad_row(
+                        in.row_data(h_index),
+                        in.width,
+                        kernel_w_center,
+                        kernel_width - 1 - kernel_w_center,
+                        padded);
+                    for (int kw = 0; kw < kernel_width; ++kw) {
+                        out_row += K(kh, kw) * ConstRowArray(padded.data() + kw, in.width);
+                    }
+                }
+            }
+        });
+}
+
+// Horizontal box filter using a summed-area table of each row.
+void box_filter_x(const ImageBuffer& in, int size, float value, ImageBuffer& out)
+{
+    const int center = size / 2;
+    tbb::parallel_for(
+        tbb::blocked_range<int>(0, in.height, ROW_GRAIN_SIZE),
+        [&](const tbb::blocked_range<int>& rows) {
+            std::vector<double> sums;
+            for (int j = rows.begin(); j != rows.end(); ++j) {
+                pad_row(in.row_data(j), in.width, center, size - 1 - center, sums);
+                // Prefix sums, with sums[i] the sum of the first i padded pixels.
+                double acc = 0;
+                for (auto& x : sums) {
+                    double v = x;
+                    x = acc;
+                    acc += v;
+                }
+                sums.push_back(acc);
+                auto out_row = out.row(j);
+                for (int i = 0; i < in.width; ++i) {
+                    out_row[i] = (float)(value * (sums[i + size] - sums[i]));
+                }
+            }
+        });
+}
+
+// Vertical box filter using a sliding window sum over the rows of each block.
+void box_filter_y(const ImageBuffer& in, int size, float value, ImageBuffer& out)
+{
+    const int center = size / 2;
+    tbb::parallel_for(
+        tbb::blocked_range<int>(0, in.height, ROW_GRAIN_SIZE),
+        [&](const tbb::blocked_range<int>& rows) {
+            Eigen::ArrayXd window = Eigen::ArrayXd::Zero(in.width);
+            auto input_row = [&](int j) {
+                return in.row(reflect_index(j, in.height)).cast<double>();
+            };
+            for (int k = 0; k < size; ++k) {
+                window += input_row(rows.begin() + k - center);
+            }
+            for (int j = rows.begin(); j != rows.end(); ++j) {
+                out.row(j) = (value * window).cast<float>();
+                window += input_row(j + size - center) - input_row(j - center);
+            }
+        });
+}
+
+} // namespace
+
 void make_box_kernel(size_t size, image::ImageView<float>& kernel)
 {
     kernel.resize(size, size, 1);
@@ -114,35 +312,56 @@ void convolve(
     la_runtime_assert(image_width > kernel_width);
     la_runtime_assert(image_height > kernel_height);
 
+    // Copy the input into a compact buffer. This handles strided views, and allows result to be
+    // the same as image.
+    std::vector<float> input((size_t)image_width * image_height);
+    tbb::parallel_for(0, image_height, [&](int j) {
+        for (auto i : range(image_width)) {
+            input[(size_t)j * image_width + i] = image(i, j);
+        }
+    });
+
+    KernelMatrix K(kernel_height, kernel_width);
+    for (auto kh : range(kernel_height)) {
+        for (auto kw : range(kernel_width)) {
+            K(kh, kw) = kernel(kw, kh);
+        }
+    }
+
     image::ImageView<float> tmp(image_width, image_height, 1);
+    std::vector<float> output((size_t)image_width * image_height);
+    ImageBuffer in{input.data(), image_width, image_height};
+    ImageBuffer out{output.data(), image_width, image_height};
+
+    Eigen::VectorXf kernel_x, kernel_y;
+    if (is_box_kernel(K)) {
+        // Constant kernel: sliding window sums, whose cost does not depend on the kernel size.
+        std::vector<float> buffer(output.size());
+        ImageBuffer tmp_buffer{buffer.data(), image_width, image_height};
+        box_filter_x(in, kernel_width, K(0, 0), tmp_buffer);
+        box_filter_y(tmp_buffer, kernel_height, 1.0f, out);
+    } else if (is_separable_kernel(K, kernel_x, kernel_y)) {
+        // Rank-1 kernel: two 1D passes.
+        if (kernel_height == 1) {
+            convolve_x(in, kernel_x, kernel_y[0], out);
+        } else if (kernel_width == 1) {
+            convolve_y(in, kernel_y, kernel_x[0], out);
+        } else {
+            std::vector<float> buffer(output.size());
+            ImageBuffer tmp_buffer{buffer.data(), image_width, image_height};
+            convolve_x(in, kernel_x, 1.0f, tmp_buffer);
+            convolve_y(tmp_buffer, kernel_y, 1.0f, out);
+        }
+    } else {
+        convolve_2d(in, K, out);
+    }
 
-    int kernel_w_center = kernel_width / 2;
-    int kernel_h_center = kernel_height / 2;
     // Traverse all the pixels in image
-    for (auto j : range(image_height)) {
+    tbb::parallel_for(0, image_height, [&](int j) {
         for (auto i : range(image_width)) {
-            // Apply kernel!
-            float result_wh = 0.0f;
-            for (auto kh : range(kernel_height)) {
-                int h_index = j + (kh - kernel_h_center);
-                if (h_index < 0) h_index = -h_index;
-                if (h_index >= image_height)
-                    h_index = (image_height - 1) + (image_height - h_index);
-
-                for (auto kw : range(kernel_width)) {
-                    float kvalue = kernel(kw, kh);
-
-                    int w_index = i + (kw - kernel_w_center);
-                    if (w_index < 0) w_index = -w_index;
-                    if (w_index >= image_width)
-                        w_index = (image_width - 1) + (image_width - w_index);
-
-                    result_wh += kvalue * image(w_index, h_index);
-                }
-            }
-            tmp(i, j) = std::abs(result_wh);
+            tmp(i, j) = std::abs(output[(size_t)j * image_width + i]);
         }
-    }
+    });
 
     result = tmp;
 }
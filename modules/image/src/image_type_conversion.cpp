@@ -12,9 +12,137 @@
 #include <lagrange/image/image_type_conversion.h>
 #include <lagrange/utils/assert.h>
 
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <type_traits>
+#include <vector>
+
 namespace lagrange {
 namespace image {
 
+namespace {
+
+// Number of entries of the sRGB encoding table, indexed by quantized linear values. The table is
+// fine enough for the encoded value to be exact except very close to rounding boundaries.
+constexpr size_t srgb_encode_table_size = size_t(1) << 16;
+
+struct SRGBTables
+{
+    std::array<float, 256> decode;
+    std::vector<unsigned char> encode;
+};
+
+const SRGBTables& srgb_tables()
+{
+    static const SRGBTables tables = [] {
+        SRGBTables t;
+        for (size_t i = 0; i < t.decode.size(); ++i) {
+            const double c = static_cast<double>(i) / 255.0;
+            t.decode[i] = static_cast<float>(
+                c <= 0.04045 ? c / 12.92 : std::pow((c + 0.055) / 1.055, 2.4));
+        }
+        t.encode.resize(srgb_encode_table_size);
+        for (size_t i = 0; i < srgb_encode_table_size; ++i) {
+            const double l =
+                static_cast<double>(i) / static_cast<double>(srgb_encode_table_size - 1);
+            const double c = l <= 0.0031308 ? 12.92 * l : 1.055 * std::pow(l, 1.0 / 2.4) - 0.055;
+            t.encode[i] = static_cast<unsigned char>(std::lround(std::clamp(c, 0.0, 1.0) * 255.0));
+        }
+        return t;
+    }();
+    return tables;
+}
+
+// Clamps to [0, 1], mapping NaN to 0.
+inline float saturate(float v)
+{
+    return v > 0.f ? std::min(v, 1.f) : 0.f;
+}
+
+// Converts a row of 8-bit pixels with S channels into float pixels with D channels. Color
+// channels go through the decoding table if provided.
+template <int S, int D>
+void convert_row_u8_to_f32(const unsigned char* src, float* dst, size_t width, const float* lut)
+{
+    constexpr int num_copied = std::min(S, D);
+    constexpr int num_colors = std::min(num_copied, 3);
+    if (lut == nullptr && S == D) {
+        // Same layout, convert as a flat array of values
+        for (size_t k = 0; k < width * S; ++k) {
+            dst[k] = static_cast<float>(src[k]) / 255.f;
+        }
+    } else {
+        for (size_t i = 0; i < width; ++i) {
+            for (int c = 0; c < num_copied; ++c) {
+                const unsigned char v = src[i * S + c];
+                dst[i * D + c] = (lut && c < num_colors) ? lut[v] : static_cast<float>(v) / 255.f;
+            }
+        }
+    }
+    if constexpr (D == 4 && S < 4) {
+        for (size_t i = 0; i < width; ++i) dst[i * D + 3] = 1.f;
+    }
+}
+
+// Converts a row of float pixels with S channels into 8-bit pixels with D channels. Color
+// channels go through the encoding table if provided.
+template <int S, int D>
+void convert_row_f32_to_u8(
+    const float* src,
+    unsigned char* dst,
+    size_t width,
+    const unsigned char* lut)
+{
+    constexpr int num_copied = std::min(S, D);
+    constexpr int num_colors = std::min(num_copied, 3);
+    constexpr float lut_scale = static_cast<float>(srgb_encode_table_size - 1);
+    if (lut == nullptr && S == D) {
+        // Same layout, convert as a flat array of values
+        for (size_t k = 0; k < width * S; ++k) {
+            dst[k] = static_cast<unsigned char>(saturate(src[k]) * 255.f);
+        }
+    } else {
+        for (size_t i = 0; i < width; ++i) {
+            for (int c = 0; c < num_copied; ++c) {
+                const float v = saturate(src[i * S + c]);
+                dst[i * D + c] = (lut && c < num_colors)
+                                     ? lut[static_cast<size_t>(v * lut_scale + 0.5f)]
+                                     : static_cast<unsigned char>(v * 255.f);
+            }
+        }
+    }
+    if constexpr (D == 4 && S < 4) {
+        for (size_t i = 0; i < width; ++i) dst[i * D + 3] = 255;
+    }
+}
+
+template <typename S, typename T>
+void convert_row(const S* src, T* dst, size_t width, ColorTransfer transfer)
+{
+    using V_SRC = typename ImageTraits<S>::TValue;
+    using V_DST = typename ImageTraits<T>::TValue;
+    constexpr int L_SRC = static_cast<int>(ImageTraits<S>::channel);
+    constexpr int L_DST = static_cast<int>(ImageTraits<T>::channel);
+    const bool srgb = transfer == ColorTransfer::SRGB;
+    if constexpr (std::is_same_v<V_SRC, unsigned char> && std::is_same_v<V_DST, float>) {
+        convert_row_u8_to_f32<L_SRC, L_DST>(
+            reinterpret_cast<const unsigned char*>(src),
+            reinterpret_cast<float*>(dst),
+            width,
+            srgb ? srgb_tables().decode.data() : nullptr);
+    } else {
+        static_assert(std::is_same_v<V_SRC, float> && std::is_same_v<V_DST, unsigned char>);
+        convert_row_f32_to_u8<L_SRC, L_DST>(
+            reinterpret_cast<const float*>(src),
+            reinterpret_cast<unsigned char*>(dst),
+            width,
+            srgb ? srgb_tables().encode.data() : nullptr);
+    }
+}
+
+} // namespace
+
 std::shared_ptr<ImageStorage> image_storage_from_raw_input_image(const image::RawInputImage& image)
 {
     const size_t size_pixel = image.get_size_pixel();
@@ -72,5 +200,51 @@ image::RawInputImage raw_input_image_from_image_view(image::ImageViewBase& in, b
     return out;
 }
 
+template <typename S, typename T>
+bool convert_image(const ImageView<S>& src, ImageView<T>& dst, ColorTransfer transfer)
+{
+    using V_SRC = typename ImageTraits<S>::TValue;
+    using V_DST = typename ImageTraits<T>::TValue;
+    static_assert(sizeof(S) == sizeof(V_SRC) * ImageTraits<S>::value_size);
+    static_assert(sizeof(T) == sizeof(V_DST) * ImageTraits<T>::value_size);
+    if (src.get_view_size() != dst.get_view_size()) return false;
+    const size_t width = src.get_view_size()(0);
+    const size_t height = src.get_view_size()(1);
+    if (width == 0 || height == 0) return true;
+
+    // Initialize the tables before entering the parallel loop
+    if (transfer == ColorTransfer::SRGB) srgb_tables();
+
+    const bool compact = src.is_compact_row() && dst.is_compact_row();
+    tbb::parallel_for(size_t(0), height, [&](size_t y) {
+        if (compact) {
+            convert_row(&src(0, y), &dst(0, y), width, transfer);
+        } else {
+            for (size_t x = 0; x < width; ++x) {
+                convert_row(&src(x, y), &dst(x, y), 1, transfer);
+            }
+        }
+    });
+    return true;
+}
+
+#define LA_X_convert_image(S, T)                 \
+    template LA_IMAGE_API bool convert_image(    \
+        const ImageView<S>& src,                 \
+        ImageView<T>& dst,                       \
+        ColorTransfer transfer);                 \
+    template LA_IMAGE_API bool convert_image(    \
+        const ImageView<T>& src,                 \
+        ImageView<S>& dst,                       \
+        ColorTransfer transfer);
+using Pixel3u8 = Eigen::Matrix<unsigned char, 3, 1>;
+using Pixel4u8 = Eigen::Matrix<unsigned char, 4, 1>;
+LA_X_convert_image(unsigned char, float)
+LA_X_convert_image(Pixel3u8, Eigen::Vector3f)
+LA_X_convert_image(Pixel3u8, Eigen::Vector4f)
+LA_X_convert_image(Pixel4u8, Eigen::Vector3f)
+LA_X_convert_image(Pixel4u8, Eigen::Vector4f)
+#undef LA_X_convert_image
+
 } // namespace image
 } // namespace lagrange
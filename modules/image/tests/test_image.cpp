@@ -69,3 +69,83 @@ TEST_CASE("Half precision view", "[image]")
         float16_view->get_view_size()(1),
         float16_view->get_view_stride_in_byte()(1));
 }
+
+TEST_CASE("Image conversion into views", "[image]")
+{
+    using Pixel4u8 = Eigen::Matrix<unsigned char, 4, 1>;
+    const size_t width = 37, height = 11;
+    lagrange::image::ImageView<Pixel4u8> src(width, height, 1);
+    for (size_t y = 0; y < height; ++y) {
+        for (size_t x = 0; x < width; ++x) {
+            for (int c = 0; c < 4; ++c) {
+                src(x, y)(c) = static_cast<unsigned char>((x * 7 + y * 13 + c * 61) % 256);
+            }
+        }
+    }
+
+    SECTION("linear matches convert_from")
+    {
+        lagrange::image::ImageView<Eigen::Vector4f> expected;
+        expected.convert_from(src, 1);
+        lagrange::image::ImageView<Eigen::Vector4f> dst(width, height, 1);
+        REQUIRE(lagrange::image::convert_image(src, dst));
+        for (size_t y = 0; y < height; ++y) {
+            for (size_t x = 0; x < width; ++x) {
+                REQUIRE(dst(x, y) == expected(x, y));
+            }
+        }
+
+        lagrange::image::ImageView<Eigen::Matrix<unsigned char, 3, 1>> rgb(width, height, 1);
+        REQUIRE(lagrange::image::convert_image(dst, rgb));
+        for (size_t y = 0; y < height; ++y) {
+            for (size_t x = 0; x < width; ++x) {
+                REQUIRE(rgb(x, y) == src(x, y).head<3>());
+            }
+        }
+    }
+
+    SECTION("srgb round trip")
+    {
+        lagrange::image::ImageView<Eigen::Vector4f> linear(width, height, 1);
+        REQUIRE(
+            lagrange::image::convert_image(src, linear, lagrange::image::ColorTransfer::SRGB));
+        lagrange::image::ImageView<Pixel4u8> back(width, height, 1);
+        REQUIRE(
+            lagrange::image::convert_image(linear, back, lagrange::image::ColorTransfer::SRGB));
+        for (size_t y = 0; y < height; ++y) {
+            for (size_t x = 0; x < width; ++x) {
+                REQUIRE(back(x, y) == src(x, y));
+                // Alpha stays linear
+                REQUIRE(linear(x, y)(3) == static_cast<float>(src(x, y)(3)) / 255.f);
+            }
+        }
+    }
+
+    SECTION("write into a sub-region")
+    {
+        lagrange::image::ImageView<Eigen::Vector4f> canvas(width + 4, height + 2, 1);
+        canvas.clear(Eigen::Vector4f::Constant(-1.f));
+        lagrange::image::ImageView<Eigen::Vector4f> region(
+            canvas.get_storage(),
+            width,
+            height,
+            sizeof(Eigen::Vector4f),
+            1,
+            2 * sizeof(Eigen::Vector4f),
+            1);
+        REQUIRE(lagrange::image::convert_image(src, region));
+        for (size_t y = 0; y < height + 2; ++y) {
+            for (size_t x = 0; x < width + 4; ++x) {
+                const bool inside = x >= 2 && x < width + 2 && y >= 1 && y < height + 1;
+                if (inside) {
+                    REQUIRE(canvas(x, y)(0) == static_cast<float>(src(x - 2, y - 1)(0)) / 255.f);
+                } else {
+                    REQUIRE(canvas(x, y)(0) == -1.f);
+                }
+            }
+        }
+
+        lagrange::image::ImageView<Eigen::Vector4f> wrong_size(width, height + 1, 1);
+        REQUIRE(!lagrange::image::convert_image(src, wrong_size));
+    }
+}
@@ -0,0 +1,153 @@
+/*
+ * Copyright 2025 Adobe. All rights reserved.
+ * This file is licensed to you under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License. You may obtain a copy
+ * of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR REPRESENTATIONS
+ * OF ANY KIND, either express or implied. See the License for the specific language
+ * governing permissions and limitations under the License.
+ */
+#include <lagrange/image/image_filters.h>
+#include <lagrange/utils/range.h>
+
+#include <lagrange/testing/common.h>
+
+#include <random>
+
+namespace {
+
+using lagrange::image::ImageView;
+
+ImageView<float> make_random_image(size_t width, size_t height)
+{
+    ImageView<float> image(width, height, 1);
+    std::mt19937 gen(0);
+    std::uniform_real_distribution<float> dist(-1.f, 1.f);
+    for (auto j : lagrange::range(height)) {
+        for (auto i : lagrange::range(width)) {
+            image(i, j) = dist(gen);
+        }
+    }
+    return image;
+}
+
+// Direct evaluation of the convolution, with the same boundary conditions as convolve().
+ImageView<float> convolve_reference(const ImageView<float>& image, const ImageView<float>& kernel)
+{
+    const int width = (int)image.get_view_size()[0];
+    const int height = (int)image.get_view_size()[1];
+    const int kernel_width = (int)kernel.get_view_size()[0];
+    const int kernel_height = (int)kernel.get_view_size()[1];
+    auto reflect = [](int index, int size) {
+        if (index < 0) index = -index;
+        if (index >= size) index = (size - 1) + (size - index);
+        return index;
+    };
+
+    ImageView<float> result(width, height, 1);
+    for (int j = 0; j < height; ++j) {
+        for (int i = 0; i < width; ++i) {
+            double sum = 0;
+            for (int kh = 0; kh < kernel_height; ++kh) {
+                int h_index = reflect(j + kh - kernel_height / 2, height);
+                for (int kw = 0; kw < kernel_width; ++kw) {
+                    int w_index = reflect(i + kw - kernel_width / 2, width);
+                    sum += kernel(kw, kh) * image(w_index, h_index);
+                }
+            }
+            result(i, j) = (float)std::abs(sum);
+        }
+    }
+    return result;
+}
+
+float max_difference(const ImageView<float>& a, const ImageView<float>& b)
+{
+    REQUIRE(a.get_view_size() == b.get_view_size());
+    float diff = 0;
+    for (auto j : lagrange::range(a.get_view_size()[1])) {
+        for (auto i : lagrange::range(a.get_view_size()[0])) {
+            diff = std::max(diff, std::abs(a(i, j) - b(i, j)));
+        }
+    }
+    return diff;
+}
+
+} // namespace
+
+TEST_CASE("convolve", "[image]")
+{
+    using namespace lagrange;
+
+    auto image = make_random_image(67, 45);
+    ImageView<float> kernel;
+
+    SECTION("Box kernel")
+    {
+        image::make_box_kernel(5, kernel);
+    }
+    SECTION("Even box kernel")
+    {
+        image::make_box_kernel(4, kernel);
+    }
+    SECTION("Separable kernel")
+    {
+        image::make_gaussian_kernel(kernel);
+    }
+    SECTION("Horizontal kernel")
+    {
+        image::make_diff_xkernel(kernel);
+    }
+    SECTION("Vertical kernel")
+    {
+        image::make_weighted_avg_ykernel(kernel);
+    }
+    SECTION("Non-separable kernel")
+    {
+        kernel.resize(3, 2, 1);
+        kernel(0, 0) = 1.f;
+        kernel(1, 0) = -2.f;
+        kernel(2, 0) = 0.5f;
+        kernel(0, 1) = 0.25f;
+        kernel(1, 1) = 1.f;
+        kernel(2, 1) = -1.f;
+    }
+
+    auto expected = convolve_reference(image, kernel);
+    ImageView<float> result;
+    image::convolve(image, kernel, result);
+    CHECK(max_difference(result, expected) < 1e-5f);
+
+    // In-place convolution
+    image::convolve(image, kernel, image);
+    CHECK(max_difference(image, expected) < 1e-5f);
+}
+
+TEST_CASE("convolve benchmark", "[image][!benchmark]")
+{
+    using namespace lagrange;
+
+    auto image = make_random_image(4096, 4096);
+    ImageView<float> result;
+
+    ImageView<float> gaussian_kernel;
+    image::make_gaussian_kernel(gaussian_kernel);
+    BENCHMARK("gaussian 3x3")
+    {
+        image::convolve(image, gaussian_kernel, result);
+    };
+
+    ImageView<float> box_kernel;
+    image::make_box_kernel(15, box_kernel);
+    BENCHMARK("box 15x15")
+    {
+        image::convolve(image, box_kernel, result);
+    };
+
+    BENCHMARK("sobel_x")
+    {
+        image::sobel_x(image, result);
+    };
+}
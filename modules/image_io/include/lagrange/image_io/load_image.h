@@ -14,6 +14,7 @@
 #include <lagrange/fs/filesystem.h>
 #include <lagrange/image/ImageView.h>
 #include <lagrange/image_io/api.h>
+#include <lagrange/utils/span.h>
 
 // clang-format off
 #include <lagrange/utils/warnoff.h>
@@ -21,6 +22,8 @@
 #include <lagrange/utils/warnon.h>
 // clang-format on
 
+#include <vector>
+
 namespace lagrange {
 namespace image_io {
 
@@ -38,6 +41,13 @@ struct LoadImageResult
 LA_IMAGE_IO_API LoadImageResult
 load_image(const fs::path& path, spdlog::level::level_enum error_lvl = spdlog::level::err);
 
+// Load images concurrently on the TBB pool, one task per file. Decoding a file is sequential, but
+// exr files then split their channel interleaving into nested TBB loops, which share the same pool
+// as the outer per-file tasks. Results are returned in the order of the input paths.
+LA_IMAGE_IO_API std::vector<LoadImageResult> load_images(
+    span<const fs::path> paths,
+    spdlog::level::level_enum error_lvl = spdlog::level::err);
+
 // Load png or jpg image using stb library. Produces uint8 data.
 LA_IMAGE_IO_API LoadImageResult
 load_image_stb(const fs::path& path, spdlog::level::level_enum error_lvl = spdlog::level::err);
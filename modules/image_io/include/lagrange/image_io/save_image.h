@@ -14,6 +14,7 @@
 #include <lagrange/fs/filesystem.h>
 #include <lagrange/image/ImageView.h>
 #include <lagrange/image_io/api.h>
+#include <lagrange/utils/span.h>
 
 namespace lagrange {
 namespace image_io {
@@ -27,6 +28,22 @@ LA_IMAGE_IO_API bool save_image(
     image::ImagePrecision precision,
     image::ImageChannel channel);
 
+// Image to save with save_images. The data must stay alive until save_images returns.
+struct SaveImageRequest
+{
+    fs::path path;
+    const unsigned char* data = nullptr;
+    size_t width = 0;
+    size_t height = 0;
+    image::ImagePrecision precision = image::ImagePrecision::unknown;
+    image::ImageChannel channel = image::ImageChannel::unknown;
+};
+
+// Save images concurrently on the TBB pool, one task per file. Exr files split their channels in
+// nested TBB loops, which share the same pool as the outer per-file tasks, before being encoded
+// sequentially. Returns true if all images were saved successfully.
+LA_IMAGE_IO_API bool save_images(span<const SaveImageRequest> requests);
+
 // Save image using stb. Supports png or jpeg. Only supports uint8 data.
 LA_IMAGE_IO_API bool save_image_stb(
     const fs::path& path,
@@ -14,6 +14,8 @@
 
 #include <tinyexr.h>
 
+#include <tbb/parallel_for.h>
+
 #include <cstring>
 #include <iostream>
 #include <sstream>
@@ -167,7 +169,8 @@ int LoadEXR(
     }
     const int gray_or_rgb_ch = (exr_header.num_channels > 3 ? 3 : exr_header.num_channels);
     if (exr_header.tiled) {
-        for (int it = 0; it < exr_image.num_tiles; it++) {
+        // Tiles cover disjoint pixels, so they can be interleaved concurrently
+        tbb::parallel_for(0, exr_image.num_tiles, [&](int it) {
             for (int j = 0; j < exr_header.tile_size_y; j++) {
                 for (int i = 0; i < exr_header.tile_size_x; i++) {
                     const int ii = exr_image.tiles[it].offset_x * exr_header.tile_size_x + i;
@@ -201,9 +204,9 @@ int LoadEXR(
                     }
                 }
             }
-        }
+        });
     } else {
-        for (int i = 0; i < exr_image.width * exr_image.height; i++) {
+        tbb::parallel_for(0, exr_image.width * exr_image.height, [&](int i) {
             for (int ch = 0; ch < gray_or_rgb_ch; ++ch) {
                 data_uint[i * exr_header.num_channels + ch] =
                     reinterpret_cast<unsigned int**>(exr_image.images)[channel_slots[ch]][i];
@@ -220,7 +223,7 @@ int LoadEXR(
                         reinterpret_cast<unsigned int**>(exr_image.images)[idxA][i];
                 }
             }
-        }
+        });
     }
 
     (*width) = exr_image.width;
@@ -292,7 +295,7 @@ int SaveEXR(
         images[3].resize(static_cast<size_t>(width * height));
 
         // Split RGB(A)RGB(A)RGB(A)... into R, G and B(and A) layers
-        for (size_t i = 0; i < static_cast<size_t>(width * height); i++) {
+        tbb::parallel_for(size_t(0), static_cast<size_t>(width * height), [&](size_t i) {
             images[0][i] =
                 (static_cast<const unsigned int*>(data))[static_cast<size_t>(components) * i + 0];
             images[1][i] =
@@ -303,7 +306,7 @@ int SaveEXR(
                 images[3][i] = (static_cast<const unsigned int*>(
                     data))[static_cast<size_t>(components) * i + 3];
             }
-        }
+        });
     }
 
     unsigned int* image_ptr[4] = {0, 0, 0, 0};
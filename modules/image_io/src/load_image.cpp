@@ -19,6 +19,8 @@
 
 #include <stb_image.h>
 
+#include <tbb/parallel_for.h>
+
 namespace lagrange {
 namespace image_io {
 
@@ -60,6 +62,17 @@ LoadImageResult load_image(const fs::path& path, spdlog::level::level_enum error
     }
 }
 
+std::vector<LoadImageResult> load_images(
+    span<const fs::path> paths,
+    spdlog::level::level_enum error_lvl)
+{
+    std::vector<LoadImageResult> results(paths.size());
+    tbb::parallel_for(size_t(0), paths.size(), [&](size_t i) {
+        results[i] = load_image(paths[i], error_lvl);
+    });
+    return results;
+}
+
 LoadImageResult load_image_stb(const fs::path& path, spdlog::level::level_enum error_lvl)
 {
     LA_IGNORE(error_lvl);
@@ -17,6 +17,10 @@
 
 #include <stb_image_write.h>
 
+#include <tbb/parallel_for.h>
+
+#include <atomic>
+
 #include <fstream>
 
 namespace lagrange {
@@ -100,6 +104,24 @@ bool save_image(
     return true;
 };
 
+bool save_images(span<const SaveImageRequest> requests)
+{
+    std::atomic<bool> success = true;
+    tbb::parallel_for(size_t(0), requests.size(), [&](size_t i) {
+        const SaveImageRequest& request = requests[i];
+        if (!save_image(
+                request.path,
+                request.data,
+                request.width,
+                request.height,
+                request.precision,
+                request.channel)) {
+            success = false;
+        }
+    });
+    return success;
+}
+
 bool save_image_stb(
     const fs::path& path,
     const unsigned char* data,
@@ -16,8 +16,10 @@
 #include <lagrange/image_io/load_image.h>
 #include <lagrange/image_io/save_image.h>
 
+#include <algorithm>
 #include <array>
 #include <cstdio>
+#include <vector>
 
 constexpr int test_image_width = 509;
 constexpr int test_image_height = 184;
@@ -136,3 +138,59 @@ TEST_CASE("Exr IO", "[image_io]")
 
     std::remove(tmp_file.string().c_str());
 }
+
+TEST_CASE("load images", "[image_io]")
+{
+    std::vector<lagrange::fs::path> paths = {
+        lagrange::testing::get_data_path("open/image_io/example.png"),
+        lagrange::testing::get_data_path("open/image_io/example.jpg"),
+        lagrange::testing::get_data_path("open/image_io/example.exr"),
+    };
+    auto images = lagrange::image_io::load_images(paths);
+    REQUIRE(images.size() == paths.size());
+    for (size_t i = 0; i < paths.size(); i++) {
+        check_example_image(images[i]);
+        auto image = lagrange::image_io::load_image(paths[i]);
+        REQUIRE(images[i].channel == image.channel);
+        REQUIRE(images[i].precision == image.precision);
+        const size_t num_bytes =
+            image.storage->get_full_size().x() * image.storage->get_full_size().y();
+        REQUIRE(std::equal(
+            image.storage->data(),
+            image.storage->data() + num_bytes,
+            images[i].storage->data()));
+    }
+}
+
+TEST_CASE("save images", "[image_io]")
+{
+    constexpr size_t num_images = 4;
+    const size_t width = 8, height = 4;
+    std::vector<std::vector<float>> colors(num_images);
+    std::vector<lagrange::image_io::SaveImageRequest> requests(num_images);
+    for (size_t k = 0; k < num_images; k++) {
+        colors[k].resize(width * height);
+        for (size_t i = 0; i < width * height; i++) {
+            colors[k][i] = float(k * width * height + i);
+        }
+        requests[k].path = fmt::format("image_io_batch_{}.exr", k);
+        requests[k].data = reinterpret_cast<const unsigned char*>(colors[k].data());
+        requests[k].width = width;
+        requests[k].height = height;
+        requests[k].precision = lagrange::image::ImagePrecision::float32;
+        requests[k].channel = lagrange::image::ImageChannel::one;
+    }
+    REQUIRE(lagrange::image_io::save_images(requests));
+
+    std::vector<lagrange::fs::path> paths;
+    for (const auto& request : requests) paths.push_back(request.path);
+    auto images = lagrange::image_io::load_images(paths);
+    for (size_t k = 0; k < num_images; k++) {
+        REQUIRE(images[k].valid);
+        const float* data = reinterpret_cast<const float*>(images[k].storage->data());
+        for (size_t i = 0; i < width * height; i++) {
+            REQUIRE(data[i] == colors[k][i]);
+        }
+        std::remove(paths[k].string().c_str());
+    }
+}
@@ -15,6 +15,10 @@
 #include <lagrange/utils/warnoff.h>
 #include <RectangleBinPack/GuillotineBinPack.h>
 #include <RectangleBinPack/Rect.h>
+#ifdef RECTANGLE_BIN_PACK_OSS
+#include <RectangleBinPack/MaxRectsBinPack.h>
+#include <RectangleBinPack/SkylineBinPack.h>
+#endif
 #include <lagrange/utils/warnon.h>
 // clang-format on
 
@@ -25,8 +29,13 @@
 
 #include <Eigen/Core>
 
+#include <tbb/parallel_for.h>
+
+#include <algorithm>
+#include <cstdint>
 #include <exception>
 #include <limits>
+#include <numeric>
 #include <string>
 #include <tuple>
 #include <type_traits>
@@ -71,9 +80,32 @@ public:
     {}
 };
 
+///
+/// Strategies tried concurrently by pack_boxes for each candidate canvas size.
+///
+enum class PackingStrategy {
+    /// Guillotine packer, boxes inserted in input order (best area fit).
+    GuillotineInputOrder,
+
+    /// Guillotine packer, boxes inserted by decreasing size (best short side fit).
+    GuillotineSorted,
+
+    /// MaxRects packer, boxes inserted by decreasing size (best short side fit).
+    MaxRectsSorted,
+
+    /// Skyline packer, boxes inserted by decreasing size (min waste fit). Much faster than the
+    /// other strategies on large inputs.
+    SkylineSorted,
+};
+
 ///
 /// Pack boxes into a square canvas.
 ///
+/// The smallest canvas size is found by a speculative search: each round evaluates several
+/// candidate sizes with several packing strategies concurrently, and narrows the search interval
+/// to the smallest candidate that fits. The result only depends on the input, not on the number
+/// of threads.
+///
 /// @param[in] bbox_mins  The minimum coordinates of the boxes.
 /// @param[in] bbox_maxs  The maximum coordinates of the boxes.
 /// @param[in] allow_rotation  Whether to allow box to rotate by 90 degree when packing.
@@ -116,9 +148,12 @@ pack_boxes(
     Int min_canvas_size = RESOLUTION;
 
     // The scale factor normalizes the boxes such that the largest box fits into a
-    // canvas of size max_canvas_size.
-    const Scalar scale =
-        max_box_length > safe_cast<Scalar>(1e-12) ? max_box_length / max_canvas_size : 1;
+    // canvas of size max_canvas_size. With many boxes, it is increased so that their total area
+    // fits into a few times that canvas: otherwise the required canvas could exceed the integer
+    // range of the packer.
+    const Scalar total_area = (bbox_maxs - bbox_mins).cwiseMax(0).rowwise().prod().sum();
+    const Scalar max_length = std::max(max_box_length, std::sqrt(total_area) / 4);
+    const Scalar scale = max_length > safe_cast<Scalar>(1e-12) ? max_length / max_canvas_size : 1;
     la_runtime_assert(std::isfinite(scale));
     logger().trace("Scale: {}", scale);
     la_debug_assert(product_will_overflow<Int>(2, MAX_AREA));
@@ -140,80 +175,205 @@ pack_boxes(
         }
     }
 
-    Eigen::Matrix<Scalar, Eigen::Dynamic, 2, Eigen::RowMajor> centers(num_boxes, 2);
-    std::vector<bool> rotated(num_boxes);
+    // Insertion order of the sorted strategies: decreasing longest side, then decreasing
+    // shortest side.
+    std::vector<Eigen::Index> sorted_order(num_boxes);
+    std::iota(sorted_order.begin(), sorted_order.end(), Eigen::Index(0));
+    std::stable_sort(sorted_order.begin(), sorted_order.end(), [&](auto i, auto j) {
+        const auto& a = boxes[i];
+        const auto& b = boxes[j];
+        return std::make_pair(std::max(a.width, a.height), std::min(a.width, a.height)) >
+               std::make_pair(std::max(b.width, b.height), std::min(b.width, b.height));
+    });
 
-    auto pack = [&](int L, bool trial) -> bool {
-        la_debug_assert(!product_will_overflow<Int>(L, L));
+    // Strategies to try, in order of preference when several of them fit the same canvas. Since
+    // all trials of a round run concurrently, slow strategies are skipped on large inputs.
+    std::vector<PackingStrategy> strategies;
 #ifdef RECTANGLE_BIN_PACK_OSS
-        if (!allow_rotation) {
-            logger().warn(
-                "Disabling rotation is not supported with this version of RectangleBinPack!");
-        }
-        rbp::GuillotineBinPack packer(L, L);
+    if (!allow_rotation) {
+        logger().warn("Disabling rotation is not supported with this version of RectangleBinPack!");
+    }
+    constexpr Eigen::Index MAX_NUM_BOXES_MAXRECTS = 1000;
+    constexpr Eigen::Index MAX_NUM_BOXES_GUILLOTINE = 5000;
+    if (num_boxes < MAX_NUM_BOXES_GUILLOTINE) {
+        strategies.push_back(PackingStrategy::GuillotineInputOrder);
+        strategies.push_back(PackingStrategy::GuillotineSorted);
+    }
+    if (num_boxes < MAX_NUM_BOXES_MAXRECTS) {
+        strategies.push_back(PackingStrategy::MaxRectsSorted);
+    } else {
+        strategies.push_back(PackingStrategy::SkylineSorted);
+    }
 #else
-        rbp::GuillotineBinPack packer(L, L, allow_rotation);
+    strategies = {PackingStrategy::GuillotineInputOrder, PackingStrategy::GuillotineSorted};
 #endif
+    const size_t num_strategies = strategies.size();
+
+    // Packs all boxes into a canvas of size L, storing the placement of each box (including its
+    // margin) in `rects`. Returns false if some box does not fit.
+    auto pack = [&](Int L, PackingStrategy strategy, std::vector<::rbp::Rect>& rects) -> bool {
+        la_debug_assert(!product_will_overflow<Int>(L, L));
         Int int_margin = std::max<Int>(2, static_cast<Int>(std::ceil(margin * L)));
-        for (auto i : range(num_boxes)) {
-            auto rect = packer.Insert(
-                boxes[i].width + int_margin,
-                boxes[i].height + int_margin,
-                false, // Perform empty space merging for defragmentation.
-                rbp::GuillotineBinPack::FreeRectChoiceHeuristic::RectBestAreaFit,
-                rbp::GuillotineBinPack::GuillotineSplitHeuristic::SplitMinimizeArea);
-            if (rect.width == 0 || rect.height == 0) {
-                return false;
+        rects.resize(num_boxes);
+
+        auto insert_all = [&](auto&& insert) -> bool {
+            for (auto k : range(num_boxes)) {
+                const Eigen::Index i =
+                    strategy == PackingStrategy::GuillotineInputOrder ? k : sorted_order[k];
+                rects[i] = insert(boxes[i].width + int_margin, boxes[i].height + int_margin);
+                if (rects[i].width == 0 || rects[i].height == 0) {
+                    return false;
+                }
             }
+            return true;
+        };
+
+        switch (strategy) {
+#ifdef RECTANGLE_BIN_PACK_OSS
+        case PackingStrategy::MaxRectsSorted: {
+            rbp::MaxRectsBinPack packer(L, L);
+            return insert_all([&](Int w, Int h) {
+                return packer.Insert(w, h, rbp::MaxRectsBinPack::RectBestShortSideFit);
+            });
+        }
+        case PackingStrategy::SkylineSorted: {
+            rbp::SkylineBinPack packer(L, L, true);
+            return insert_all([&](Int w, Int h) {
+                return packer.Insert(w, h, rbp::SkylineBinPack::LevelMinWasteFit);
+            });
+        }
+#endif
+        case PackingStrategy::GuillotineSorted: {
+#ifdef RECTANGLE_BIN_PACK_OSS
+            rbp::GuillotineBinPack packer(L, L);
+#else
+            rbp::GuillotineBinPack packer(L, L, allow_rotation);
+#endif
+            return insert_all([&](Int w, Int h) {
+                return packer.Insert(
+                    w,
+                    h,
+                    false,
+                    rbp::GuillotineBinPack::FreeRectChoiceHeuristic::RectBestShortSideFit,
+                    rbp::GuillotineBinPack::GuillotineSplitHeuristic::SplitShorterLeftoverAxis);
+            });
+        }
+        default: {
+#ifdef RECTANGLE_BIN_PACK_OSS
+            rbp::GuillotineBinPack packer(L, L);
+#else
+            rbp::GuillotineBinPack packer(L, L, allow_rotation);
+#endif
+            return insert_all([&](Int w, Int h) {
+                return packer.Insert(
+                    w,
+                    h,
+                    false, // Perform empty space merging for defragmentation.
+                    rbp::GuillotineBinPack::FreeRectChoiceHeuristic::RectBestAreaFit,
+                    rbp::GuillotineBinPack::GuillotineSplitHeuristic::SplitMinimizeArea);
+            });
         }
-        const auto& packed_rect = packer.GetUsedRectangles();
-        logger().debug("num packed rectangles {}, expecting {}", packed_rect.size(), num_boxes);
-        if (static_cast<decltype(num_boxes)>(packed_rect.size()) != num_boxes) return false;
-
-        if (!trial) {
-            for (auto i : range(num_boxes)) {
-                const auto& r = packed_rect[i];
-                rotated[i] = r.width != boxes[i].width + int_margin;
-                la_debug_assert(allow_rotation || !rotated[i]);
-                centers(i, 0) = (r.x + r.width * 0.5f) * scale;
-                centers(i, 1) = (r.y + r.height * 0.5f) * scale;
+        }
+    };
+
+    // Evaluates all strategies on a batch of candidate canvas sizes concurrently. Returns the
+    // index of the smallest candidate that fits with at least one strategy, or the number of
+    // candidates if none fits. Candidates must be sorted in increasing order.
+    auto pack_candidates = [&](const std::vector<Int>& candidates) -> size_t {
+        const size_t num_trials = candidates.size() * num_strategies;
+        std::vector<uint8_t> fits(num_trials, 0);
+        tbb::parallel_for(size_t(0), num_trials, [&](size_t t) {
+            std::vector<::rbp::Rect> rects;
+            fits[t] = pack(candidates[t / num_strategies], strategies[t % num_strategies], rects);
+        });
+        for (size_t c = 0; c < candidates.size(); ++c) {
+            for (size_t s = 0; s < num_strategies; ++s) {
+                if (fits[c * num_strategies + s]) return c;
             }
         }
-        return true;
+        return candidates.size();
     };
 
+    // Number of candidate canvas sizes evaluated per round. This is fixed so that the result does
+    // not depend on the number of threads.
+    constexpr size_t NUM_CANDIDATES = 8;
+    std::vector<Int> candidates;
+    candidates.reserve(NUM_CANDIDATES);
+
     logger().trace("Minimum canvas size: {}", min_canvas_size);
     logger().trace("Maximum canvas size: {}", max_canvas_size);
-    // Find max_canvas_size large enough to fit all boxes.
-    while (!pack(max_canvas_size, true)) {
-        min_canvas_size = max_canvas_size;
-        max_canvas_size *= 2;
-        if (MAX_AREA / max_canvas_size <= max_canvas_size) {
+    // Find max_canvas_size large enough to fit all boxes, trying several doublings at once.
+    for (bool found = false; !found;) {
+        candidates.clear();
+        for (Int L = max_canvas_size; candidates.size() < NUM_CANDIDATES; L *= 2) {
+            if (MAX_AREA / L <= L) break;
+            candidates.push_back(L);
+        }
+        if (candidates.empty()) {
             // Ops, run out of bound.
             throw PackingFailure("Cannot pack even with canvas at max area!");
         }
+        const size_t c = pack_candidates(candidates);
+        if (c < candidates.size()) {
+            max_canvas_size = candidates[c];
+            min_canvas_size = c > 0 ? candidates[c - 1] : min_canvas_size;
+            found = true;
+        } else {
+            min_canvas_size = candidates.back();
+            max_canvas_size = candidates.back() * 2;
+        }
     }
     logger().trace("Minimum canvas size: {}", min_canvas_size);
     logger().trace("Maximum canvas size: {}", max_canvas_size);
     la_runtime_assert(max_canvas_size > 0);
-    // Binary search for the smallest max_canvas_size that fits.
-    while (min_canvas_size < max_canvas_size) {
-        const auto l = (min_canvas_size + max_canvas_size) / 2;
-        if (l == min_canvas_size) {
-            break;
+    // Search for the smallest max_canvas_size that fits, splitting the interval into several
+    // candidates per round.
+    while (max_canvas_size - min_canvas_size > 1) {
+        candidates.clear();
+        const Int gap = max_canvas_size - min_canvas_size;
+        for (size_t k = 1; k <= NUM_CANDIDATES; ++k) {
+            const Int L = min_canvas_size +
+                          static_cast<Int>((static_cast<int64_t>(gap) * k) / (NUM_CANDIDATES + 1));
+            if (L > min_canvas_size && L < max_canvas_size &&
+                (candidates.empty() || L > candidates.back())) {
+                candidates.push_back(L);
+            }
         }
-        if (pack(l, true)) {
-            max_canvas_size = l;
-        } else {
-            min_canvas_size = l;
+        if (candidates.empty()) break;
+        const size_t c = pack_candidates(candidates);
+        if (c < candidates.size()) {
+            max_canvas_size = candidates[c];
+        }
+        if (c > 0) {
+            min_canvas_size = candidates[c - 1];
         }
     }
     la_runtime_assert(max_canvas_size > 0);
-    bool r = pack(max_canvas_size, false);
+
+    // Use the first strategy (in order of preference) that fits the final canvas.
+    std::vector<::rbp::Rect> rects;
+    Int int_margin = std::max<Int>(2, static_cast<Int>(std::ceil(margin * max_canvas_size)));
+    bool r = false;
+    for (auto strategy : strategies) {
+        if (pack(max_canvas_size, strategy, rects)) {
+            r = true;
+            break;
+        }
+    }
     la_runtime_assert(r);
     logger().trace("Minimum canvas size: {}", min_canvas_size);
     logger().trace("Maximum canvas size: {}", max_canvas_size);
 
+    Eigen::Matrix<Scalar, Eigen::Dynamic, 2, Eigen::RowMajor> centers(num_boxes, 2);
+    std::vector<bool> rotated(num_boxes);
+    for (auto i : range(num_boxes)) {
+        const auto& rect = rects[i];
+        rotated[i] = rect.width != boxes[i].width + int_margin;
+        la_debug_assert(allow_rotation || !rotated[i]);
+        centers(i, 0) = (rect.x + rect.width * 0.5f) * scale;
+        centers(i, 1) = (rect.y + rect.height * 0.5f) * scale;
+    }
+
     return std::make_tuple(centers, rotated, static_cast<Scalar>(max_canvas_size) * scale);
 }
 
@@ -0,0 +1,126 @@
+/*
+ * Copyright 2025 Adobe. All rights reserved.
+ * This file is licensed to you under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License. You may obtain a copy
+ * of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR REPRESENTATIONS
+ * OF ANY KIND, either express or implied. See the License for the specific language
+ * governing permissions and limitations under the License.
+ */
+#include <lagrange/IndexedAttribute.h>
+#include <lagrange/Logger.h>
+#include <lagrange/packing/repack_uv_charts.h>
+#include <lagrange/testing/common.h>
+#include <lagrange/views.h>
+
+#include <Eigen/Geometry>
+
+#include <random>
+#include <vector>
+
+namespace {
+
+using Scalar = double;
+using Index = uint32_t;
+using Box = Eigen::AlignedBox<Scalar, 2>;
+
+// Creates a mesh made of disjoint quads, each one being its own UV chart with a random size.
+lagrange::SurfaceMesh<Scalar, Index> create_quad_charts(Index num_charts)
+{
+    lagrange::SurfaceMesh<Scalar, Index> mesh;
+    std::mt19937 gen(0);
+    std::uniform_real_distribution<Scalar> size(0.05, 1.0);
+
+    std::vector<Scalar> uv_values;
+    std::vector<Index> uv_indices;
+    for (Index c = 0; c < num_charts; ++c) {
+        const Scalar w = size(gen);
+        const Scalar h = size(gen);
+        const Scalar x = static_cast<Scalar>(c);
+        mesh.add_vertex({x, 0, 0});
+        mesh.add_vertex({x + w, 0, 0});
+        mesh.add_vertex({x + w, h, 0});
+        mesh.add_vertex({x, h, 0});
+        mesh.add_quad(4 * c, 4 * c + 1, 4 * c + 2, 4 * c + 3);
+        uv_values.insert(uv_values.end(), {0, 0, w, 0, w, h, 0, h});
+        uv_indices.insert(uv_indices.end(), {4 * c, 4 * c + 1, 4 * c + 2, 4 * c + 3});
+    }
+    mesh.template create_attribute<Scalar>(
+        "uv",
+        lagrange::AttributeElement::Indexed,
+        lagrange::AttributeUsage::UV,
+        2,
+        {uv_values.data(), uv_values.size()},
+        {uv_indices.data(), uv_indices.size()});
+    return mesh;
+}
+
+std::vector<Box> get_chart_boxes(const lagrange::SurfaceMesh<Scalar, Index>& mesh)
+{
+    const auto& uv_attr = mesh.template get_indexed_attribute<Scalar>("uv");
+    auto uv_values = lagrange::matrix_view(uv_attr.values());
+    std::vector<Box> boxes(mesh.get_num_facets());
+    for (Index c = 0; c < mesh.get_num_facets(); ++c) {
+        for (Index k = 0; k < 4; ++k) {
+            boxes[c].extend(uv_values.row(4 * c + k).transpose());
+        }
+    }
+    return boxes;
+}
+
+} // namespace
+
+TEST_CASE("repack_uv_charts", "[packing]")
+{
+    using namespace lagrange;
+
+    for (Index num_charts : {Index(1), Index(20), Index(200)}) {
+        auto mesh = create_quad_charts(num_charts);
+        packing::repack_uv_charts(mesh);
+
+        auto boxes = get_chart_boxes(mesh);
+        Box domain(Eigen::Matrix<Scalar, 2, 1>::Zero(), Eigen::Matrix<Scalar, 2, 1>::Ones());
+        for (Index i = 0; i < num_charts; ++i) {
+            REQUIRE(domain.contains(boxes[i]));
+            for (Index j = i + 1; j < num_charts; ++j) {
+                REQUIRE(boxes[i].intersection(boxes[j]).isEmpty());
+            }
+        }
+    }
+}
+
+TEST_CASE("repack_uv_charts benchmark", "[packing][!benchmark]")
+{
+    using namespace lagrange;
+
+    for (Index num_charts : {Index(1000), Index(10000), Index(50000)}) {
+        auto mesh = create_quad_charts(num_charts);
+
+        // Packing efficiency: ratio between the area covered by the charts and the area of the
+        // bounding square of the packed charts.
+        {
+            auto packed_mesh = mesh;
+            packing::repack_uv_charts(packed_mesh);
+            Box extent;
+            Scalar chart_area = 0;
+            for (const auto& box : get_chart_boxes(packed_mesh)) {
+                chart_area += box.volume();
+                extent.extend(box);
+            }
+            const Scalar side = extent.sizes().maxCoeff();
+            logger().info(
+                "repack_uv_charts: {} charts, efficiency {:.3f}",
+                num_charts,
+                chart_area / (side * side));
+        }
+
+        BENCHMARK_ADVANCED(fmt::format("repack_uv_charts {}", num_charts))
+        (Catch::Benchmark::Chronometer meter)
+        {
+            std::vector<SurfaceMesh<Scalar, Index>> meshes(meter.runs(), mesh);
+            meter.measure([&](int i) { packing::repack_uv_charts(meshes[i]); });
+        };
+    }
+}
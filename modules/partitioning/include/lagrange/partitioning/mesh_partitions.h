@@ -0,0 +1,168 @@
+/*
+ * Copyright 2025 Adobe. All rights reserved.
+ * This file is licensed to you under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License. You may obtain a copy
+ * of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR REPRESENTATIONS
+ * OF ANY KIND, either express or implied. See the License for the specific language
+ * governing permissions and limitations under the License.
+ */
+////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <lagrange/partitioning/api.h>
+
+#include <lagrange/SurfaceMesh.h>
+#include <lagrange/reorder_mesh.h>
+#include <lagrange/utils/function_ref.h>
+#include <lagrange/utils/span.h>
+
+#include <string>
+#include <vector>
+////////////////////////////////////////////////////////////////////////////////
+
+namespace lagrange {
+namespace partitioning {
+
+///
+/// Method used to split mesh facets into partitions.
+///
+enum class PartitionMethod {
+    /// Sort facet centroids along a space-filling curve (see reorder_mesh), and split the sorted
+    /// sequence into contiguous chunks of equal size.
+    Spatial,
+
+    /// Partition the facet dual graph with METIS (see partition_mesh_facets). Slower, but produces
+    /// shorter partition boundaries, hence smaller halos.
+    Graph,
+};
+
+///
+/// Option struct for extract_mesh_partitions and for_each_mesh_partition.
+///
+struct MeshPartitionOptions
+{
+    /// Number of partitions. If 0, it is derived from the number of facets and
+    /// target_partition_size. The number of partitions is clamped to the number of facets.
+    size_t num_partitions = 0;
+
+    /// Target number of owned facets per partition, used when num_partitions is 0. The default
+    /// partitioning only depends on the mesh, not on the number of worker threads.
+    size_t target_partition_size = 4096;
+
+    /// Partitioning method.
+    PartitionMethod method = PartitionMethod::Spatial;
+
+    /// Space-filling curve used by the spatial partitioning method. Must be Morton or Hilbert.
+    ReorderingMethod ordering = ReorderingMethod::Morton;
+
+    /// Number of facet rings added around each partition. One ring covers every facet incident to
+    /// a vertex of the partition, which is enough for per-vertex quantities such as normals.
+    size_t num_halo_rings = 1;
+
+    /// Whether to map all input attributes to the partition submeshes.
+    bool map_attributes = true;
+};
+
+///
+/// Spatially coherent part of a mesh, extracted with its halo.
+///
+/// @tparam     Scalar  Mesh scalar type.
+/// @tparam     Index   Mesh index type.
+///
+template <typename Scalar, typename Index>
+struct MeshPartition
+{
+    /// Submesh of the partition. Its first num_owned_facets facets are owned by the partition,
+    /// the remaining ones belong to the halo.
+    SurfaceMesh<Scalar, Index> mesh;
+
+    /// Index of each submesh facet in the source mesh.
+    std::vector<Index> source_facets;
+
+    /// Number of facets owned by the partition.
+    Index num_owned_facets = 0;
+};
+
+///
+/// Splits a mesh into spatially coherent submeshes extended by halo rings. Each facet of the mesh
+/// is owned by exactly one partition. Partitions are extracted in parallel, and the result is
+/// deterministic.
+///
+/// @param[in]  mesh     Input mesh.
+/// @param[in]  options  Partitioning options.
+///
+/// @tparam     Scalar   Mesh scalar type.
+/// @tparam     Index    Mesh index type.
+///
+/// @return     List of non-empty partitions.
+///
+template <typename Scalar, typename Index>
+LA_PARTITIONING_API std::vector<MeshPartition<Scalar, Index>> extract_mesh_partitions(
+    const SurfaceMesh<Scalar, Index>& mesh,
+    const MeshPartitionOptions& options = {});
+
+///
+/// Maps attributes computed on partition submeshes back to the source mesh. Each element of the
+/// source mesh receives the value of its owner partition: the partition owning the facet of the
+/// lowest corner incident to the element. Halo values are discarded.
+///
+/// Attributes missing from the source mesh are created, with the value type, element type, usage
+/// and number of channels of the partition attributes. Existing non-indexed attributes are
+/// updated in place, while indexed attributes are replaced. Merged indexed attributes keep the
+/// values referenced by owned corners, so values shared across partition boundaries are
+/// duplicated (see weld_indexed_attribute).
+///
+/// @param[in,out] mesh             Source mesh. Edge information is initialized if an edge
+///                                 attribute is merged, in which case partition submeshes must
+///                                 have edge information as well.
+/// @param[in]     partitions       Partitions extracted from the source mesh.
+/// @param[in]     attribute_names  Names of the attributes to merge. They must exist in every
+///                                 partition submesh with the same type.
+///
+/// @tparam        Scalar           Mesh scalar type.
+/// @tparam        Index            Mesh index type.
+///
+template <typename Scalar, typename Index>
+LA_PARTITIONING_API void merge_mesh_partitions(
+    SurfaceMesh<Scalar, Index>& mesh,
+    const std::vector<MeshPartition<Scalar, Index>>& partitions,
+    span<const std::string> attribute_names);
+
+///
+/// Runs an operation independently on spatially coherent parts of a mesh, in parallel, and maps
+/// the resulting attributes back to the mesh. This is equivalent to
+///
+/// @code
+/// auto partitions = extract_mesh_partitions(mesh, options);
+/// for (auto& partition : partitions) op(partition.mesh);  // in parallel
+/// merge_mesh_partitions(mesh, partitions, attribute_names);
+/// @endcode
+///
+/// The operation must only depend on the neighborhood of each element covered by the halo, e.g.
+/// compute_normal with one halo ring. The result then matches running the operation on the whole
+/// mesh up to floating-point rounding: each element sees the same neighborhood, but submeshes may
+/// visit it in a different order. Since the partitions do not depend on the number of threads
+/// (see MeshPartitionOptions::num_partitions), the result is bitwise identical for any number of
+/// threads, provided the operation itself is deterministic.
+///
+/// @param[in,out] mesh             Mesh to process.
+/// @param[in]     op               Operation applied to each partition submesh. It is called
+///                                 concurrently from multiple threads.
+/// @param[in]     attribute_names  Names of the attributes computed by the operation.
+/// @param[in]     options          Partitioning options.
+///
+/// @tparam        Scalar           Mesh scalar type.
+/// @tparam        Index            Mesh index type.
+///
+template <typename Scalar, typename Index>
+LA_PARTITIONING_API void for_each_mesh_partition(
+    SurfaceMesh<Scalar, Index>& mesh,
+    function_ref<void(SurfaceMesh<Scalar, Index>&)> op,
+    span<const std::string> attribute_names,
+    const MeshPartitionOptions& options = {});
+
+} // namespace partitioning
+} // namespace lagrange
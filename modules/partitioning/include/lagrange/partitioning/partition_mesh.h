@@ -0,0 +1,95 @@
+/*
+ * Copyright 2025 Adobe. All rights reserved.
+ * This file is licensed to you under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License. You may obtain a copy
+ * of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR REPRESENTATIONS
+ * OF ANY KIND, either express or implied. See the License for the specific language
+ * governing permissions and limitations under the License.
+ */
+////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <lagrange/partitioning/api.h>
+#include <lagrange/partitioning/types.h>
+
+#include <lagrange/SurfaceMesh.h>
+#include <lagrange/types/ConnectivityType.h>
+
+#include <string_view>
+////////////////////////////////////////////////////////////////////////////////
+
+namespace lagrange {
+namespace partitioning {
+
+///
+/// Option struct for partition_mesh_facets and partition_mesh_vertices.
+///
+struct PartitionOptions
+{
+    using ConnectivityType = lagrange::ConnectivityType;
+
+    /// Number of partitions to produce. If <= 1, every element is assigned to partition 0.
+    index_t num_partitions = 2;
+
+    /// Output partition id attribute name. The attribute is created if it does not exist.
+    std::string_view output_attribute_name = "@partition_id";
+
+    /// Optional weight attribute name, defined on the partitioned elements. Each channel defines
+    /// one balance constraint. Floating point weights are rescaled to integers so that the mean
+    /// weight of each channel is 1000. If empty, all elements have unit weight.
+    std::string_view weight_attribute_name = "";
+
+    /// Maximum allowed load imbalance of each constraint, i.e. the ratio between the heaviest
+    /// partition weight and the average partition weight. Must be >= 1.
+    double imbalance_tolerance = 1.03;
+
+    /// Adjacency of the dual graph used by partition_mesh_facets: facets are connected if they
+    /// share an edge (Edge) or a vertex (Vertex). Ignored by partition_mesh_vertices.
+    ConnectivityType connectivity_type = ConnectivityType::Edge;
+
+    /// Whether to use multilevel recursive bisection instead of multilevel k-way partitioning.
+    /// K-way is faster and usually gives lower edge cuts for large numbers of partitions.
+    bool recursive_bisection = false;
+
+    /// Seed of the random number generator. Partitions are reproducible for a given seed.
+    int seed = 0;
+};
+
+///
+/// Partition mesh facets using METIS. The dual graph is built directly from the mesh connectivity,
+/// in parallel, and partitioned with balance constraints given by optional facet weights.
+///
+/// @param[in,out] mesh     Input mesh. Edge information is initialized if needed.
+/// @param[in]     options  Partitioning options.
+///
+/// @tparam        Scalar   Mesh scalar type.
+/// @tparam        Index    Mesh index type.
+///
+/// @return        Id of the facet attribute storing the partition ids.
+///
+template <typename Scalar, typename Index>
+LA_PARTITIONING_API AttributeId
+partition_mesh_facets(SurfaceMesh<Scalar, Index>& mesh, const PartitionOptions& options = {});
+
+///
+/// Partition mesh vertices using METIS. The nodal graph (vertices connected by mesh edges) is
+/// built directly from the mesh connectivity, in parallel, and partitioned with balance
+/// constraints given by optional vertex weights.
+///
+/// @param[in,out] mesh     Input mesh. Edge information is initialized if needed.
+/// @param[in]     options  Partitioning options.
+///
+/// @tparam        Scalar   Mesh scalar type.
+/// @tparam        Index    Mesh index type.
+///
+/// @return        Id of the vertex attribute storing the partition ids.
+///
+template <typename Scalar, typename Index>
+LA_PARTITIONING_API AttributeId
+partition_mesh_vertices(SurfaceMesh<Scalar, Index>& mesh, const PartitionOptions& options = {});
+
+} // namespace partitioning
+} // namespace lagrange
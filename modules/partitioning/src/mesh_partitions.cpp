@@ -0,0 +1,485 @@
+/*
+ * Copyright 2025 Adobe. All rights reserved.
+ * This file is licensed to you under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License. You may obtain a copy
+ * of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR REPRESENTATIONS
+ * OF ANY KIND, either express or implied. See the License for the specific language
+ * governing permissions and limitations under the License.
+ */
+////////////////////////////////////////////////////////////////////////////////
+#include <lagrange/partitioning/mesh_partitions.h>
+#include <lagrange/partitioning/partition_mesh.h>
+
+#include <lagrange/Attribute.h>
+#include <lagrange/IndexedAttribute.h>
+#include <lagrange/Logger.h>
+#include <lagrange/SurfaceMeshTypes.h>
+#include <lagrange/extract_submesh.h>
+#include <lagrange/internal/visit_attribute.h>
+#include <lagrange/utils/assert.h>
+#include <lagrange/utils/invalid.h>
+#include <lagrange/utils/safe_cast.h>
+
+#include <tbb/parallel_for.h>
+
+#include <algorithm>
+#include <iterator>
+#include <numeric>
+#include <type_traits>
+////////////////////////////////////////////////////////////////////////////////
+
+namespace lagrange::partitioning {
+
+namespace {
+
+///
+/// Orders mesh facets along a space-filling curve, by reordering a point cloud made of the facet
+/// centroids.
+///
+template <typename Scalar, typename Index>
+std::vector<Index> spatial_facet_order(
+    const SurfaceMesh<Scalar, Index>& mesh,
+    ReorderingMethod ordering)
+{
+    const Index num_facets = mesh.get_num_facets();
+    const Index dim = mesh.get_dimension();
+    SurfaceMesh<Scalar, Index> centroids(3);
+    centroids.add_vertices(num_facets);
+    auto facet_ids = centroids.template create_attribute<Index>(
+        "facet_id",
+        AttributeElement::Vertex,
+        AttributeUsage::Scalar,
+        1);
+    auto ids = centroids.template ref_attribute<Index>(facet_ids).ref_all();
+    auto positions = centroids.ref_vertex_to_position().ref_all();
+    tbb::parallel_for(Index(0), num_facets, [&](Index f) {
+        Scalar* p = positions.data() + 3 * static_cast<size_t>(f);
+        std::fill_n(p, 3, Scalar(0));
+        const Index c0 = mesh.get_facet_corner_begin(f);
+        const Index c1 = mesh.get_facet_corner_end(f);
+        for (Index c = c0; c < c1; ++c) {
+            auto q = mesh.get_position(mesh.get_corner_vertex(c));
+            for (Index d = 0; d < dim; ++d) p[d] += q[d];
+        }
+        for (Index d = 0; d < dim; ++d) p[d] /= static_cast<Scalar>(c1 - c0);
+        ids[f] = f;
+    });
+
+    reorder_mesh(centroids, ordering);
+    auto order = centroids.template get_attribute<Index>("facet_id").get_all();
+    return std::vector<Index>(order.begin(), order.end());
+}
+
+///
+/// Splits facets into partitions. Facets of each partition are sorted by increasing index, and
+/// empty partitions are discarded.
+///
+template <typename Scalar, typename Index>
+std::vector<std::vector<Index>> compute_owned_facets(
+    const SurfaceMesh<Scalar, Index>& mesh,
+    const MeshPartitionOptions& options)
+{
+    const Index num_facets = mesh.get_num_facets();
+    size_t num_partitions = options.num_partitions;
+    if (num_partitions == 0) {
+        // Derived from the facet count only, so the partitions do not depend on the machine
+        const size_t target_size = std::max<size_t>(options.target_partition_size, 1);
+        num_partitions = (static_cast<size_t>(num_facets) + target_size - 1) / target_size;
+    }
+    num_partitions = std::clamp<size_t>(num_partitions, 1, num_facets);
+
+    std::vector<std::vector<Index>> owned(num_partitions);
+    if (options.method == PartitionMethod::Spatial) {
+        la_runtime_assert(
+            options.ordering != ReorderingMethod::None,
+            "[partitioning] Spatial partitioning requires a facet ordering.");
+        auto order = spatial_facet_order(mesh, options.ordering);
+        tbb::parallel_for(size_t(0), num_partitions, [&](size_t p) {
+            auto first = order.begin() + p * num_facets / num_partitions;
+            auto last = order.begin() + (p + 1) * num_facets / num_partitions;
+            owned[p].assign(first, last);
+            std::sort(owned[p].begin(), owned[p].end());
+        });
+    } else {
+        // Shallow copy: only the edge data and the partition ids are allocated.
+        SurfaceMesh<Scalar, Index> graph_mesh = mesh;
+        PartitionOptions partition_options;
+        partition_options.num_partitions = safe_cast<index_t>(num_partitions);
+        partition_options.output_attribute_name = "@mesh_partition_id";
+        auto id = partition_mesh_facets(graph_mesh, partition_options);
+        auto partition_ids = graph_mesh.template get_attribute<Index>(id).get_all();
+        for (Index f = 0; f < num_facets; ++f) {
+            owned[partition_ids[f]].push_back(f);
+        }
+    }
+
+    owned.erase(
+        std::remove_if(owned.begin(), owned.end(), [](const auto& o) { return o.empty(); }),
+        owned.end());
+    return owned;
+}
+
+///
+/// Computes the halo of a partition, sorted by increasing facet index.
+///
+template <typename Scalar, typename Index>
+std::vector<Index> compute_halo(
+    const SurfaceMesh<Scalar, Index>& mesh,
+    const std::vector<Index>& vertex_facet_offsets,
+    const std::vector<Index>& vertex_facets,
+    const std::vector<Index>& facet_partition,
+    const std::vector<Index>& owned,
+    Index partition,
+    size_t num_rings)
+{
+    std::vector<Index> halo;
+    std::vector<Index> frontier = owned;
+    std::vector<Index> candidates;
+    std::vector<Index> merged;
+    for (size_t ring = 0; ring < num_rings && !frontier.empty(); ++ring) {
+        candidates.clear();
+        for (Index f : frontier) {
+            for (Index v : mesh.get_facet_vertices(f)) {
+                for (Index i = vertex_facet_offsets[v]; i < vertex_facet_offsets[v + 1]; ++i) {
+                    const Index g = vertex_facets[i];
+                    if (facet_partition[g] != partition) candidates.push_back(g);
+                }
+            }
+        }
+        std::sort(candidates.begin(), candidates.end());
+        candidates.erase(std::unique(candidates.begin(), candidates.end()), candidates.end());
+
+        frontier.clear();
+        std::set_difference(
+            candidates.begin(),
+            candidates.end(),
+            halo.begin(),
+            halo.end(),
+            std::back_inserter(frontier));
+        merged.clear();
+        std::merge(
+            halo.begin(),
+            halo.end(),
+            frontier.begin(),
+            frontier.end(),
+            std::back_inserter(merged));
+        std::swap(halo, merged);
+    }
+    return halo;
+}
+
+///
+/// Lowest corner incident to each vertex or edge of a mesh.
+///
+template <typename Scalar, typename Index>
+std::vector<Index> compute_owner_corners(
+    const SurfaceMesh<Scalar, Index>& mesh,
+    AttributeElement element)
+{
+    const Index num_corners = mesh.get_num_corners();
+    const bool is_vertex = (element == AttributeElement::Vertex);
+    std::vector<Index> owners(
+        is_vertex ? mesh.get_num_vertices() : mesh.get_num_edges(),
+        invalid<Index>());
+    for (Index c = num_corners; c-- > 0;) {
+        owners[is_vertex ? mesh.get_corner_vertex(c) : mesh.get_corner_edge(c)] = c;
+    }
+    return owners;
+}
+
+template <typename ValueType, typename Scalar, typename Index>
+void merge_attribute(
+    SurfaceMesh<Scalar, Index>& mesh,
+    const std::vector<MeshPartition<Scalar, Index>>& partitions,
+    std::string_view name,
+    AttributeElement element,
+    AttributeUsage usage,
+    size_t num_channels)
+{
+    la_runtime_assert(
+        element != AttributeElement::Value,
+        "[partitioning] Value attributes cannot be merged.");
+    if (element == AttributeElement::Edge) mesh.initialize_edges();
+
+    AttributeId id;
+    if (mesh.has_attribute(name)) {
+        id = mesh.get_attribute_id(name);
+        const auto& base = mesh.get_attribute_base(id);
+        la_runtime_assert(
+            mesh.template is_attribute_type<ValueType>(id) && base.get_element_type() == element &&
+                base.get_num_channels() == num_channels,
+            fmt::format("[partitioning] Attribute {} does not match partition attributes.", name));
+    } else {
+        id = mesh.template create_attribute<ValueType>(name, element, usage, num_channels);
+    }
+
+    std::vector<Index> owners;
+    if (element == AttributeElement::Vertex || element == AttributeElement::Edge) {
+        owners = compute_owner_corners(mesh, element);
+    }
+
+    auto values = mesh.template ref_attribute<ValueType>(id).ref_all();
+    const SurfaceMesh<Scalar, Index>& cmesh = mesh;
+    tbb::parallel_for(size_t(0), partitions.size(), [&](size_t p) {
+        const auto& partition = partitions[p];
+        const auto& submesh = partition.mesh;
+        const auto& attr = submesh.template get_attribute<ValueType>(name);
+        la_runtime_assert(
+            attr.get_element_type() == element && attr.get_num_channels() == num_channels,
+            fmt::format("[partitioning] Attribute {} differs across partitions.", name));
+        la_runtime_assert(
+            element != AttributeElement::Edge || submesh.has_edges(),
+            "[partitioning] Partition submeshes must have edge information.");
+        auto sub_values = attr.get_all();
+
+        auto copy = [&](Index from, Index to) {
+            std::copy_n(
+                sub_values.begin() + static_cast<size_t>(from) * num_channels,
+                num_channels,
+                values.begin() + static_cast<size_t>(to) * num_channels);
+        };
+
+        for (Index i = 0; i < partition.num_owned_facets; ++i) {
+            const Index f = partition.source_facets[i];
+            if (element == AttributeElement::Facet) {
+                copy(i, f);
+                continue;
+            }
+            const Index c0 = cmesh.get_facet_corner_begin(f);
+            const Index sc0 = submesh.get_facet_corner_begin(i);
+            for (Index lc = 0; lc < cmesh.get_facet_size(f); ++lc) {
+                const Index c = c0 + lc;
+                const Index sc = sc0 + lc;
+                switch (element) {
+                case AttributeElement::Corner: copy(sc, c); break;
+                case AttributeElement::Vertex: {
+                    const Index v = cmesh.get_corner_vertex(c);
+                    if (owners[v] == c) copy(submesh.get_corner_vertex(sc), v);
+                    break;
+                }
+                case AttributeElement::Edge: {
+                    const Index e = cmesh.get_corner_edge(c);
+                    if (owners[e] == c) copy(submesh.get_corner_edge(sc), e);
+                    break;
+                }
+                default: break;
+                }
+            }
+        }
+    });
+}
+
+template <typename ValueType, typename Scalar, typename Index>
+void merge_indexed_attribute(
+    SurfaceMesh<Scalar, Index>& mesh,
+    const std::vector<MeshPartition<Scalar, Index>>& partitions,
+    std::string_view name,
+    AttributeUsage usage,
+    size_t num_channels)
+{
+    // Compact the values referenced by owned corners of each partition, in increasing order.
+    const size_t num_partitions = partitions.size();
+    std::vector<std::vector<Index>> remaps(num_partitions);
+    std::vector<size_t> offsets(num_partitions + 1, 0);
+    tbb::parallel_for(size_t(0), num_partitions, [&](size_t p) {
+        const auto& partition = partitions[p];
+        const auto& attr = partition.mesh.template get_indexed_attribute<ValueType>(name);
+        la_runtime_assert(
+            attr.get_num_channels() == num_channels,
+            fmt::format("[partitioning] Attribute {} differs across partitions.", name));
+        auto indices = attr.indices().get_all();
+        auto& remap = remaps[p];
+        remap.assign(attr.values().get_num_elements(), invalid<Index>());
+        const Index num_owned_corners =
+            partition.num_owned_facets == partition.mesh.get_num_facets()
+                ? partition.mesh.get_num_corners()
+                : partition.mesh.get_facet_corner_begin(partition.num_owned_facets);
+        for (Index c = 0; c < num_owned_corners; ++c) remap[indices[c]] = 0;
+        Index count = 0;
+        for (auto& r : remap) {
+            if (r != invalid<Index>()) r = count++;
+        }
+        offsets[p + 1] = count;
+    });
+    std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+
+    std::vector<ValueType> values(offsets.back() * num_channels);
+    std::vector<Index> indices(mesh.get_num_corners(), invalid<Index>());
+    tbb::parallel_for(size_t(0), num_partitions, [&](size_t p) {
+        const auto& partition = partitions[p];
+        const auto& submesh = partition.mesh;
+        const auto& attr = submesh.template get_indexed_attribute<ValueType>(name);
+        auto sub_values = attr.values().get_all();
+        auto sub_indices = attr.indices().get_all();
+        const auto& remap = remaps[p];
+        for (size_t i = 0; i < remap.size(); ++i) {
+            if (remap[i] == invalid<Index>()) continue;
+            std::copy_n(
+                sub_values.begin() + i * num_channels,
+                num_channels,
+                values.begin() + (offsets[p] + remap[i]) * num_channels);
+        }
+        for (Index i = 0; i < partition.num_owned_facets; ++i) {
+            const Index c0 = mesh.get_facet_corner_begin(partition.source_facets[i]);
+            const Index sc0 = submesh.get_facet_corner_begin(i);
+            for (Index lc = 0; lc < submesh.get_facet_size(i); ++lc) {
+                indices[c0 + lc] =
+                    safe_cast<Index>(offsets[p] + remap[sub_indices[sc0 + lc]]);
+            }
+        }
+    });
+
+    if (mesh.has_attribute(name)) {
+        la_runtime_assert(
+            mesh.is_attribute_indexed(name),
+            fmt::format("[partitioning] Attribute {} must be indexed.", name));
+        mesh.delete_attribute(name);
+    }
+    mesh.template create_attribute<ValueType>(
+        name,
+        AttributeElement::Indexed,
+        usage,
+        num_channels,
+        values,
+        indices);
+}
+
+} // namespace
+
+template <typename Scalar, typename Index>
+std::vector<MeshPartition<Scalar, Index>> extract_mesh_partitions(
+    const SurfaceMesh<Scalar, Index>& mesh,
+    const MeshPartitionOptions& options)
+{
+    const Index num_vertices = mesh.get_num_vertices();
+    const Index num_facets = mesh.get_num_facets();
+    if (num_facets == 0) return {};
+
+    auto owned = compute_owned_facets(mesh, options);
+    const size_t num_partitions = owned.size();
+    std::vector<Index> facet_partition(num_facets);
+    tbb::parallel_for(size_t(0), num_partitions, [&](size_t p) {
+        for (Index f : owned[p]) facet_partition[f] = static_cast<Index>(p);
+    });
+
+    // Facets incident to each vertex, in increasing order.
+    std::vector<Index> vertex_facet_offsets;
+    std::vector<Index> vertex_facets;
+    if (options.num_halo_rings > 0) {
+        vertex_facet_offsets.assign(num_vertices + 1, 0);
+        for (Index c = 0; c < mesh.get_num_corners(); ++c) {
+            ++vertex_facet_offsets[mesh.get_corner_vertex(c) + 1];
+        }
+        std::partial_sum(
+            vertex_facet_offsets.begin(),
+            vertex_facet_offsets.end(),
+            vertex_facet_offsets.begin());
+        vertex_facets.resize(vertex_facet_offsets.back());
+        std::vector<Index> cursor(vertex_facet_offsets.begin(), vertex_facet_offsets.end() - 1);
+        for (Index f = 0; f < num_facets; ++f) {
+            for (Index v : mesh.get_facet_vertices(f)) vertex_facets[cursor[v]++] = f;
+        }
+    }
+
+    SubmeshOptions submesh_options;
+    submesh_options.map_attributes = options.map_attributes;
+
+    std::vector<MeshPartition<Scalar, Index>> partitions(num_partitions);
+    tbb::parallel_for(
+        size_t(0),
+        num_partitions,
+        [&](size_t p) {
+            auto& partition = partitions[p];
+            partition.source_facets = owned[p];
+            partition.num_owned_facets = static_cast<Index>(owned[p].size());
+            if (options.num_halo_rings > 0) {
+                auto halo = compute_halo(
+                    mesh,
+                    vertex_facet_offsets,
+                    vertex_facets,
+                    facet_partition,
+                    owned[p],
+                    static_cast<Index>(p),
+                    options.num_halo_rings);
+                partition.source_facets.insert(
+                    partition.source_facets.end(),
+                    halo.begin(),
+                    halo.end());
+            }
+            partition.mesh = extract_submesh<Scalar, Index>(
+                mesh,
+                partition.source_facets,
+                submesh_options);
+        },
+        tbb::simple_partitioner());
+
+    logger().debug("[partitioning] Extracted {} mesh partitions", num_partitions);
+    return partitions;
+}
+
+template <typename Scalar, typename Index>
+void merge_mesh_partitions(
+    SurfaceMesh<Scalar, Index>& mesh,
+    const std::vector<MeshPartition<Scalar, Index>>& partitions,
+    span<const std::string> attribute_names)
+{
+    if (partitions.empty()) return;
+    const auto& first = partitions.front().mesh;
+    for (const auto& name : attribute_names) {
+        internal::visit_attribute_read(first, first.get_attribute_id(name), [&](auto&& attr) {
+            using AttributeType = std::decay_t<decltype(attr)>;
+            using ValueType = typename AttributeType::ValueType;
+            if constexpr (AttributeType::IsIndexed) {
+                merge_indexed_attribute<ValueType>(
+                    mesh,
+                    partitions,
+                    name,
+                    attr.get_usage(),
+                    attr.get_num_channels());
+            } else {
+                merge_attribute<ValueType>(
+                    mesh,
+                    partitions,
+                    name,
+                    attr.get_element_type(),
+                    attr.get_usage(),
+                    attr.get_num_channels());
+            }
+        });
+    }
+}
+
+template <typename Scalar, typename Index>
+void for_each_mesh_partition(
+    SurfaceMesh<Scalar, Index>& mesh,
+    function_ref<void(SurfaceMesh<Scalar, Index>&)> op,
+    span<const std::string> attribute_names,
+    const MeshPartitionOptions& options)
+{
+    auto partitions = extract_mesh_partitions(mesh, options);
+    tbb::parallel_for(
+        size_t(0),
+        partitions.size(),
+        [&](size_t p) { op(partitions[p].mesh); },
+        tbb::simple_partitioner());
+    merge_mesh_partitions(mesh, partitions, attribute_names);
+}
+
+#define LA_X_mesh_partitions(_, Scalar, Index)                                               \
+    template LA_PARTITIONING_API std::vector<MeshPartition<Scalar, Index>>                   \
+    extract_mesh_partitions(const SurfaceMesh<Scalar, Index>&, const MeshPartitionOptions&); \
+    template LA_PARTITIONING_API void merge_mesh_partitions(                                 \
+        SurfaceMesh<Scalar, Index>&,                                                         \
+        const std::vector<MeshPartition<Scalar, Index>>&,                                    \
+        span<const std::string>);                                                            \
+    template LA_PARTITIONING_API void for_each_mesh_partition(                               \
+        SurfaceMesh<Scalar, Index>&,                                                         \
+        function_ref<void(SurfaceMesh<Scalar, Index>&)>,                                     \
+        span<const std::string>,                                                             \
+        const MeshPartitionOptions&);
+LA_SURFACE_MESH_X(mesh_partitions, 0)
+
+} // namespace lagrange::partitioning
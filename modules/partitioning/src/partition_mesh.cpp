@@ -0,0 +1,317 @@
+/*
+ * Copyright 2025 Adobe. All rights reserved.
+ * This file is licensed to you under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License. You may obtain a copy
+ * of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR REPRESENTATIONS
+ * OF ANY KIND, either express or implied. See the License for the specific language
+ * governing permissions and limitations under the License.
+ */
+////////////////////////////////////////////////////////////////////////////////
+#include <lagrange/partitioning/partition_mesh.h>
+
+#include <lagrange/Attribute.h>
+#include <lagrange/Logger.h>
+#include <lagrange/SurfaceMeshTypes.h>
+#include <lagrange/internal/find_attribute_utils.h>
+#include <lagrange/internal/visit_attribute.h>
+#include <lagrange/utils/assert.h>
+#include <lagrange/utils/safe_cast.h>
+
+#include <tbb/blocked_range.h>
+#include <tbb/enumerable_thread_specific.h>
+#include <tbb/parallel_for.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+////////////////////////////////////////////////////////////////////////////////
+
+namespace {
+
+// clang-format off
+#include <lagrange/utils/warnoff.h>
+#include <metis.h>
+#include <lagrange/utils/warnon.h>
+// clang-format on
+
+} // namespace
+
+namespace lagrange::partitioning {
+
+namespace {
+
+// Adjacency graph in METIS compressed (CSR) format.
+struct Graph
+{
+    std::vector<idx_t> xadj;
+    std::vector<idx_t> adjncy;
+};
+
+///
+/// Builds a graph in two parallel passes over its nodes: the first pass counts the neighbors of
+/// each node, the second one writes them at their final offset. No intermediate edge list is
+/// stored.
+///
+/// @param[in]  num_nodes  Number of graph nodes.
+/// @param[in]  gather     Function appending the neighbors of a node to a buffer. Duplicates and
+///                        the node itself are filtered out afterwards.
+///
+template <typename Index, typename Gather>
+Graph build_graph(Index num_nodes, Gather&& gather)
+{
+    tbb::enumerable_thread_specific<std::vector<Index>> buffers;
+    auto neighbors = [&](Index i) -> const std::vector<Index>& {
+        auto& buffer = buffers.local();
+        buffer.clear();
+        gather(i, buffer);
+        buffer.erase(std::remove(buffer.begin(), buffer.end(), i), buffer.end());
+        std::sort(buffer.begin(), buffer.end());
+        buffer.erase(std::unique(buffer.begin(), buffer.end()), buffer.end());
+        return buffer;
+    };
+
+    Graph graph;
+    graph.xadj.assign(static_cast<size_t>(num_nodes) + 1, 0);
+    tbb::parallel_for(tbb::blocked_range<Index>(0, num_nodes), [&](const auto& range) {
+        for (Index i = range.begin(); i != range.end(); ++i) {
+            graph.xadj[i + 1] = safe_cast<idx_t>(neighbors(i).size());
+        }
+    });
+    for (Index i = 0; i < num_nodes; ++i) {
+        la_runtime_assert(
+            graph.xadj[i + 1] <= std::numeric_limits<idx_t>::max() - graph.xadj[i],
+            "[partitioning] Graph is too large for METIS index type.");
+        graph.xadj[i + 1] += graph.xadj[i];
+    }
+
+    graph.adjncy.resize(static_cast<size_t>(graph.xadj.back()));
+    tbb::parallel_for(tbb::blocked_range<Index>(0, num_nodes), [&](const auto& range) {
+        for (Index i = range.begin(); i != range.end(); ++i) {
+            const auto& adj = neighbors(i);
+            std::transform(
+                adj.begin(),
+                adj.end(),
+                graph.adjncy.begin() + graph.xadj[i],
+                [](Index j) { return static_cast<idx_t>(j); });
+        }
+    });
+    return graph;
+}
+
+///
+/// Converts a per-element weight attribute into METIS integer weights, one row per element and
+/// one column per balance constraint.
+///
+template <typename Scalar, typename Index>
+std::vector<idx_t> extract_weights(
+    const SurfaceMesh<Scalar, Index>& mesh,
+    std::string_view name,
+    AttributeElement element,
+    idx_t& num_constraints)
+{
+    std::vector<idx_t> weights;
+    num_constraints = 1;
+    if (name.empty()) return weights;
+
+    const AttributeId id = mesh.get_attribute_id(name);
+    internal::visit_attribute_read(mesh, id, [&](auto&& attr) {
+        using AttributeType = std::decay_t<decltype(attr)>;
+        using ValueType = typename AttributeType::ValueType;
+        if constexpr (AttributeType::IsIndexed) {
+            throw Error("[partitioning] Weight attribute cannot be indexed.");
+        } else {
+            la_runtime_assert(
+                attr.get_element_type() == element,
+                "[partitioning] Weight attribute must be defined on the partitioned elements.");
+            const size_t num_channels = attr.get_num_channels();
+            const size_t num_elements = attr.get_num_elements();
+            auto values = attr.get_all();
+            weights.resize(values.size());
+            num_constraints = safe_cast<idx_t>(num_channels);
+
+            for (size_t c = 0; c < num_channels; ++c) {
+                double scale = 1;
+                if constexpr (std::is_floating_point_v<ValueType>) {
+                    double mean = 0;
+                    for (size_t i = 0; i < num_elements; ++i) {
+                        mean += static_cast<double>(values[i * num_channels + c]);
+                    }
+                    mean /= static_cast<double>(std::max<size_t>(num_elements, 1));
+                    if (mean > 0) scale = 1000 / mean;
+                }
+                for (size_t i = 0; i < num_elements; ++i) {
+                    const auto w = values[i * num_channels + c];
+                    if constexpr (std::is_signed_v<ValueType>) {
+                        la_runtime_assert(w >= 0, "[partitioning] Weights must be non-negative.");
+                    }
+                    if constexpr (std::is_floating_point_v<ValueType>) {
+                        weights[i * num_channels + c] =
+                            safe_cast<idx_t>(std::llround(static_cast<double>(w) * scale));
+                    } else {
+                        weights[i * num_channels + c] = safe_cast<idx_t>(w);
+                    }
+                }
+            }
+        }
+    });
+    return weights;
+}
+
+///
+/// Partitions a graph with METIS multilevel k-way partitioning (or recursive bisection), and
+/// writes the result to an attribute.
+///
+template <typename Scalar, typename Index>
+AttributeId partition_graph(
+    SurfaceMesh<Scalar, Index>& mesh,
+    Graph& graph,
+    AttributeElement element,
+    const PartitionOptions& options)
+{
+    la_runtime_assert(
+        options.imbalance_tolerance >= 1,
+        "[partitioning] Imbalance tolerance must be >= 1.");
+
+    idx_t num_constraints = 1;
+    auto weights =
+        extract_weights(mesh, options.weight_attribute_name, element, num_constraints);
+
+    AttributeId id = internal::find_or_create_attribute<Index>(
+        mesh,
+        options.output_attribute_name,
+        element,
+        AttributeUsage::Scalar,
+        1,
+        internal::ResetToDefault::No);
+    auto partitions = mesh.template ref_attribute<Index>(id).ref_all();
+
+    idx_t num_nodes = safe_cast<idx_t>(graph.xadj.size() - 1);
+    idx_t num_partitions = safe_cast<idx_t>(options.num_partitions);
+    if (num_partitions <= 1 || num_nodes == 0) {
+        if (num_partitions <= 1) {
+            logger().warn("<= 1 partition was requested, skipping partitioning.");
+        }
+        std::fill(partitions.begin(), partitions.end(), Index(0));
+        return id;
+    }
+
+    idx_t metis_options[METIS_NOPTIONS];
+    METIS_SetDefaultOptions(metis_options);
+    metis_options[METIS_OPTION_SEED] = static_cast<idx_t>(options.seed);
+    metis_options[METIS_OPTION_NUMBERING] = 0;
+    std::vector<real_t> imbalance(
+        static_cast<size_t>(num_constraints),
+        static_cast<real_t>(options.imbalance_tolerance));
+
+    // Outputs
+    idx_t objval = 0;
+    std::vector<idx_t> part(static_cast<size_t>(num_nodes));
+
+    auto partition = options.recursive_bisection ? METIS_PartGraphRecursive : METIS_PartGraphKway;
+    auto err = partition(
+        &num_nodes,
+        &num_constraints,
+        graph.xadj.data(),
+        graph.adjncy.data(),
+        weights.empty() ? nullptr : weights.data(), // vwgt
+        nullptr, // vsize
+        nullptr, // adjwgt
+        &num_partitions,
+        nullptr, // tpwgts
+        imbalance.data(),
+        metis_options,
+        &objval,
+        part.data());
+
+    // Error handling
+    std::string message;
+    switch (err) {
+    case METIS_OK:
+        logger().debug(
+            "[partitioning] Computed {} partitions with edge cut of {}",
+            num_partitions,
+            objval);
+        break;
+    case METIS_ERROR_INPUT: message = "[partitioning] Invalid input."; break;
+    case METIS_ERROR_MEMORY: message = "[partitioning] Ran out of memory."; break;
+    case METIS_ERROR:
+    default: message = "[partitioning] METIS error."; break;
+    }
+    if (!message.empty()) {
+        logger().error("{}", message);
+        throw std::runtime_error(message);
+    }
+
+    std::transform(part.begin(), part.end(), partitions.begin(), [](idx_t p) {
+        return static_cast<Index>(p);
+    });
+    return id;
+}
+
+} // namespace
+
+template <typename Scalar, typename Index>
+AttributeId partition_mesh_facets(SurfaceMesh<Scalar, Index>& mesh, const PartitionOptions& options)
+{
+    mesh.initialize_edges();
+    const SurfaceMesh<Scalar, Index>& cmesh = mesh;
+
+    Graph graph;
+    if (options.connectivity_type == ConnectivityType::Edge) {
+        graph = build_graph(cmesh.get_num_facets(), [&](Index f, std::vector<Index>& adj) {
+            for (Index c = cmesh.get_facet_corner_begin(f); c < cmesh.get_facet_corner_end(f);
+                 ++c) {
+                cmesh.foreach_facet_around_edge(cmesh.get_corner_edge(c), [&](Index g) {
+                    adj.push_back(g);
+                });
+            }
+        });
+    } else {
+        graph = build_graph(cmesh.get_num_facets(), [&](Index f, std::vector<Index>& adj) {
+            for (Index c = cmesh.get_facet_corner_begin(f); c < cmesh.get_facet_corner_end(f);
+                 ++c) {
+                cmesh.foreach_facet_around_vertex(cmesh.get_corner_vertex(c), [&](Index g) {
+                    adj.push_back(g);
+                });
+            }
+        });
+    }
+
+    return partition_graph(mesh, graph, AttributeElement::Facet, options);
+}
+
+template <typename Scalar, typename Index>
+AttributeId partition_mesh_vertices(
+    SurfaceMesh<Scalar, Index>& mesh,
+    const PartitionOptions& options)
+{
+    mesh.initialize_edges();
+    const SurfaceMesh<Scalar, Index>& cmesh = mesh;
+
+    Graph graph = build_graph(cmesh.get_num_vertices(), [&](Index v, std::vector<Index>& adj) {
+        cmesh.foreach_edge_around_vertex_with_duplicates(v, [&](Index e) {
+            auto ev = cmesh.get_edge_vertices(e);
+            adj.push_back(ev[0] == v ? ev[1] : ev[0]);
+        });
+    });
+
+    return partition_graph(mesh, graph, AttributeElement::Vertex, options);
+}
+
+#define LA_X_partition_mesh(_, Scalar, Index)                           \
+    template LA_PARTITIONING_API AttributeId partition_mesh_facets(     \
+        SurfaceMesh<Scalar, Index>&,                                    \
+        const PartitionOptions&);                                       \
+    template LA_PARTITIONING_API AttributeId partition_mesh_vertices(   \
+        SurfaceMesh<Scalar, Index>&,                                    \
+        const PartitionOptions&);
+LA_SURFACE_MESH_X(partition_mesh, 0)
+
+} // namespace lagrange::partitioning
@@ -0,0 +1,172 @@
+/*
+ * Copyright 2025 Adobe. All rights reserved.
+ * This file is licensed to you under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License. You may obtain a copy
+ * of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR REPRESENTATIONS
+ * OF ANY KIND, either express or implied. See the License for the specific language
+ * governing permissions and limitations under the License.
+ */
+////////////////////////////////////////////////////////////////////////////////
+#include <lagrange/partitioning/mesh_partitions.h>
+
+#include <lagrange/compute_facet_normal.h>
+#include <lagrange/compute_normal.h>
+#include <lagrange/compute_vertex_normal.h>
+#include <lagrange/internal/constants.h>
+#include <lagrange/testing/common.h>
+#include <lagrange/views.h>
+
+// clang-format off
+#include <lagrange/utils/warnoff.h>
+#include <tbb/task_arena.h>
+#include <lagrange/utils/warnon.h>
+// clang-format on
+
+#include <string>
+#include <vector>
+////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("Partitioning: MeshPartitions", "[partitioning]" LA_SLOW_DEBUG_FLAG)
+{
+    using Scalar = double;
+    using Index = uint32_t;
+    using MeshType = lagrange::SurfaceMesh<Scalar, Index>;
+    namespace partitioning = lagrange::partitioning;
+
+    auto mesh = lagrange::testing::load_surface_mesh<Scalar, Index>("open/core/bunny_simple.obj");
+    REQUIRE(mesh.get_num_facets() == 5002);
+
+    const std::vector<partitioning::PartitionMethod> methods = {
+        partitioning::PartitionMethod::Spatial,
+        partitioning::PartitionMethod::Graph};
+    auto make_options = [](partitioning::PartitionMethod method) {
+        partitioning::MeshPartitionOptions options;
+        options.num_partitions = 8;
+        options.method = method;
+        return options;
+    };
+
+    SECTION("extraction")
+    {
+        for (auto method : methods) {
+            auto options = make_options(method);
+            auto partitions = partitioning::extract_mesh_partitions(mesh, options);
+            REQUIRE(!partitions.empty());
+            REQUIRE(partitions.size() <= 8);
+
+            std::vector<int> num_owners(mesh.get_num_facets(), 0);
+            for (const auto& partition : partitions) {
+                REQUIRE(partition.source_facets.size() == partition.mesh.get_num_facets());
+                REQUIRE(partition.num_owned_facets > 0);
+                REQUIRE(partition.num_owned_facets <= partition.mesh.get_num_facets());
+                for (Index i = 0; i < partition.num_owned_facets; ++i) {
+                    ++num_owners[partition.source_facets[i]];
+                }
+            }
+            for (int n : num_owners) REQUIRE(n == 1);
+
+            // Determinism
+            auto partitions2 = partitioning::extract_mesh_partitions(mesh, options);
+            REQUIRE(partitions2.size() == partitions.size());
+            for (size_t p = 0; p < partitions.size(); ++p) {
+                REQUIRE(partitions[p].source_facets == partitions2[p].source_facets);
+            }
+        }
+    }
+
+    SECTION("facet and vertex normals")
+    {
+        MeshType expected = mesh;
+        lagrange::compute_facet_normal(expected);
+        lagrange::compute_vertex_normal(expected);
+
+        for (auto method : methods) {
+            MeshType result = mesh;
+            std::vector<std::string> names = {"@facet_normal", "@vertex_normal"};
+            partitioning::for_each_mesh_partition<Scalar, Index>(
+                result,
+                [](MeshType& submesh) {
+                    lagrange::compute_facet_normal(submesh);
+                    lagrange::compute_vertex_normal(submesh);
+                },
+                names,
+                make_options(method));
+
+            for (const auto& name : names) {
+                auto expected_values = lagrange::attribute_matrix_view<Scalar>(expected, name);
+                auto result_values = lagrange::attribute_matrix_view<Scalar>(result, name);
+                REQUIRE(expected_values.rows() == result_values.rows());
+                REQUIRE(result_values.isApprox(expected_values, 1e-12));
+            }
+        }
+    }
+
+    SECTION("thread independence")
+    {
+        // Default partition count, derived from the facet count
+        partitioning::MeshPartitionOptions options;
+        options.target_partition_size = 512;
+        REQUIRE(partitioning::extract_mesh_partitions(mesh, options).size() == 10);
+
+        const Scalar angle = lagrange::internal::pi / 4;
+        std::vector<std::string> names = {"@vertex_normal", "@normal"};
+        auto op = [&](MeshType& submesh) {
+            lagrange::compute_vertex_normal(submesh);
+            lagrange::compute_normal<Scalar, Index>(submesh, angle);
+        };
+
+        for (auto method : methods) {
+            options.method = method;
+            MeshType serial = mesh;
+            tbb::task_arena arena(1);
+            arena.execute([&] {
+                partitioning::for_each_mesh_partition<Scalar, Index>(serial, op, names, options);
+            });
+            MeshType parallel = mesh;
+            partitioning::for_each_mesh_partition<Scalar, Index>(parallel, op, names, options);
+
+            REQUIRE(
+                lagrange::attribute_matrix_view<Scalar>(serial, "@vertex_normal") ==
+                lagrange::attribute_matrix_view<Scalar>(parallel, "@vertex_normal"));
+            const auto& serial_attr = serial.get_indexed_attribute<Scalar>("@normal");
+            const auto& parallel_attr = parallel.get_indexed_attribute<Scalar>("@normal");
+            REQUIRE(
+                lagrange::matrix_view(serial_attr.values()) ==
+                lagrange::matrix_view(parallel_attr.values()));
+            REQUIRE(
+                lagrange::vector_view(serial_attr.indices()) ==
+                lagrange::vector_view(parallel_attr.indices()));
+        }
+    }
+
+    SECTION("indexed normals")
+    {
+        const Scalar angle = lagrange::internal::pi / 4;
+        MeshType expected = mesh;
+        lagrange::compute_normal<Scalar, Index>(expected, angle);
+        const auto& expected_attr = expected.get_indexed_attribute<Scalar>("@normal");
+        auto expected_values = lagrange::matrix_view(expected_attr.values());
+        auto expected_indices = expected_attr.indices().get_all();
+
+        for (auto method : methods) {
+            MeshType result = mesh;
+            std::vector<std::string> names = {"@normal"};
+            partitioning::for_each_mesh_partition<Scalar, Index>(
+                result,
+                [&](MeshType& submesh) { lagrange::compute_normal<Scalar, Index>(submesh, angle); },
+                names,
+                make_options(method));
+
+            const auto& result_attr = result.get_indexed_attribute<Scalar>("@normal");
+            auto result_values = lagrange::matrix_view(result_attr.values());
+            auto result_indices = result_attr.indices().get_all();
+            for (Index c = 0; c < mesh.get_num_corners(); ++c) {
+                REQUIRE(result_values.row(result_indices[c])
+                            .isApprox(expected_values.row(expected_indices[c]), 1e-12));
+            }
+        }
+    }
+}
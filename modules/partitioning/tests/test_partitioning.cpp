@@ -11,10 +11,13 @@
  */
 ////////////////////////////////////////////////////////////////////////////////
 #include <lagrange/io/load_mesh.h>
+#include <lagrange/partitioning/partition_mesh.h>
 #include <lagrange/partitioning/partition_mesh_vertices.h>
 
 #include <lagrange/Mesh.h>
 #include <lagrange/testing/common.h>
+
+#include <vector>
 ////////////////////////////////////////////////////////////////////////////////
 
 TEST_CASE("Partitioning: Reproducibility", "[partitioning]" LA_SLOW_DEBUG_FLAG)
@@ -46,3 +49,99 @@ TEST_CASE("Partitioning: Validity", "[partitioning]")
         REQUIRE((p1.array() < k).all());
     }
 }
+
+TEST_CASE("Partitioning: SurfaceMesh", "[partitioning]" LA_SLOW_DEBUG_FLAG)
+{
+    using Scalar = double;
+    using Index = uint32_t;
+    namespace partitioning = lagrange::partitioning;
+
+    auto mesh = lagrange::testing::load_surface_mesh<Scalar, Index>("open/core/bunny_simple.obj");
+    REQUIRE(mesh.get_num_vertices() == 2503);
+    REQUIRE(mesh.get_num_facets() == 5002);
+
+    auto check_partitions = [](const auto& ids, Index k) {
+        std::vector<Index> sizes(std::max<Index>(k, 1), 0);
+        for (Index p : ids) {
+            REQUIRE(p < std::max<Index>(k, 1));
+            ++sizes[p];
+        }
+        return sizes;
+    };
+
+    SECTION("facets")
+    {
+        for (int k : {1, 2, 4, 8, 16}) {
+            partitioning::PartitionOptions options;
+            options.num_partitions = k;
+            auto id = partitioning::partition_mesh_facets(mesh, options);
+            REQUIRE(mesh.get_attribute_name(id) == options.output_attribute_name);
+            REQUIRE(mesh.get_attribute_base(id).get_element_type() == lagrange::Facet);
+            auto p1 = mesh.get_attribute<Index>(id).get_all();
+            std::vector<Index> copy(p1.begin(), p1.end());
+            auto sizes = check_partitions(copy, k);
+            for (Index s : sizes) {
+                REQUIRE(s > 0);
+                REQUIRE(s <= 1.1 * mesh.get_num_facets() / sizes.size());
+            }
+
+            // Reproducibility
+            partitioning::partition_mesh_facets(mesh, options);
+            auto p2 = mesh.get_attribute<Index>(id).get_all();
+            REQUIRE(std::equal(copy.begin(), copy.end(), p2.begin()));
+        }
+    }
+
+    SECTION("vertices")
+    {
+        for (int k : {1, 2, 4, 8, 16, 2503}) {
+            partitioning::PartitionOptions options;
+            options.num_partitions = k;
+            auto id = partitioning::partition_mesh_vertices(mesh, options);
+            REQUIRE(mesh.get_attribute_base(id).get_element_type() == lagrange::Vertex);
+            auto ids = mesh.get_attribute<Index>(id).get_all();
+            check_partitions(ids, k);
+        }
+    }
+
+    SECTION("vertex connectivity")
+    {
+        partitioning::PartitionOptions options;
+        options.num_partitions = 8;
+        options.connectivity_type = lagrange::ConnectivityType::Vertex;
+        auto id = partitioning::partition_mesh_facets(mesh, options);
+        auto sizes = check_partitions(mesh.get_attribute<Index>(id).get_all(), 8);
+        for (Index s : sizes) REQUIRE(s > 0);
+    }
+
+    SECTION("weights")
+    {
+        // Facets in the upper half weigh 3 times as much as the others: the heavier half should be
+        // split across more partitions.
+        auto weight_id = mesh.create_attribute<float>(
+            "weight",
+            lagrange::Facet,
+            lagrange::AttributeUsage::Scalar,
+            1);
+        auto weights = mesh.ref_attribute<float>(weight_id).ref_all();
+        for (Index f = 0; f < mesh.get_num_facets(); ++f) {
+            weights[f] = (f < mesh.get_num_facets() / 2 ? 3.f : 1.f);
+        }
+
+        partitioning::PartitionOptions options;
+        options.num_partitions = 4;
+        options.weight_attribute_name = "weight";
+        auto id = partitioning::partition_mesh_facets(mesh, options);
+        auto ids = mesh.get_attribute<Index>(id).get_all();
+
+        std::vector<double> loads(4, 0);
+        for (Index f = 0; f < mesh.get_num_facets(); ++f) loads[ids[f]] += weights[f];
+        const double total = 2 * mesh.get_num_facets();
+        for (double load : loads) {
+            REQUIRE(load <= 1.1 * total / 4);
+        }
+
+        // Weights must be defined on the partitioned elements.
+        LA_REQUIRE_THROWS(partitioning::partition_mesh_vertices(mesh, options));
+    }
+}
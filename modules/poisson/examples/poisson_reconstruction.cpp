@@ -15,10 +15,132 @@
 #include <lagrange/io/save_mesh.h>
 #include <lagrange/isoline.h>
 #include <lagrange/poisson/mesh_from_oriented_points.h>
+#include <lagrange/poisson/mesh_from_oriented_points_blockwise.h>
 #include <lagrange/utils/assert.h>
 
 #include <CLI/CLI.hpp>
 
+#include <cstring>
+#include <fstream>
+#include <sstream>
+
+namespace {
+
+///
+/// Minimal reader streaming the vertices of a binary little-endian PLY file in chunks. Only
+/// float/double vertex properties are supported, and vertices must be the first element.
+///
+class PlyChunkReader
+{
+public:
+    explicit PlyChunkReader(const std::string& filename)
+        : m_in(filename, std::ios::binary)
+    {
+        std::string line;
+        bool in_vertex = false;
+        size_t offset = 0;
+        while (std::getline(m_in, line)) {
+            if (!line.empty() && line.back() == '\r') line.pop_back();
+            std::istringstream tokens(line);
+            std::string keyword;
+            tokens >> keyword;
+            if (keyword == "format") {
+                std::string format;
+                tokens >> format;
+                m_valid = (format == "binary_little_endian");
+            } else if (keyword == "element") {
+                std::string name;
+                tokens >> name;
+                in_vertex = (name == "vertex" && m_num_vertices == 0 && m_stride == 0);
+                if (in_vertex) tokens >> m_num_vertices;
+            } else if (keyword == "property" && in_vertex) {
+                std::string type, name;
+                tokens >> type >> name;
+                size_t size = (type == "float" || type == "float32") ? 4
+                              : (type == "double" || type == "float64") ? 8
+                                                                        : 0;
+                if (size == 0) m_valid = false;
+                m_properties.push_back({name, offset, size});
+                offset += size;
+                m_stride = offset;
+            } else if (keyword == "end_header") {
+                break;
+            }
+        }
+        for (const char* name : {"x", "y", "z", "nx", "ny", "nz"}) {
+            m_valid &= (find_property(name) != nullptr);
+        }
+    }
+
+    bool is_valid() const { return m_valid; }
+
+    bool read(lagrange::SurfaceMesh32f& chunk, size_t chunk_size)
+    {
+        const size_t n = std::min(chunk_size, m_num_vertices - m_num_read);
+        if (n == 0) return false;
+        std::vector<char> buffer(n * m_stride);
+        m_in.read(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+        la_runtime_assert(m_in.good(), "Failed to read PLY vertices");
+
+        chunk.add_vertices(static_cast<uint32_t>(n));
+        auto id = chunk.create_attribute<float>(
+            "normal",
+            lagrange::AttributeElement::Vertex,
+            lagrange::AttributeUsage::Normal,
+            3);
+        auto positions = chunk.ref_vertex_to_position().ref_all();
+        auto normals = chunk.ref_attribute<float>(id).ref_all();
+        const char* names[] = {"x", "y", "z", "nx", "ny", "nz"};
+        for (size_t i = 0; i < n; ++i) {
+            for (size_t d = 0; d < 6; ++d) {
+                float value = get_value(buffer.data() + i * m_stride, *find_property(names[d]));
+                (d < 3 ? positions[3 * i + d] : normals[3 * i + d - 3]) = value;
+            }
+        }
+        m_num_read += n;
+        return true;
+    }
+
+private:
+    struct Property
+    {
+        std::string name;
+        size_t offset;
+        size_t size;
+    };
+
+    const Property* find_property(const std::string& name) const
+    {
+        for (const auto& p : m_properties) {
+            if (p.name == name) return &p;
+        }
+        return nullptr;
+    }
+
+    static float get_value(const char* data, const Property& p)
+    {
+        if (p.size == 4) {
+            float v;
+            std::memcpy(&v, data + p.offset, sizeof(v));
+            return v;
+        } else {
+            double v;
+            std::memcpy(&v, data + p.offset, sizeof(v));
+            return static_cast<float>(v);
+        }
+    }
+
+private:
+    std::ifstream m_in;
+    bool m_valid = false;
+    size_t m_num_vertices = 0;
+    size_t m_num_read = 0;
+    size_t m_stride = 0;
+    std::vector<Property> m_properties;
+};
+
+} // namespace
+
 int main(int argc, char** argv)
 {
     struct
@@ -27,9 +149,12 @@ int main(int argc, char** argv)
         std::string output = "output.obj";
         bool output_vertex_depth = false;
         std::optional<double> trim_depth;
+        size_t chunk_size = 1 << 20;
     } args;
 
-    lagrange::poisson::ReconstructionOptions recon_options;
+    lagrange::poisson::BlockwiseReconstructionOptions recon_options;
+    recon_options.block_size = 0;
+    std::string scratch_directory;
 
     CLI::App app{argv[0]};
     app.add_option("input", args.input, "Input point cloud.")->required()->check(CLI::ExistingFile);
@@ -50,26 +175,59 @@ int main(int argc, char** argv)
         "Enable outputting of vertex depth.");
     app.add_option("--trim-depth", args.trim_depth, "Trim surface at specified depth.")
         ->needs(depth_opt);
+    app.add_option(
+        "--block-size",
+        recon_options.block_size,
+        "Reconstruct blocks of the given size independently (absolute if positive, relative to "
+        "the bbox diagonal if negative). Binary PLY inputs are streamed when the size is "
+        "absolute.");
+    app.add_option("--overlap", recon_options.overlap, "Block overlap relative to block size.");
+    app.add_option(
+        "--max-points",
+        recon_options.max_points_in_memory,
+        "Max number of points held by concurrently reconstructed blocks.");
+    app.add_option("--scratch-dir", scratch_directory, "Directory where block points are spilled.");
+    app.add_option("--chunk-size", args.chunk_size, "Number of points read per chunk.");
     CLI11_PARSE(app, argc, argv)
 
     if (recon_options.verbose) {
         lagrange::logger().set_level(spdlog::level::debug);
     }
 
-    lagrange::logger().info("Loading input mesh: {}", args.input);
-    auto oriented_points = lagrange::io::load_mesh<lagrange::SurfaceMesh32f>(args.input);
-
-    lagrange::logger().info("Running Poisson surface reconstruction");
+    recon_options.scratch_directory = scratch_directory;
     if (args.output_vertex_depth) {
         recon_options.output_vertex_depth_attribute_name = "value";
     }
 
-    if (auto id = find_matching_attribute(oriented_points, lagrange::AttributeUsage::Color);
-        id.has_value()) {
-        recon_options.interpolated_attribute_name = oriented_points.get_attribute_name(id.value());
+    lagrange::SurfaceMesh32f mesh;
+    if (recon_options.block_size > 0) {
+        PlyChunkReader reader(args.input);
+        if (reader.is_valid()) {
+            lagrange::logger().info("Streaming input point cloud: {}", args.input);
+            mesh = lagrange::poisson::mesh_from_oriented_points_blockwise<float, uint32_t>(
+                [&](lagrange::SurfaceMesh32f& chunk) { return reader.read(chunk, args.chunk_size); },
+                recon_options);
+        }
     }
 
-    auto mesh = lagrange::poisson::mesh_from_oriented_points(oriented_points, recon_options);
+    if (mesh.get_num_vertices() == 0) {
+        lagrange::logger().info("Loading input mesh: {}", args.input);
+        auto oriented_points = lagrange::io::load_mesh<lagrange::SurfaceMesh32f>(args.input);
+
+        lagrange::logger().info("Running Poisson surface reconstruction");
+        if (recon_options.block_size != 0) {
+            mesh = lagrange::poisson::mesh_from_oriented_points_blockwise(
+                oriented_points,
+                recon_options);
+        } else {
+            if (auto id = find_matching_attribute(oriented_points, lagrange::AttributeUsage::Color);
+                id.has_value()) {
+                recon_options.interpolated_attribute_name =
+                    oriented_points.get_attribute_name(id.value());
+            }
+            mesh = lagrange::poisson::mesh_from_oriented_points(oriented_points, recon_options);
+        }
+    }
 
     if (args.trim_depth.has_value()) {
         lagrange::logger().info("Trimming surface at depth = {}", args.trim_depth.value());
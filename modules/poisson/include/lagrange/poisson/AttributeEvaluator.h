@@ -56,7 +56,8 @@ public:
     ~AttributeEvaluator();
 
     ///
-    /// Evaluate the extrapolated attribute at any point in 3D space.
+    /// Evaluate the extrapolated attribute at any point in 3D space. This function is thread-safe,
+    /// and can be called concurrently from tasks running in the current TBB arena.
     ///
     /// @param[in]  pos        Position to evalute at.
     /// @param[in]  out        Output buffer to write the evaluated attribute values.
@@ -67,6 +68,32 @@ public:
     template <typename Scalar, typename ValueType>
     void eval(span<const Scalar> pos, span<ValueType> out) const;
 
+    ///
+    /// Evaluate the extrapolated attribute at a batch of points in 3D space. Queries are sorted
+    /// along a Morton curve, so that consecutive queries processed by the same thread traverse
+    /// nearby octree nodes, and are evaluated in parallel. This function is thread-safe.
+    ///
+    /// @note       Per-thread evaluation data is allocated when the evaluator is constructed, so
+    ///             this function must be called from a task arena whose concurrency does not
+    ///             exceed that of the arena used for construction.
+    ///
+    /// @param[in]  pos        Positions to evaluate at, as a flattened N x 3 array.
+    /// @param[out] out        Output buffer, as a flattened N x C array where C is the number of
+    ///                        attribute channels.
+    ///
+    /// @tparam     Scalar     Point coordinate scalar type.
+    /// @tparam     ValueType  Attribute value type.
+    ///
+    template <typename Scalar, typename ValueType>
+    void batch_eval(span<const Scalar> pos, span<ValueType> out) const;
+
+    ///
+    /// Gets the number of channels of the evaluated attribute.
+    ///
+    /// @return     Number of channels.
+    ///
+    size_t get_num_channels() const;
+
 private:
     struct Impl;
 
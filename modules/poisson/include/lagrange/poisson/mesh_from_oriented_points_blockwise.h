@@ -0,0 +1,97 @@
+/*
+ * Copyright 2025 Adobe. All rights reserved.
+ * This file is licensed to you under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License. You may obtain a copy
+ * of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR REPRESENTATIONS
+ * OF ANY KIND, either express or implied. See the License for the specific language
+ * governing permissions and limitations under the License.
+ */
+#pragma once
+
+#include <lagrange/SurfaceMesh.h>
+#include <lagrange/poisson/mesh_from_oriented_points.h>
+#include <lagrange/utils/function_ref.h>
+
+#include <string_view>
+
+namespace lagrange::poisson {
+
+///
+/// Option struct for blockwise Poisson surface reconstruction.
+///
+struct BlockwiseReconstructionOptions : public ReconstructionOptions
+{
+    /// Edge length of the cubic blocks reconstructed independently. A negative value is
+    /// interpreted as being relative to the bbox diagonal of the input points, which is only
+    /// supported when the input point cloud is held in memory.
+    ///
+    /// @note The octree depth applies to each block, so the effective resolution of the output is
+    /// that of a global reconstruction at depth `octree_depth + log2(#blocks per axis)`.
+    double block_size = -0.25;
+
+    /// Width of the overlap between adjacent blocks, relative to the block size. Each block is
+    /// reconstructed from the points in its extended region, but only keeps the part of the
+    /// surface lying in its own block.
+    double overlap = 0.125;
+
+    /// Maximum number of points held in memory by blocks reconstructed concurrently. Blocks are
+    /// processed in waves that fit this budget (a block larger than the budget is processed
+    /// alone). If 0, all blocks are processed concurrently.
+    size_t max_points_in_memory = 0;
+
+    /// Directory used to spill the points of each block to disk while the input is read. Scratch
+    /// files are named uniquely per reconstruction and removed once read. If empty, block points
+    /// are kept in memory.
+    std::string_view scratch_directory;
+};
+
+///
+/// Creates a triangle mesh from an oriented point cloud streamed in chunks, using a spatially
+/// partitioned Poisson surface reconstruction. Points are binned into overlapping blocks as they
+/// are read, blocks are reconstructed independently under a memory budget, and the block meshes
+/// are stitched along block seams: boundary vertices of adjacent blocks that are mutually closest
+/// are welded in pairs (and averaged), and the small holes left where several blocks meet are
+/// closed.
+///
+/// @note       Interpolated attributes are not supported in blockwise mode.
+///
+/// @param[in]  read_chunk  Function filling a point cloud with the next chunk of oriented points
+///                         (with a normal attribute found the same way as in
+///                         mesh_from_oriented_points()). Returns false once the input is
+///                         exhausted, in which case the chunk is ignored.
+/// @param[in]  options     Reconstruction options. The block size must be absolute.
+///
+/// @tparam     Scalar      Mesh scalar type.
+/// @tparam     Index       Mesh index type.
+///
+/// @return     Reconstructed triangle mesh.
+///
+template <typename Scalar, typename Index>
+SurfaceMesh<Scalar, Index> mesh_from_oriented_points_blockwise(
+    function_ref<bool(SurfaceMesh<Scalar, Index>&)> read_chunk,
+    const BlockwiseReconstructionOptions& options);
+
+///
+/// Creates a triangle mesh from an oriented point cloud using a spatially partitioned Poisson
+/// surface reconstruction. Points are binned directly from the input buffers, without copying the
+/// point cloud.
+///
+/// @param[in]  points   Input point clouds with normal attributes.
+/// @param[in]  options  Reconstruction options.
+///
+/// @tparam     Scalar   Mesh scalar type.
+/// @tparam     Index    Mesh index type.
+///
+/// @return     Reconstructed triangle mesh.
+///
+/// @overload
+///
+template <typename Scalar, typename Index>
+SurfaceMesh<Scalar, Index> mesh_from_oriented_points_blockwise(
+    const SurfaceMesh<Scalar, Index>& points,
+    const BlockwiseReconstructionOptions& options = {});
+
+} // namespace lagrange::poisson
@@ -37,7 +37,12 @@ using namespace lagrange::poisson::threadpool;
 // clang-format on
 
 #include <tbb/enumerable_thread_specific.h>
+#include <tbb/parallel_for.h>
+#include <tbb/parallel_sort.h>
 
+#include <Eigen/Geometry>
+
+#include <algorithm>
 #include <variant>
 
 namespace lagrange::poisson {
@@ -109,6 +114,51 @@ protected:
 template <typename ValueType>
 using Extrapolator = PoissonRecon::Extrapolator::Implicit<ReconScalar, Dim, VectorX<ValueType>>;
 
+// Number of queries evaluated in a row by a task during batch evaluation.
+constexpr size_t s_batch_grain_size = 1024;
+
+// Expands a 21-bit integer into 63 bits by inserting 2 zeros after each bit.
+uint64_t expand_bits(uint64_t v)
+{
+    v &= 0x1fffff;
+    v = (v | v << 32) & 0x1f00000000ffffULL;
+    v = (v | v << 16) & 0x1f0000ff0000ffULL;
+    v = (v | v << 8) & 0x100f00f00f00f00fULL;
+    v = (v | v << 4) & 0x10c30c30c30c30c3ULL;
+    v = (v | v << 2) & 0x1249249249249249ULL;
+    return v;
+}
+
+// Computes an order of the queries along a Morton curve spanning their bounding box.
+template <typename Scalar>
+std::vector<size_t> morton_order(span<const Scalar> pos)
+{
+    const size_t num_queries = pos.size() / Dim;
+    Eigen::AlignedBox<double, 3> bbox;
+    for (size_t i = 0; i < num_queries; ++i) {
+        bbox.extend(Eigen::Vector3d(pos[Dim * i], pos[Dim * i + 1], pos[Dim * i + 2]));
+    }
+    const Eigen::Array3d scale =
+        (bbox.diagonal().array() > 0).select(2097151.0 / bbox.diagonal().array(), 0.0);
+
+    std::vector<std::pair<uint64_t, size_t>> codes(num_queries);
+    tbb::parallel_for(size_t(0), num_queries, [&](size_t i) {
+        uint64_t code = 0;
+        for (unsigned int d = 0; d < Dim; ++d) {
+            const double t = (static_cast<double>(pos[Dim * i + d]) - bbox.min()[d]) * scale[d];
+            code |= expand_bits(static_cast<uint64_t>(std::clamp(t, 0.0, 2097151.0))) << (2 - d);
+        }
+        codes[i] = {code, i};
+    });
+    tbb::parallel_sort(codes.begin(), codes.end());
+
+    std::vector<size_t> order(num_queries);
+    for (size_t i = 0; i < num_queries; ++i) {
+        order[i] = codes[i].second;
+    }
+    return order;
+}
+
 } // namespace
 
 struct AttributeEvaluator::Impl
@@ -118,6 +168,9 @@ struct AttributeEvaluator::Impl
 
     Impl() = default;
     virtual ~Impl() = default;
+
+    size_t num_channels = 0;
+
     Impl(const Impl&) = delete;
     Impl(Impl&&) = delete;
     Impl& operator=(const Impl&) = delete;
@@ -178,6 +231,7 @@ AttributeEvaluator::AttributeEvaluator(
             // The extrapolated attribute field
             m_impl =
                 std::make_unique<Impl::Derived<ValueType>>(std::ref(input_points), e_params, zero);
+            m_impl->num_channels = attribute.get_num_channels();
         }
     });
 }
@@ -204,14 +258,54 @@ void AttributeEvaluator::eval(span<const Scalar> pos, span<ValueType> out) const
     }
 }
 
+template <typename Scalar, typename ValueType>
+void AttributeEvaluator::batch_eval(span<const Scalar> pos, span<ValueType> out) const
+{
+    const size_t num_channels = m_impl->num_channels;
+    la_runtime_assert(pos.size() % Dim == 0, "Query positions must be a N x 3 array");
+    const size_t num_queries = pos.size() / Dim;
+    la_runtime_assert(
+        out.size() == num_queries * num_channels,
+        "Output buffer size must be the number of queries times the number of channels");
+    if (num_queries == 0) return;
+
+    const auto order = morton_order(pos);
+
+    Impl::Derived<ValueType>& impl = static_cast<Impl::Derived<ValueType>&>(*m_impl);
+    tbb::parallel_for(
+        tbb::blocked_range<size_t>(0, num_queries, s_batch_grain_size),
+        [&](const tbb::blocked_range<size_t>& range) {
+            int thread_index = tbb::this_task_arena::current_thread_index();
+            la_runtime_assert(thread_index < tbb::this_task_arena::max_concurrency());
+            auto& aux = impl.aux.local();
+            for (size_t k = range.begin(); k != range.end(); ++k) {
+                const size_t i = order[k];
+                PoissonRecon::Point<ReconScalar, Dim> p(
+                    static_cast<ReconScalar>(pos[Dim * i]),
+                    static_cast<ReconScalar>(pos[Dim * i + 1]),
+                    static_cast<ReconScalar>(pos[Dim * i + 2]));
+                impl.extrapolator.evaluate(thread_index, p, aux);
+                for (size_t c = 0; c < num_channels; ++c) {
+                    out[num_channels * i + c] = aux[c];
+                }
+            }
+        });
+}
+
+size_t AttributeEvaluator::get_num_channels() const
+{
+    return m_impl->num_channels;
+}
+
 #define LA_X_attribute_evaluator(_, Scalar, Index)   \
     template AttributeEvaluator::AttributeEvaluator( \
         const SurfaceMesh<Scalar, Index>& points,    \
         const EvaluatorOptions& options);
 LA_SURFACE_MESH_X(attribute_evaluator, 0)
 
-#define LA_X_eval_func(ValueType, Scalar) \
-    template void AttributeEvaluator::eval(span<const Scalar> pos, span<ValueType> out) const;
+#define LA_X_eval_func(ValueType, Scalar)                                                    \
+    template void AttributeEvaluator::eval(span<const Scalar> pos, span<ValueType> out) const; \
+    template void AttributeEvaluator::batch_eval(span<const Scalar> pos, span<ValueType> out) const;
 #define LA_X_eval_aux(_, ValueType) LA_SURFACE_MESH_SCALAR_X(eval_func, ValueType)
 LA_ATTRIBUTE_SCALAR_X(eval_aux, 0)
 
@@ -0,0 +1,586 @@
+/*
+ * Copyright 2025 Adobe. All rights reserved.
+ * This file is licensed to you under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License. You may obtain a copy
+ * of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR REPRESENTATIONS
+ * OF ANY KIND, either express or implied. See the License for the specific language
+ * governing permissions and limitations under the License.
+ */
+#include <lagrange/poisson/mesh_from_oriented_points_blockwise.h>
+
+#include "octree_depth.h"
+
+#include <lagrange/Attribute.h>
+#include <lagrange/Logger.h>
+#include <lagrange/SurfaceMeshTypes.h>
+#include <lagrange/cast.h>
+#include <lagrange/combine_meshes.h>
+#include <lagrange/extract_submesh.h>
+#include <lagrange/find_matching_attributes.h>
+#include <lagrange/internal/visit_attribute.h>
+#include <lagrange/mesh_bbox.h>
+#include <lagrange/mesh_cleanup/close_small_holes.h>
+#include <lagrange/mesh_cleanup/remove_isolated_vertices.h>
+#include <lagrange/mesh_cleanup/remove_topologically_degenerate_facets.h>
+#include <lagrange/remap_vertices.h>
+#include <lagrange/utils/Error.h>
+#include <lagrange/utils/assert.h>
+#include <lagrange/utils/invalid.h>
+#include <lagrange/views.h>
+
+// clang-format off
+#include <lagrange/utils/warnoff.h>
+#include <tbb/parallel_for.h>
+#include <tbb/task_arena.h>
+#include <lagrange/utils/warnon.h>
+// clang-format on
+
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <map>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace lagrange::poisson {
+
+namespace {
+
+using BlockKey = std::array<int, 3>;
+
+// Number of floats stored per point (position + normal).
+constexpr size_t s_point_stride = 6;
+
+// Number of points buffered per block before being spilled to disk.
+constexpr size_t s_spill_threshold = size_t(1) << 16;
+
+constexpr std::string_view s_normal_attribute_name = "normal";
+
+///
+/// Points binned into overlapping blocks. Each block buffers its points in memory, and spills
+/// them to a scratch file when a scratch directory is provided.
+///
+class BlockStore
+{
+public:
+    struct Block
+    {
+        std::vector<float> buffer;
+        size_t num_points = 0;
+        size_t num_core_points = 0;
+        bool spilled = false;
+    };
+
+public:
+    BlockStore(double block_size, double overlap, std::string_view scratch_directory)
+        : m_block_size(block_size)
+        , m_overlap(overlap)
+        , m_scratch_directory(scratch_directory)
+    {
+        if (!m_scratch_directory.empty()) {
+            // Stores sharing a scratch directory (in this process or another one) must not write
+            // to the same files.
+            static std::atomic<uint64_t> s_num_stores = 0;
+            std::random_device rd;
+            const uint64_t token = (static_cast<uint64_t>(rd()) << 32) ^ rd();
+            m_file_prefix = fmt::format("lagrange_poisson_{:016x}_{}", token, s_num_stores++);
+        }
+    }
+
+    ~BlockStore()
+    {
+        for (const auto& [key, block] : m_blocks) {
+            if (block.spilled) {
+                std::remove(file_path(key).c_str());
+            }
+        }
+    }
+
+    /// Adds a point (position + normal) to every block whose extended region contains it.
+    void add_point(const float* data)
+    {
+        std::array<std::array<int, 2>, 3> candidates;
+        std::array<int, 3> num_candidates;
+        BlockKey core_key;
+        for (int d = 0; d < 3; ++d) {
+            const double t = data[d] / m_block_size;
+            const double cell = std::floor(t);
+            const double frac = t - cell;
+            core_key[d] = static_cast<int>(cell);
+            candidates[d][0] = core_key[d];
+            num_candidates[d] = 1;
+            if (frac < m_overlap) {
+                candidates[d][num_candidates[d]++] = core_key[d] - 1;
+            } else if (frac > 1.0 - m_overlap) {
+                candidates[d][num_candidates[d]++] = core_key[d] + 1;
+            }
+        }
+        for (int i = 0; i < num_candidates[0]; ++i) {
+            for (int j = 0; j < num_candidates[1]; ++j) {
+                for (int k = 0; k < num_candidates[2]; ++k) {
+                    const BlockKey key = {candidates[0][i], candidates[1][j], candidates[2][k]};
+                    auto& block = m_blocks[key];
+                    block.buffer.insert(block.buffer.end(), data, data + s_point_stride);
+                    block.num_points++;
+                    if (key == core_key) {
+                        block.num_core_points++;
+                    }
+                    if (!m_scratch_directory.empty() &&
+                        block.buffer.size() >= s_spill_threshold * s_point_stride) {
+                        spill(key, block);
+                    }
+                }
+            }
+        }
+    }
+
+    /// Moves all buffered points to disk.
+    void flush()
+    {
+        if (m_scratch_directory.empty()) return;
+        for (auto& [key, block] : m_blocks) {
+            spill(key, block);
+        }
+    }
+
+    /// Retrieves (and releases) all the points of a block. Safe to call concurrently on different
+    /// blocks.
+    std::vector<float> take_points(const BlockKey& key)
+    {
+        auto& block = m_blocks.at(key);
+        std::vector<float> points;
+        points.reserve(block.num_points * s_point_stride);
+        if (block.spilled) {
+            std::ifstream in(file_path(key), std::ios::binary);
+            points.resize(block.num_points * s_point_stride - block.buffer.size());
+            in.read(
+                reinterpret_cast<char*>(points.data()),
+                static_cast<std::streamsize>(points.size() * sizeof(float)));
+            la_runtime_assert(in.good(), "Failed to read block points from scratch file");
+            in.close();
+            std::remove(file_path(key).c_str());
+            block.spilled = false;
+        }
+        points.insert(points.end(), block.buffer.begin(), block.buffer.end());
+        block.buffer = {};
+        return points;
+    }
+
+    const std::map<BlockKey, Block>& get_blocks() const { return m_blocks; }
+
+private:
+    void spill(const BlockKey& key, Block& block)
+    {
+        if (block.buffer.empty()) return;
+        // The first spill truncates any stale file, later spills append to it.
+        std::ofstream out(
+            file_path(key),
+            std::ios::binary | (block.spilled ? std::ios::app : std::ios::trunc));
+        out.write(
+            reinterpret_cast<const char*>(block.buffer.data()),
+            static_cast<std::streamsize>(block.buffer.size() * sizeof(float)));
+        la_runtime_assert(out.good(), "Failed to write block points to scratch file");
+        block.buffer = {};
+        block.spilled = true;
+    }
+
+    std::string file_path(const BlockKey& key) const
+    {
+        return fmt::format(
+            "{}/{}_{}_{}_{}.bin",
+            m_scratch_directory,
+            m_file_prefix,
+            key[0],
+            key[1],
+            key[2]);
+    }
+
+private:
+    double m_block_size;
+    double m_overlap;
+    std::string m_scratch_directory;
+    std::string m_file_prefix;
+    std::map<BlockKey, Block> m_blocks;
+};
+
+template <typename Scalar, typename Index>
+void add_points_to_store(
+    const SurfaceMesh<Scalar, Index>& points,
+    const BlockwiseReconstructionOptions& options,
+    BlockStore& store)
+{
+    la_runtime_assert(points.get_dimension() == 3);
+    la_runtime_assert(points.get_num_facets() == 0, "Input mesh must be a point cloud!");
+
+    AttributeId normal_id;
+    if (options.input_normals.empty()) {
+        if (auto res = find_matching_attribute(points, AttributeUsage::Normal)) {
+            normal_id = res.value();
+        } else {
+            throw Error("Input normal attribute not found!");
+        }
+    } else {
+        normal_id = points.get_attribute_id(options.input_normals);
+    }
+
+    auto P = vertex_view(points);
+    internal::visit_attribute_read(points, normal_id, [&](auto&& attribute) {
+        using AttributeType = std::decay_t<decltype(attribute)>;
+        if constexpr (AttributeType::IsIndexed) {
+            throw Error("Input normals cannot be indexed");
+        } else {
+            la_runtime_assert(
+                attribute.get_num_channels() == 3,
+                "Input normals should only have 3 channels");
+            std::array<float, s_point_stride> data;
+            for (Index v = 0; v < points.get_num_vertices(); ++v) {
+                auto n = attribute.get_row(v);
+                for (int d = 0; d < 3; ++d) {
+                    data[d] = static_cast<float>(P(v, d));
+                    data[3 + d] = static_cast<float>(n[d]);
+                }
+                store.add_point(data.data());
+            }
+        }
+    });
+}
+
+///
+/// Reconstructs a single block, and keeps the facets whose centroid lies in the block.
+///
+SurfaceMesh<float, uint32_t> reconstruct_block(
+    const BlockKey& key,
+    std::vector<float> data,
+    double block_size,
+    const ReconstructionOptions& options)
+{
+    const size_t num_points = data.size() / s_point_stride;
+    std::vector<float> positions(3 * num_points);
+    std::vector<float> normals(3 * num_points);
+    for (size_t i = 0; i < num_points; ++i) {
+        for (size_t d = 0; d < 3; ++d) {
+            positions[3 * i + d] = data[s_point_stride * i + d];
+            normals[3 * i + d] = data[s_point_stride * i + 3 + d];
+        }
+    }
+    data = {};
+
+    SurfaceMesh<float, uint32_t> points;
+    points.wrap_as_const_vertices(positions, static_cast<uint32_t>(num_points));
+    points.wrap_as_const_attribute<float>(
+        s_normal_attribute_name,
+        AttributeElement::Vertex,
+        AttributeUsage::Normal,
+        3,
+        normals);
+
+    auto mesh = mesh_from_oriented_points(points, options);
+
+    // Keep facets whose centroid lies in the block (half-open intervals, so that each facet is
+    // owned by exactly one block).
+    std::vector<uint32_t> selected;
+    auto V = vertex_view(mesh);
+    for (uint32_t f = 0; f < mesh.get_num_facets(); ++f) {
+        Eigen::RowVector3d c = Eigen::RowVector3d::Zero();
+        for (auto v : mesh.get_facet_vertices(f)) {
+            c += V.row(v).cast<double>();
+        }
+        c /= static_cast<double>(mesh.get_facet_size(f));
+        bool inside = true;
+        for (int d = 0; d < 3; ++d) {
+            inside &= (static_cast<int>(std::floor(c[d] / block_size)) == key[d]);
+        }
+        if (inside) {
+            selected.push_back(f);
+        }
+    }
+
+    SubmeshOptions submesh_options;
+    submesh_options.map_attributes = true;
+    return extract_submesh<float, uint32_t>(mesh, selected, submesh_options);
+}
+
+///
+/// Welds the seams between block meshes. Only boundary vertices lying in the overlap band around
+/// a block face are considered, and a vertex is welded to the closest seam vertex of another block
+/// only if it is also the closest one from that vertex (and closer than a tolerance). Welds thus
+/// form disjoint pairs, and are never chained across several vertices of the same block. Merged
+/// vertices are averaged, and the small holes left where more than two blocks meet are closed.
+///
+template <typename Scalar, typename Index>
+void weld_block_seams(
+    SurfaceMesh<Scalar, Index>& mesh,
+    span<const size_t> block_vertex_offsets,
+    double block_size,
+    double overlap,
+    double tolerance)
+{
+    const Index num_vertices = mesh.get_num_vertices();
+    const Index invalid_index = invalid<Index>();
+    std::vector<uint8_t> is_boundary(num_vertices, 0);
+    mesh.initialize_edges();
+    for (Index e = 0; e < mesh.get_num_edges(); ++e) {
+        if (mesh.is_boundary_edge(e)) {
+            for (auto v : mesh.get_edge_vertices(e)) {
+                is_boundary[v] = 1;
+            }
+        }
+    }
+    mesh.clear_edges();
+
+    std::vector<size_t> vertex_block(num_vertices);
+    for (size_t b = 0; b + 1 < block_vertex_offsets.size(); ++b) {
+        for (size_t v = block_vertex_offsets[b]; v < block_vertex_offsets[b + 1]; ++v) {
+            vertex_block[v] = b;
+        }
+    }
+
+    // Seam vertices are boundary vertices lying in the overlap band of a block face.
+    auto V = vertex_view(mesh);
+    auto in_overlap_band = [&](Index v) {
+        for (int d = 0; d < 3; ++d) {
+            const double t = static_cast<double>(V(v, d)) / block_size;
+            if (std::abs(t - std::round(t)) <= overlap) return true;
+        }
+        return false;
+    };
+    std::vector<uint8_t> is_seam(num_vertices, 0);
+    for (Index v = 0; v < num_vertices; ++v) {
+        is_seam[v] = is_boundary[v] && in_overlap_band(v);
+    }
+
+    // Hash seam vertices into cells of size `tolerance`.
+    auto cell_of = [&](Index v) {
+        std::array<int64_t, 3> cell;
+        for (int d = 0; d < 3; ++d) {
+            cell[d] = static_cast<int64_t>(std::floor(static_cast<double>(V(v, d)) / tolerance));
+        }
+        return cell;
+    };
+    auto hash_cell = [](const std::array<int64_t, 3>& c) {
+        return (static_cast<uint64_t>(c[0]) * 73856093ULL) ^
+               (static_cast<uint64_t>(c[1]) * 19349663ULL) ^
+               (static_cast<uint64_t>(c[2]) * 83492791ULL);
+    };
+    std::unordered_multimap<uint64_t, Index> cells;
+    for (Index v = 0; v < num_vertices; ++v) {
+        if (is_seam[v]) {
+            cells.emplace(hash_cell(cell_of(v)), v);
+        }
+    }
+
+    // Closest seam vertex of another block within tolerance (ties are broken by index).
+    std::vector<Index> closest(num_vertices, invalid_index);
+    const double sq_tolerance = tolerance * tolerance;
+    for (Index v = 0; v < num_vertices; ++v) {
+        if (!is_seam[v]) continue;
+        const auto c = cell_of(v);
+        double best = sq_tolerance;
+        for (int64_t i = -1; i <= 1; ++i) {
+            for (int64_t j = -1; j <= 1; ++j) {
+                for (int64_t k = -1; k <= 1; ++k) {
+                    auto range = cells.equal_range(hash_cell({c[0] + i, c[1] + j, c[2] + k}));
+                    for (auto it = range.first; it != range.second; ++it) {
+                        const Index u = it->second;
+                        if (vertex_block[u] == vertex_block[v]) continue;
+                        const double sq_dist =
+                            (V.row(u) - V.row(v)).template cast<double>().squaredNorm();
+                        if (sq_dist < best || (sq_dist == best && u < closest[v])) {
+                            best = sq_dist;
+                            closest[v] = u;
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    // Weld mutually closest pairs.
+    std::vector<Index> forward_mapping(num_vertices, invalid_index);
+    Index num_kept = 0;
+    size_t num_welds = 0;
+    for (Index v = 0; v < num_vertices; ++v) {
+        const Index u = closest[v];
+        if (u != invalid_index && u < v && closest[u] == v) {
+            forward_mapping[v] = forward_mapping[u];
+            ++num_welds;
+        } else {
+            forward_mapping[v] = num_kept++;
+        }
+    }
+    logger().debug("Welded {} pairs of seam vertices", num_welds);
+
+    remap_vertices<Scalar, Index>(mesh, forward_mapping);
+    remove_topologically_degenerate_facets(mesh);
+    remove_isolated_vertices(mesh);
+
+    CloseSmallHolesOptions hole_options;
+    hole_options.max_hole_size = 8;
+    close_small_holes(mesh, hole_options);
+}
+
+void check_blockwise_options(const BlockwiseReconstructionOptions& options)
+{
+    la_runtime_assert(options.block_size > 0, "Block size must be positive for streamed inputs");
+    la_runtime_assert(
+        options.overlap >= 0 && options.overlap < 0.5,
+        "Block overlap must be in [0, 0.5)");
+    if (!options.interpolated_attribute_name.empty()) {
+        throw Error("Interpolated attributes are not supported by blockwise reconstruction");
+    }
+}
+
+///
+/// Reconstructs the blocks of a store holding all the input points, and stitches the results.
+///
+template <typename Scalar, typename Index>
+SurfaceMesh<Scalar, Index> reconstruct_and_stitch_blocks(
+    BlockStore& store,
+    size_t num_input_points,
+    const BlockwiseReconstructionOptions& options)
+{
+    store.flush();
+
+    // Blocks with no point in their own region are skipped.
+    std::vector<BlockKey> keys;
+    for (const auto& [key, block] : store.get_blocks()) {
+        if (block.num_core_points > 0) {
+            keys.push_back(key);
+        }
+    }
+    logger().debug(
+        "Binned {} points into {} blocks of size {}",
+        num_input_points,
+        keys.size(),
+        options.block_size);
+
+    // Reconstruct blocks in waves that fit the memory budget.
+    ReconstructionOptions block_options = options;
+    block_options.input_normals = s_normal_attribute_name;
+    const unsigned int max_depth = [&] {
+        unsigned int depth = options.octree_depth;
+        for (const auto& key : keys) {
+            depth = std::max(
+                depth,
+                ensure_octree_depth(options.octree_depth, store.get_blocks().at(key).num_points));
+        }
+        return depth;
+    }();
+
+    std::vector<SurfaceMesh<float, uint32_t>> block_meshes(keys.size());
+    size_t wave_begin = 0;
+    while (wave_begin < keys.size()) {
+        size_t wave_end = wave_begin;
+        size_t wave_points = 0;
+        while (wave_end < keys.size()) {
+            const size_t n = store.get_blocks().at(keys[wave_end]).num_points;
+            if (options.max_points_in_memory > 0 && wave_end > wave_begin &&
+                wave_points + n > options.max_points_in_memory) {
+                break;
+            }
+            wave_points += n;
+            ++wave_end;
+        }
+        logger().debug(
+            "Reconstructing blocks {} to {} ({} points)",
+            wave_begin,
+            wave_end,
+            wave_points);
+
+        tbb::parallel_for(wave_begin, wave_end, [&](size_t b) {
+            // Isolate each block so that waiting threads do not pick up work from another block.
+            tbb::this_task_arena::isolate([&] {
+                block_meshes[b] = reconstruct_block(
+                    keys[b],
+                    store.take_points(keys[b]),
+                    options.block_size,
+                    block_options);
+            });
+        });
+        wave_begin = wave_end;
+    }
+
+    // Stitch blocks.
+    std::vector<size_t> offsets(block_meshes.size() + 1, 0);
+    for (size_t b = 0; b < block_meshes.size(); ++b) {
+        offsets[b + 1] = offsets[b] + block_meshes[b].get_num_vertices();
+    }
+    auto mesh = cast<Scalar, Index>(combine_meshes<float, uint32_t>(
+        block_meshes.size(),
+        [&](size_t b) -> const SurfaceMesh<float, uint32_t>& { return block_meshes[b]; },
+        true));
+    block_meshes.clear();
+
+    // Seam vertices of adjacent blocks approximate the same surface up to about a cell at the
+    // finest octree level of a block.
+    const double extended_size = options.block_size * (1 + 2 * options.overlap);
+    const double tolerance = extended_size / std::ldexp(1.0, static_cast<int>(max_depth));
+    weld_block_seams(mesh, offsets, options.block_size, options.overlap, tolerance);
+
+    return mesh;
+}
+
+} // namespace
+
+template <typename Scalar, typename Index>
+SurfaceMesh<Scalar, Index> mesh_from_oriented_points_blockwise(
+    function_ref<bool(SurfaceMesh<Scalar, Index>&)> read_chunk,
+    const BlockwiseReconstructionOptions& options)
+{
+    check_blockwise_options(options);
+
+    // Stream the input, and bin points into blocks.
+    BlockStore store(options.block_size, options.overlap, options.scratch_directory);
+    size_t num_input_points = 0;
+    while (true) {
+        SurfaceMesh<Scalar, Index> chunk;
+        if (!read_chunk(chunk)) break;
+        num_input_points += chunk.get_num_vertices();
+        add_points_to_store(chunk, options, store);
+    }
+
+    return reconstruct_and_stitch_blocks<Scalar, Index>(store, num_input_points, options);
+}
+
+template <typename Scalar, typename Index>
+SurfaceMesh<Scalar, Index> mesh_from_oriented_points_blockwise(
+    const SurfaceMesh<Scalar, Index>& points,
+    const BlockwiseReconstructionOptions& options)
+{
+    BlockwiseReconstructionOptions block_options = options;
+    if (block_options.block_size <= 0) {
+        const double diag = static_cast<double>(mesh_bbox<3>(points).diagonal().norm());
+        block_options.block_size = std::abs(block_options.block_size) * diag;
+        if (block_options.block_size <= 0) {
+            block_options.block_size = 1;
+        }
+    }
+    check_blockwise_options(block_options);
+
+    // Bin points directly from the input buffers.
+    BlockStore store(block_options.block_size, block_options.overlap, options.scratch_directory);
+    add_points_to_store(points, block_options, store);
+
+    return reconstruct_and_stitch_blocks<Scalar, Index>(
+        store,
+        points.get_num_vertices(),
+        block_options);
+}
+
+#define LA_X_mesh_reconstruction_blockwise(_, Scalar, Index)                  \
+    template SurfaceMesh<Scalar, Index> mesh_from_oriented_points_blockwise( \
+        function_ref<bool(SurfaceMesh<Scalar, Index>&)> read_chunk,           \
+        const BlockwiseReconstructionOptions& options);                       \
+    template SurfaceMesh<Scalar, Index> mesh_from_oriented_points_blockwise( \
+        const SurfaceMesh<Scalar, Index>& points,                             \
+        const BlockwiseReconstructionOptions& options);
+LA_SURFACE_MESH_X(mesh_reconstruction_blockwise, 0)
+
+} // namespace lagrange::poisson
@@ -15,14 +15,19 @@
 #include <lagrange/compute_vertex_normal.h>
 #include <lagrange/find_matching_attributes.h>
 #include <lagrange/internal/constants.h>
+#include <lagrange/fs/filesystem.h>
 #include <lagrange/io/save_mesh.h>
+#include <lagrange/mesh_bbox.h>
 #include <lagrange/poisson/AttributeEvaluator.h>
+#include <lagrange/poisson/mesh_from_oriented_points_blockwise.h>
 #include <lagrange/poisson/mesh_from_oriented_points.h>
 #include <lagrange/testing/common.h>
 #include <lagrange/topology.h>
 #include <lagrange/utils/fmt_eigen.h>
+#include <lagrange/utils/timing.h>
 #include <lagrange/views.h>
 
+#include <catch2/benchmark/catch_benchmark.hpp>
 #include <catch2/catch_test_macros.hpp>
 ////////////////////////////////////////////////////////////////////////////////
 
@@ -234,3 +239,201 @@ TEST_CASE("PoissonRecon: Fibonacci Sphere", "[poisson]")
     REQUIRE(mesh.get_num_vertices() > 4000);
     REQUIRE(mesh.get_num_facets() > 8000);
 }
+
+namespace {
+
+// Copies a range of points and their normals into a new point cloud.
+template <typename Scalar, typename Index>
+lagrange::SurfaceMesh<Scalar, Index>
+extract_points(const lagrange::SurfaceMesh<Scalar, Index>& points, Index begin, Index end)
+{
+    lagrange::SurfaceMesh<Scalar, Index> result;
+    result.add_vertices(end - begin);
+    vertex_ref(result) = vertex_view(points).middleRows(begin, end - begin);
+    auto normal_id = lagrange::find_matching_attribute(points, lagrange::AttributeUsage::Normal);
+    result.template create_attribute<Scalar>(
+        "normals",
+        lagrange::AttributeElement::Vertex,
+        lagrange::AttributeUsage::Normal,
+        3);
+    lagrange::attribute_matrix_ref<Scalar>(result, "normals") =
+        lagrange::attribute_matrix_view<Scalar>(points, normal_id.value())
+            .middleRows(begin, end - begin);
+    return result;
+}
+
+} // namespace
+
+TEST_CASE("PoissonRecon: Blockwise", "[poisson]")
+{
+    using Scalar = float;
+    using Index = uint32_t;
+
+    auto input_mesh = lagrange::testing::load_surface_mesh<Scalar, Index>("open/core/ball.obj");
+    lagrange::compute_vertex_normal(input_mesh);
+    input_mesh.clear_facets();
+    const auto bbox = lagrange::mesh_bbox<3>(input_mesh);
+
+    lagrange::poisson::BlockwiseReconstructionOptions options;
+    options.octree_depth = 5;
+    options.block_size = -0.4;
+
+    // Single-threaded for reproducibility.
+    tbb::task_arena arena(1);
+    auto mesh = arena.execute([&] {
+        return lagrange::poisson::mesh_from_oriented_points_blockwise(input_mesh, options);
+    });
+    REQUIRE(mesh.get_num_facets() > 0);
+    const auto out_bbox = lagrange::mesh_bbox<3>(mesh);
+    const Scalar diag = bbox.diagonal().norm();
+    REQUIRE((out_bbox.min() - bbox.min()).norm() < 0.05f * diag);
+    REQUIRE((out_bbox.max() - bbox.max()).norm() < 0.05f * diag);
+
+    // Block seams must be stitched into a closed surface.
+    REQUIRE(lagrange::is_closed(mesh));
+
+    SECTION("streamed")
+    {
+        // Stream the same points in small chunks, spilling blocks to disk.
+        const std::string scratch = lagrange::fs::temp_directory_path().string();
+        options.scratch_directory = scratch;
+        options.block_size = 0.4 * diag;
+        options.max_points_in_memory = input_mesh.get_num_vertices() / 2;
+
+        const Index chunk_size = 1000;
+        Index next = 0;
+        auto streamed = arena.execute([&] {
+            return lagrange::poisson::mesh_from_oriented_points_blockwise<Scalar, Index>(
+                [&](lagrange::SurfaceMesh<Scalar, Index>& chunk) {
+                    if (next >= input_mesh.get_num_vertices()) return false;
+                    const Index end = std::min(next + chunk_size, input_mesh.get_num_vertices());
+                    chunk = extract_points(input_mesh, next, end);
+                    next = end;
+                    return true;
+                },
+                options);
+        });
+        REQUIRE(vertex_view(streamed) == vertex_view(mesh));
+        REQUIRE(facet_view(streamed) == facet_view(mesh));
+    }
+}
+
+namespace {
+
+using QueryMatrix = Eigen::Matrix<double, Eigen::Dynamic, 3, Eigen::RowMajor>;
+
+// Samples query points uniformly in the bounding box of a mesh.
+template <typename Scalar, typename Index>
+QueryMatrix random_queries(const lagrange::SurfaceMesh<Scalar, Index>& mesh, Eigen::Index n)
+{
+    const auto bbox = lagrange::mesh_bbox<3>(mesh).template cast<double>();
+    QueryMatrix queries = (QueryMatrix::Random(n, 3).array() + 1) * 0.5;
+    queries = (queries.array().rowwise() * bbox.sizes().transpose().array()).rowwise() +
+              bbox.min().transpose().array();
+    return queries;
+}
+
+} // namespace
+
+TEST_CASE("PoissonRecon: Batch Attribute Evaluator", "[poisson]")
+{
+    using Scalar = float;
+    using Index = uint32_t;
+
+    auto input_mesh =
+        lagrange::testing::load_surface_mesh<Scalar, Index>("open/poisson/sphere.striped.ply");
+
+    lagrange::cast_attribute_in_place<Scalar>(input_mesh, "Vertex_Color");
+    lagrange::attribute_matrix_ref<Scalar>(input_mesh, "Vertex_Color") /= 255.f;
+
+    lagrange::poisson::EvaluatorOptions eval_options;
+    eval_options.interpolated_attribute_name = "Vertex_Color";
+    eval_options.octree_depth = 5;
+
+    auto evaluator = lagrange::poisson::AttributeEvaluator(input_mesh, eval_options);
+    REQUIRE(evaluator.get_num_channels() == 3);
+
+    // Query points in random order, so that the batch evaluation has to reorder them.
+    const auto queries = random_queries(input_mesh, 5000);
+    const Eigen::Index num_queries = queries.rows();
+
+    Eigen::Matrix<Scalar, Eigen::Dynamic, 3, Eigen::RowMajor> expected(num_queries, 3);
+    for (Eigen::Index i = 0; i < num_queries; ++i) {
+        evaluator.eval<double, Scalar>({queries.row(i).data(), 3}, {expected.row(i).data(), 3});
+    }
+
+    Eigen::Matrix<Scalar, Eigen::Dynamic, 3, Eigen::RowMajor> colors(num_queries, 3);
+    evaluator.batch_eval<double, Scalar>(
+        {queries.data(), static_cast<size_t>(queries.size())},
+        {colors.data(), static_cast<size_t>(colors.size())});
+    REQUIRE(colors == expected);
+
+    SECTION("Empty batch")
+    {
+        evaluator.batch_eval<double, Scalar>({}, {});
+    }
+
+    SECTION("Mismatched output size")
+    {
+        LA_REQUIRE_THROWS(evaluator.batch_eval<double, Scalar>(
+            {queries.data(), static_cast<size_t>(queries.size())},
+            {colors.data(), static_cast<size_t>(colors.size() - 1)}));
+    }
+}
+
+TEST_CASE("PoissonRecon: Batch Attribute Evaluator Benchmark", "[poisson][!benchmark]")
+{
+    using Scalar = float;
+    using Index = uint32_t;
+
+    auto input_mesh =
+        lagrange::testing::load_surface_mesh<Scalar, Index>("open/poisson/sphere.striped.ply");
+
+    lagrange::cast_attribute_in_place<Scalar>(input_mesh, "Vertex_Color");
+    lagrange::attribute_matrix_ref<Scalar>(input_mesh, "Vertex_Color") /= 255.f;
+
+    lagrange::poisson::EvaluatorOptions eval_options;
+    eval_options.interpolated_attribute_name = "Vertex_Color";
+    eval_options.octree_depth = 7;
+    auto evaluator = lagrange::poisson::AttributeEvaluator(input_mesh, eval_options);
+
+    const auto queries = random_queries(input_mesh, 1000000);
+    const Eigen::Index num_queries = queries.rows();
+    Eigen::Matrix<Scalar, Eigen::Dynamic, 3, Eigen::RowMajor> colors(num_queries, 3);
+
+    auto serial_eval = [&] {
+        for (Eigen::Index i = 0; i < num_queries; ++i) {
+            evaluator.eval<double, Scalar>({queries.row(i).data(), 3}, {colors.row(i).data(), 3});
+        }
+    };
+    auto batch_eval = [&] {
+        evaluator.batch_eval<double, Scalar>(
+            {queries.data(), static_cast<size_t>(queries.size())},
+            {colors.data(), static_cast<size_t>(colors.size())});
+    };
+
+    // Report throughput, which is what matters for resampling large point sets.
+    auto report_throughput = [&](std::string_view name, auto&& func) {
+        auto start = lagrange::get_timestamp();
+        func();
+        const double duration = lagrange::timestamp_diff_in_seconds(start);
+        lagrange::logger().info(
+            "{}: {:.3g} queries/s",
+            name,
+            static_cast<double>(num_queries) / duration);
+    };
+    report_throughput("eval", serial_eval);
+    report_throughput("batch_eval", batch_eval);
+
+    BENCHMARK("eval")
+    {
+        serial_eval();
+        return colors(0, 0);
+    };
+
+    BENCHMARK("batch_eval")
+    {
+        batch_eval();
+        return colors(0, 0);
+    };
+}
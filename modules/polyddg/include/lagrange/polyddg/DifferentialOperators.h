@@ -16,6 +16,8 @@
 #include <Eigen/Core>
 #include <Eigen/Sparse>
 
+#include <memory>
+
 namespace lagrange::polyddg {
 
 /// @addtogroup module-polyddg
@@ -38,6 +40,7 @@ class DifferentialOperators
 {
 public:
     using Vector = Eigen::Matrix<Scalar, 1, 3>;
+    using VectorX = Eigen::Matrix<Scalar, Eigen::Dynamic, 1>;
 
 public:
     ///
@@ -396,6 +399,51 @@ public:
     ///
     Eigen::SparseMatrix<Scalar> connection_laplacian_nrosy(Index n, Scalar lambda = 1) const;
 
+public:
+    ///
+    /// Apply the discrete weak-form Laplacian operator without assembling it.
+    ///
+    /// Computes @f$ y = \Delta x @f$, where @f$ \Delta @f$ is the matrix returned by laplacian(). The
+    /// per-facet operators are recomputed on the fly, so this trades computation for memory, which
+    /// is useful to run iterative solvers on very large meshes.
+    ///
+    /// @param[in]  x      Input per-vertex values (size #V).
+    /// @param[out] y      Output per-vertex values (size #V).
+    /// @param[in]  lambda Weight of projection term for the 1-form inner product (default: 1).
+    ///
+    void apply_laplacian(
+        Eigen::Ref<const VectorX> x,
+        Eigen::Ref<VectorX> y,
+        Scalar lambda = 1) const;
+
+    ///
+    /// Apply the connection Laplacian operator without assembling it.
+    ///
+    /// Computes @f$ y = L x @f$, where @f$ L @f$ is the matrix returned by connection_laplacian().
+    ///
+    /// @param[in]  x      Input per-vertex tangent vectors (size #V * 2).
+    /// @param[out] y      Output per-vertex tangent vectors (size #V * 2).
+    /// @param[in]  lambda Weight of projection term for the 1-form inner product (default: 1).
+    ///
+    void apply_connection_laplacian(
+        Eigen::Ref<const VectorX> x,
+        Eigen::Ref<VectorX> y,
+        Scalar lambda = 1) const;
+
+    ///
+    /// n-rosy variant of apply_connection_laplacian().
+    ///
+    /// @param[in]  x      Input per-vertex tangent vectors (size #V * 2).
+    /// @param[out] y      Output per-vertex tangent vectors (size #V * 2).
+    /// @param[in]  n      Symmetry order of the rosy field (applies the connection n times).
+    /// @param[in]  lambda Weight of projection term for the 1-form inner product (default: 1).
+    ///
+    void apply_connection_laplacian_nrosy(
+        Eigen::Ref<const VectorX> x,
+        Eigen::Ref<VectorX> y,
+        Index n,
+        Scalar lambda = 1) const;
+
 public:
     ///
     /// Compute the per-corner gradient vectors for a single facet (Eq. (8), de Goes et al. 2020).
@@ -749,6 +797,11 @@ private:
     AttributeId m_vector_area_id = invalid_attribute_id();
     AttributeId m_centroid_id = invalid_attribute_id();
     AttributeId m_vertex_normal_id = invalid_attribute_id();
+
+    // Sparsity patterns of the operators assembled from per-facet blocks, computed on first use
+    // and shared between copies.
+    struct AssemblyCache;
+    std::shared_ptr<AssemblyCache> m_assembly_cache;
 };
 
 /// @}
@@ -18,6 +18,10 @@
 #include <cstdint>
 #include <string_view>
 
+namespace lagrange::solver {
+class SolverCache;
+} // namespace lagrange::solver
+
 namespace lagrange::polyddg {
 
 /// @addtogroup module-polyddg
@@ -52,6 +56,12 @@ struct SmoothDirectionFieldOptions
 
     /// Output attribute name for the smooth direction field (3-D vector, per vertex).
     std::string_view direction_field_attribute = "@smooth_direction_field";
+
+    /// Optional cache of factorized solvers. When provided, the factorization of the shifted
+    /// Laplacian is reused across calls with the same mesh and parameters (e.g. when only the
+    /// alignment constraints change), and its symbolic analysis as long as the connectivity is
+    /// unchanged.
+    solver::SolverCache* solver_cache = nullptr;
 };
 
 ///
@@ -18,6 +18,10 @@
 #include <cstdint>
 #include <string_view>
 
+namespace lagrange::solver {
+class SolverCache;
+} // namespace lagrange::solver
+
 namespace lagrange::polyddg {
 
 /// @addtogroup module-polyddg
@@ -61,6 +65,12 @@ struct HodgeDecompositionOptions
     /// - For hodge_decomposition_1_form(): per-edge scalar
     /// - For hodge_decomposition_vector_field(): per-vertex 3D vector (global coordinates)
     std::string_view harmonic_attribute = "@hodge_harmonic";
+
+    /// Optional cache of factorized solvers. When provided, the scalar Laplacian factorization is
+    /// reused across calls on the same mesh with the same lambda (the symbolic analysis is reused
+    /// as long as the connectivity is unchanged). The cache must use SolverMode::Direct, as the
+    /// constrained Laplacian system is indefinite.
+    solver::SolverCache* solver_cache = nullptr;
 };
 
 ///
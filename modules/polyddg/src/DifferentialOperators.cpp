@@ -11,6 +11,8 @@
  */
 #include <lagrange/polyddg/DifferentialOperators.h>
 
+#include "FacetAssembler.h"
+
 #include <lagrange/utils/warning.h>
 
 // Include early so we can explicitly silence warnings from Eigen.
@@ -29,7 +31,12 @@ LA_IGNORE_MAYBE_UNINITIALIZED_END
 #include <lagrange/utils/invalid.h>
 #include <lagrange/views.h>
 
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+
 #include <limits>
+#include <memory>
+#include <mutex>
 #include <vector>
 
 namespace lagrange::polyddg {
@@ -105,14 +112,104 @@ Eigen::SparseMatrix<Scalar> kronecker_product_I2(const Eigen::SparseMatrix<Scala
     return K;
 }
 
+///
+/// Apply a per-vertex operator defined as a sum of dense per-facet blocks, without assembling it.
+///
+/// Each facet block is applied to the facet values and the results are stored per corner, before
+/// being gathered around each vertex. Both passes run in parallel and are deterministic.
+///
+/// @param[in]  mesh         Input mesh (with edge information).
+/// @param[in]  block_size   Number of values per vertex.
+/// @param[in]  x            Input per-vertex values.
+/// @param[out] y            Output per-vertex values.
+/// @param[in]  local_block  Function computing the dense block of a facet.
+///
+template <typename Scalar, typename Index, typename LocalBlockFunc>
+void apply_per_facet_vertex_operator(
+    const SurfaceMesh<Scalar, Index>& mesh,
+    Index block_size,
+    Eigen::Ref<const Eigen::Matrix<Scalar, Eigen::Dynamic, 1>> x,
+    Eigen::Ref<Eigen::Matrix<Scalar, Eigen::Dynamic, 1>> y,
+    LocalBlockFunc&& local_block)
+{
+    using VectorX = Eigen::Matrix<Scalar, Eigen::Dynamic, 1>;
+    const Index num_vertices = mesh.get_num_vertices();
+    const Eigen::Index size = static_cast<Eigen::Index>(num_vertices) * block_size;
+    la_runtime_assert(x.size() == size, "Input vector has an invalid size.");
+    la_runtime_assert(y.size() == size, "Output vector has an invalid size.");
+
+    std::vector<Scalar> corner_values(static_cast<size_t>(mesh.get_num_corners()) * block_size);
+    tbb::parallel_for(
+        tbb::blocked_range<Index>(0, mesh.get_num_facets()),
+        [&](const tbb::blocked_range<Index>& range) {
+            VectorX xf, yf;
+            for (Index fid = range.begin(); fid != range.end(); ++fid) {
+                const Index facet_size = mesh.get_facet_size(fid);
+                const Index c_begin = mesh.get_facet_corner_begin(fid);
+                xf.resize(facet_size * block_size);
+                for (Index lv = 0; lv < facet_size; ++lv) {
+                    const Index vid = mesh.get_facet_vertex(fid, lv);
+                    xf.segment(lv * block_size, block_size) =
+                        x.segment(vid * block_size, block_size);
+                }
+                yf.noalias() = local_block(fid) * xf;
+                std::copy_n(
+                    yf.data(),
+                    facet_size * block_size,
+                    corner_values.data() + static_cast<size_t>(c_begin) * block_size);
+            }
+        });
+
+    tbb::parallel_for(
+        tbb::blocked_range<Index>(0, num_vertices),
+        [&](const tbb::blocked_range<Index>& range) {
+            for (Index vid = range.begin(); vid != range.end(); ++vid) {
+                auto yv = y.segment(vid * block_size, block_size);
+                yv.setZero();
+                mesh.foreach_corner_around_vertex(vid, [&](Index cid) {
+                    for (Index k = 0; k < block_size; ++k) {
+                        yv[k] += corner_values[static_cast<size_t>(cid) * block_size + k];
+                    }
+                });
+            }
+        });
+}
+
 } // namespace
 
+// Sparsity patterns of operators assembled from per-facet blocks.
+template <typename Scalar, typename Index>
+struct DifferentialOperators<Scalar, Index>::AssemblyCache
+{
+    using Assembler = FacetAssembler<Scalar, Index>;
+
+    std::mutex mutex;
+    std::unique_ptr<Assembler> vertex_assembler; // #V x #V
+    std::unique_ptr<Assembler> vertex_block_assembler; // #V * 2 x #V * 2
+    std::unique_ptr<Assembler> edge_assembler; // #E x #E
+
+    const Assembler& get(
+        std::unique_ptr<Assembler>& assembler,
+        const SurfaceMesh<Scalar, Index>& mesh,
+        Index num_elements,
+        Index block_size,
+        function_ref<Index(Index, Index)> element_of)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (!assembler) {
+            assembler = std::make_unique<Assembler>(mesh, num_elements, block_size, element_of);
+        }
+        return *assembler;
+    }
+};
+
 // Constructor
 template <typename Scalar, typename Index>
 DifferentialOperators<Scalar, Index>::DifferentialOperators(SurfaceMesh<Scalar, Index>& mesh)
     : m_mesh(mesh)
     , m_vector_area_id(invalid<AttributeId>())
     , m_centroid_id(invalid<AttributeId>())
+    , m_assembly_cache(std::make_shared<AssemblyCache>())
 {
     la_runtime_assert(m_mesh.get_dimension() == 3, "Only 3D meshes are supported.");
     m_mesh.initialize_edges();
@@ -400,39 +497,15 @@ template <typename Scalar, typename Index>
 Eigen::SparseMatrix<Scalar> DifferentialOperators<Scalar, Index>::inner_product_1_form(
     Scalar lambda) const
 {
-    auto vec_area = attribute_matrix_view<Scalar>(m_mesh, m_vector_area_id);
-    const Index num_edges = m_mesh.get_num_edges();
-    const Index num_facets = m_mesh.get_num_facets();
-    std::vector<Eigen::Triplet<Scalar>> entries;
-    Index total_triplets = 0;
-    for (Index fid = 0; fid < num_facets; fid++) {
-        total_triplets += m_mesh.get_facet_size(fid) * m_mesh.get_facet_size(fid);
-    }
-    entries.reserve(total_triplets);
-
-    for (Index fid = 0; fid < num_facets; fid++) {
-        const Index facet_size = m_mesh.get_facet_size(fid);
-        const Scalar area = vec_area.row(fid).norm();
-        auto Uf = sharp(fid);
-        auto Pf = projection(fid);
-
-        auto Mf = area * Uf.transpose() * Uf + lambda * Pf.transpose() * Pf;
-        for (Index lv = 0; lv < facet_size; lv++) {
-            Index eid = m_mesh.get_edge(fid, lv);
-            for (Index lv2 = 0; lv2 < facet_size; lv2++) {
-                Index eid2 = m_mesh.get_edge(fid, lv2);
-                entries.push_back(
-                    Eigen::Triplet<Scalar>(
-                        static_cast<Eigen::Index>(eid),
-                        static_cast<Eigen::Index>(eid2),
-                        Mf(lv, lv2)));
-            }
-        }
-    }
-
-    Eigen::SparseMatrix<Scalar> M(num_edges, num_edges);
-    M.setFromTriplets(entries.begin(), entries.end());
-    return M;
+    const auto& mesh = m_mesh;
+    const auto& assembler = m_assembly_cache->get(
+        m_assembly_cache->edge_assembler,
+        mesh,
+        mesh.get_num_edges(),
+        1,
+        [&](Index fid, Index lv) { return mesh.get_edge(fid, lv); });
+    return assembler.assemble(
+        [&](Index fid) { return inner_product_1_form(fid, lambda); });
 }
 
 // inner_product_2_form
@@ -497,12 +570,18 @@ Eigen::SparseMatrix<Scalar> DifferentialOperators<Scalar, Index>::curl() const
 }
 
 // laplacian
+// Assembled directly from the per-facet blocks d0(f)ᵀ · M₁(f) · d0(f), which sum to d0ᵀ · M₁ · d0.
 template <typename Scalar, typename Index>
 Eigen::SparseMatrix<Scalar> DifferentialOperators<Scalar, Index>::laplacian(Scalar lambda) const
 {
-    auto D0 = d0();
-    auto M = inner_product_1_form(lambda);
-    return D0.transpose() * M * D0;
+    const auto& mesh = m_mesh;
+    const auto& assembler = m_assembly_cache->get(
+        m_assembly_cache->vertex_assembler,
+        mesh,
+        mesh.get_num_vertices(),
+        1,
+        [&](Index fid, Index lv) { return mesh.get_facet_vertex(fid, lv); });
+    return assembler.assemble([&](Index fid) { return laplacian(fid, lambda); });
 }
 
 // co-differential δ₁ : Ω¹ → Ω⁰  (size #V × #E)
@@ -755,53 +834,50 @@ Eigen::SparseMatrix<Scalar> DifferentialOperators<Scalar, Index>::connection_lap
     Index n,
     Scalar lambda) const
 {
-    auto vec_area = attribute_matrix_view<Scalar>(m_mesh, m_vector_area_id);
-
-    Index num_vertices = m_mesh.get_num_vertices();
-    Index num_facets = m_mesh.get_num_facets();
-
-    std::vector<Eigen::Triplet<Scalar>> entries;
-    size_t total_triplets = 0;
-    for (Index fid = 0; fid < num_facets; fid++) {
-        Index facet_size = m_mesh.get_facet_size(fid);
-        total_triplets += 4 * facet_size * facet_size;
-    }
-    entries.reserve(total_triplets);
+    const auto& mesh = m_mesh;
+    const auto& assembler = m_assembly_cache->get(
+        m_assembly_cache->vertex_block_assembler,
+        mesh,
+        mesh.get_num_vertices(),
+        2,
+        [&](Index fid, Index lv) { return mesh.get_facet_vertex(fid, lv); });
+    return assembler.assemble(
+        [&](Index fid) { return connection_laplacian_nrosy(fid, n, lambda); });
+}
 
-    for (Index fid = 0; fid < num_facets; fid++) {
-        Scalar a = vec_area.row(fid).norm();
-        auto G_cov = covariant_derivative_nrosy(fid, n);
-        auto P_cov = covariant_projection_nrosy(fid, n);
-        auto L_c = a * G_cov.transpose() * G_cov + lambda * P_cov.transpose() * P_cov;
+// Matrix-free Laplacian
+template <typename Scalar, typename Index>
+void DifferentialOperators<Scalar, Index>::apply_laplacian(
+    Eigen::Ref<const VectorX> x,
+    Eigen::Ref<VectorX> y,
+    Scalar lambda) const
+{
+    apply_per_facet_vertex_operator<Scalar, Index>(m_mesh, 1, x, y, [&](Index fid) {
+        return laplacian(fid, lambda);
+    });
+}
 
-        Index facet_size = m_mesh.get_facet_size(fid);
-        for (Index lv0 = 0; lv0 < facet_size; lv0++) {
-            Index v0 = m_mesh.get_facet_vertex(fid, lv0);
-            for (Index lv1 = 0; lv1 < facet_size; lv1++) {
-                Index v1 = m_mesh.get_facet_vertex(fid, lv1);
-                entries.emplace_back(
-                    static_cast<Eigen::Index>(v0 * 2),
-                    static_cast<Eigen::Index>(v1 * 2),
-                    L_c(lv0 * 2, lv1 * 2));
-                entries.emplace_back(
-                    static_cast<Eigen::Index>(v0 * 2),
-                    static_cast<Eigen::Index>(v1 * 2 + 1),
-                    L_c(lv0 * 2, lv1 * 2 + 1));
-                entries.emplace_back(
-                    static_cast<Eigen::Index>(v0 * 2 + 1),
-                    static_cast<Eigen::Index>(v1 * 2),
-                    L_c(lv0 * 2 + 1, lv1 * 2));
-                entries.emplace_back(
-                    static_cast<Eigen::Index>(v0 * 2 + 1),
-                    static_cast<Eigen::Index>(v1 * 2 + 1),
-                    L_c(lv0 * 2 + 1, lv1 * 2 + 1));
-            }
-        }
-    }
+// Matrix-free connection Laplacian
+template <typename Scalar, typename Index>
+void DifferentialOperators<Scalar, Index>::apply_connection_laplacian(
+    Eigen::Ref<const VectorX> x,
+    Eigen::Ref<VectorX> y,
+    Scalar lambda) const
+{
+    apply_connection_laplacian_nrosy(x, y, 1, lambda);
+}
 
-    Eigen::SparseMatrix<Scalar> Lc(num_vertices * 2, num_vertices * 2);
-    Lc.setFromTriplets(entries.begin(), entries.end());
-    return Lc;
+// Matrix-free connection Laplacian for n-rosy fields
+template <typename Scalar, typename Index>
+void DifferentialOperators<Scalar, Index>::apply_connection_laplacian_nrosy(
+    Eigen::Ref<const VectorX> x,
+    Eigen::Ref<VectorX> y,
+    Index n,
+    Scalar lambda) const
+{
+    apply_per_facet_vertex_operator<Scalar, Index>(m_mesh, 2, x, y, [&](Index fid) {
+        return connection_laplacian_nrosy(fid, n, lambda);
+    });
 }
 
 // Per-facet gradient operator — stacks per-corner gradient vectors column-wise.
@@ -0,0 +1,197 @@
+/*
+ * Copyright 2025 Adobe. All rights reserved.
+ * This file is licensed to you under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License. You may obtain a copy
+ * of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR REPRESENTATIONS
+ * OF ANY KIND, either express or implied. See the License for the specific language
+ * governing permissions and limitations under the License.
+ */
+#pragma once
+
+#include <lagrange/SurfaceMesh.h>
+#include <lagrange/utils/assert.h>
+#include <lagrange/utils/function_ref.h>
+
+#include <Eigen/Core>
+#include <Eigen/Sparse>
+
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <tbb/parallel_sort.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <vector>
+
+namespace lagrange::polyddg {
+
+///
+/// Parallel assembly of square sparse matrices from dense per-facet blocks.
+///
+/// Each facet contributes a dense block of size (b * k) x (b * k), where k is the facet size and b
+/// the block size, coupling the global elements (vertices or edges) associated with its k local
+/// elements. The sparsity pattern and the mapping from local block entries to global nonzeros are
+/// computed once, so that the matrix can be reassembled in parallel without building or sorting
+/// triplets. The result is deterministic: contributions to each nonzero are summed in facet order.
+///
+template <typename Scalar, typename Index>
+class FacetAssembler
+{
+public:
+    using MatrixType = Eigen::SparseMatrix<Scalar>;
+    using StorageIndex = typename MatrixType::StorageIndex;
+    using LocalMatrix = Eigen::Matrix<Scalar, Eigen::Dynamic, Eigen::Dynamic>;
+
+public:
+    ///
+    /// Computes the sparsity pattern and assembly mapping.
+    ///
+    /// @param[in]  mesh          Input mesh.
+    /// @param[in]  num_elements  Number of global elements.
+    /// @param[in]  block_size    Number of rows/columns per element.
+    /// @param[in]  element_of    Global element associated with a local element of a facet.
+    ///
+    FacetAssembler(
+        const SurfaceMesh<Scalar, Index>& mesh,
+        Index num_elements,
+        Index block_size,
+        function_ref<Index(Index fid, Index lv)> element_of)
+        : m_mesh(mesh)
+        , m_block_size(block_size)
+        , m_size(static_cast<Eigen::Index>(num_elements) * block_size)
+    {
+        const Index num_facets = mesh.get_num_facets();
+        m_local_offsets.assign(num_facets + 1, 0);
+        for (Index fid = 0; fid < num_facets; ++fid) {
+            const size_t n = static_cast<size_t>(mesh.get_facet_size(fid) * block_size);
+            m_local_offsets[fid + 1] = m_local_offsets[fid] + n * n;
+        }
+        const size_t num_local = m_local_offsets.back();
+
+        la_runtime_assert(
+            num_local <= size_t(std::numeric_limits<uint32_t>::max()),
+            "FacetAssembler: too many local entries.");
+
+        // Key each local entry by its global (column, row) position. Local entries are stored
+        // row-major within their facet block.
+        const uint64_t size = static_cast<uint64_t>(m_size);
+        std::vector<uint64_t> keys(num_local);
+        tbb::parallel_for(
+            tbb::blocked_range<Index>(0, num_facets),
+            [&](const tbb::blocked_range<Index>& range) {
+                for (Index fid = range.begin(); fid != range.end(); ++fid) {
+                    const Index k = mesh.get_facet_size(fid) * block_size;
+                    size_t offset = m_local_offsets[fid];
+                    for (Index i = 0; i < k; ++i) {
+                        const uint64_t row =
+                            uint64_t(element_of(fid, i / block_size)) * block_size +
+                            i % block_size;
+                        for (Index j = 0; j < k; ++j, ++offset) {
+                            const uint64_t col =
+                                uint64_t(element_of(fid, j / block_size)) * block_size +
+                                j % block_size;
+                            keys[offset] = col * size + row;
+                        }
+                    }
+                }
+            });
+
+        // Sort the local entries by key, then by offset, so that each nonzero gathers its
+        // contributions in facet order.
+        m_gather.resize(num_local);
+        std::iota(m_gather.begin(), m_gather.end(), uint32_t(0));
+        tbb::parallel_sort(m_gather.begin(), m_gather.end(), [&](uint32_t a, uint32_t b) {
+            return keys[a] < keys[b] || (keys[a] == keys[b] && a < b);
+        });
+
+        // Compressed column pattern, and the groups of local entries summed into each nonzero.
+        m_outer.assign(m_size + 1, 0);
+        m_inner.clear();
+        m_nonzero_offsets.clear();
+        for (size_t t = 0; t < num_local; ++t) {
+            const uint64_t key = keys[m_gather[t]];
+            if (t == 0 || key != keys[m_gather[t - 1]]) {
+                la_runtime_assert(
+                    m_inner.size() < size_t(std::numeric_limits<StorageIndex>::max()),
+                    "FacetAssembler: too many nonzeros.");
+                const uint64_t col = key / size;
+                const uint64_t row = key % size;
+                m_inner.push_back(static_cast<StorageIndex>(row));
+                m_nonzero_offsets.push_back(static_cast<uint32_t>(t));
+                ++m_outer[col + 1];
+            }
+        }
+        m_nonzero_offsets.push_back(static_cast<uint32_t>(num_local));
+        for (Eigen::Index c = 0; c < m_size; ++c) m_outer[c + 1] += m_outer[c];
+    }
+
+    ///
+    /// Assembles the matrix from per-facet blocks.
+    ///
+    /// @param[in]  local_matrix  Function computing the dense block of a facet. It is called
+    ///                           concurrently from multiple threads.
+    ///
+    /// @return     Assembled sparse matrix.
+    ///
+    MatrixType assemble(function_ref<LocalMatrix(Index fid)> local_matrix) const
+    {
+        const Index num_facets = m_mesh.get_num_facets();
+        std::vector<Scalar> local_values(m_local_offsets.back());
+        tbb::parallel_for(
+            tbb::blocked_range<Index>(0, num_facets),
+            [&](const tbb::blocked_range<Index>& range) {
+                for (Index fid = range.begin(); fid != range.end(); ++fid) {
+                    const LocalMatrix Lf = local_matrix(fid);
+                    const Eigen::Index k = m_mesh.get_facet_size(fid) * m_block_size;
+                    la_debug_assert(Lf.rows() == k && Lf.cols() == k);
+                    size_t offset = m_local_offsets[fid];
+                    for (Eigen::Index i = 0; i < k; ++i) {
+                        for (Eigen::Index j = 0; j < k; ++j) {
+                            local_values[offset++] = Lf(i, j);
+                        }
+                    }
+                }
+            });
+
+        const size_t nnz = m_inner.size();
+        MatrixType M(m_size, m_size);
+        M.resizeNonZeros(static_cast<Eigen::Index>(nnz));
+        std::copy(m_outer.begin(), m_outer.end(), M.outerIndexPtr());
+        std::copy(m_inner.begin(), m_inner.end(), M.innerIndexPtr());
+        Scalar* values = M.valuePtr();
+        tbb::parallel_for(tbb::blocked_range<size_t>(0, nnz), [&](const auto& range) {
+            for (size_t e = range.begin(); e != range.end(); ++e) {
+                Scalar sum = 0;
+                for (size_t t = m_nonzero_offsets[e]; t < m_nonzero_offsets[e + 1]; ++t) {
+                    sum += local_values[m_gather[t]];
+                }
+                values[e] = sum;
+            }
+        });
+        return M;
+    }
+
+private:
+    const SurfaceMesh<Scalar, Index>& m_mesh;
+    Index m_block_size;
+    Eigen::Index m_size;
+
+    // Offset of the block entries of each facet.
+    std::vector<size_t> m_local_offsets;
+
+    // Compressed column pattern of the assembled matrix.
+    std::vector<StorageIndex> m_outer;
+    std::vector<StorageIndex> m_inner;
+
+    // Local entries contributing to nonzero e are m_gather[m_nonzero_offsets[e] ... e + 1]. Both
+    // are stored with 32-bit indices since they hold one entry per local block coefficient.
+    std::vector<uint32_t> m_nonzero_offsets;
+    std::vector<uint32_t> m_gather;
+};
+
+} // namespace lagrange::polyddg
@@ -19,15 +19,30 @@
 #include <lagrange/utils/assert.h>
 #include <lagrange/views.h>
 
-#include <lagrange/solver/DirectSolver.h>
+#include <lagrange/solver/SolverCache.h>
 #include <lagrange/solver/eigen_solvers.h>
 
 #include <cmath>
+#include <optional>
 #include <vector>
 
 namespace lagrange::polyddg {
 
-using solver::SolverLDLT;
+namespace {
+
+// Returns a solver for the given matrix, taken from the cache if provided, and factorizes it.
+template <typename Scalar>
+solver::CachedSolver<Scalar>& get_factorized_solver(
+    const Eigen::SparseMatrix<Scalar>& A,
+    solver::SolverCache* cache,
+    std::optional<solver::CachedSolver<Scalar>>& local_solver)
+{
+    auto& solver = cache ? cache->get(A) : local_solver.emplace();
+    solver.compute(A);
+    return solver;
+}
+
+} // namespace
 
 template <typename Scalar, typename Index>
 AttributeId compute_smooth_direction_field(
@@ -92,7 +107,8 @@ AttributeId compute_smooth_direction_field(
 
         if (!solved) {
             // Fallback: inverse power iteration.
-            SolverLDLT<Eigen::SparseMatrix<Scalar>> solver(L_reg);
+            std::optional<solver::CachedSolver<Scalar>> local_solver;
+            auto& solver = get_factorized_solver(L_reg, options.solver_cache, local_solver);
             la_runtime_assert(
                 solver.info() == Eigen::Success,
                 "compute_smooth_direction_field: Cholesky factorization of L + eps*M failed");
@@ -166,7 +182,8 @@ AttributeId compute_smooth_direction_field(
 
         // Assemble and factor the shifted system matrix: L - α*M + ε*M.
         Eigen::SparseMatrix<Scalar> L_shifted = L - (alpha - eps) * M;
-        SolverLDLT<Eigen::SparseMatrix<Scalar>> solver(L_shifted);
+        std::optional<solver::CachedSolver<Scalar>> local_solver;
+        auto& solver = get_factorized_solver(L_shifted, options.solver_cache, local_solver);
         la_runtime_assert(
             solver.info() == Eigen::Success,
             "compute_smooth_direction_field: factorization of L - alpha*M failed.");
@@ -20,18 +20,17 @@
 #include <lagrange/utils/assert.h>
 #include <lagrange/views.h>
 
-#include <lagrange/solver/DirectSolver.h>
+#include <lagrange/solver/SolverCache.h>
 
 #include <Eigen/SparseLU>
 
 #include <cmath>
+#include <optional>
 #include <utility>
 #include <vector>
 
 namespace lagrange::polyddg {
 
-using solver::SolverLDLT;
-
 // =============================================================================
 // 1-form level
 // =============================================================================
@@ -115,7 +114,17 @@ HodgeDecompositionResult hodge_decomposition_1_form(
     rhs0_aug.head(nv) = rhs0;
     rhs0_aug(nv) = Scalar(0);
 
-    SolverLDLT<SpMat> solver0(L0_aug);
+    // Reuse a cached factorization when possible (the augmented Laplacian only depends on the
+    // mesh and lambda).
+    std::optional<solver::CachedSolver<Scalar>> local_solver0;
+    if (options.solver_cache) {
+        la_runtime_assert(
+            options.solver_cache->get_options().mode == solver::SolverMode::Direct,
+            "hodge_decomposition_1_form: solver cache must use a direct solver.");
+    }
+    auto& solver0 =
+        options.solver_cache ? options.solver_cache->get(L0_aug) : local_solver0.emplace();
+    solver0.compute(L0_aug);
     la_runtime_assert(
         solver0.info() == Eigen::Success,
         "hodge_decomposition_1_form: scalar Laplacian factorization failed.");
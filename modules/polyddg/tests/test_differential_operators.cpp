@@ -695,6 +695,61 @@ TEST_CASE("DifferentialOperators", "[polyddg]")
         }
     }
 
+    SECTION("parallel assembly and matrix-free application")
+    {
+        primitive::TorusOptions torus_opts;
+        torus_opts.ring_segments = 30;
+        torus_opts.pipe_segments = 20;
+        auto quad_torus = primitive::generate_torus<Scalar, Index>(torus_opts);
+        auto tri_torus = primitive::generate_torus<Scalar, Index>(torus_opts);
+        triangulate_polygonal_facets(tri_torus);
+
+        for (auto* mesh : {&quad_torus, &tri_torus, &pyramid_mesh}) {
+            polyddg::DifferentialOperators<Scalar, Index> diff_ops(*mesh);
+            const Index num_vertices = mesh->get_num_vertices();
+
+            for (Scalar lambda : {1.0, 2.0}) {
+                // Laplacian matches its definition d0ᵀ · M₁ · d0.
+                Eigen::SparseMatrix<Scalar> D0 = diff_ops.d0();
+                Eigen::SparseMatrix<Scalar> L_ref =
+                    D0.transpose() * diff_ops.inner_product_1_form(lambda) * D0;
+                Eigen::SparseMatrix<Scalar> L = diff_ops.laplacian(lambda);
+                REQUIRE_THAT((L - L_ref).norm(), Catch::Matchers::WithinAbs(0.0, 1e-10));
+
+                Eigen::VectorXd x = Eigen::VectorXd::Random(num_vertices);
+                Eigen::VectorXd y(num_vertices);
+                diff_ops.apply_laplacian(x, y, lambda);
+                REQUIRE_THAT((y - L * x).norm(), Catch::Matchers::WithinAbs(0.0, 1e-10));
+
+                // Connection Laplacian matches the sum of its per-facet blocks.
+                for (Index n : {1u, 4u}) {
+                    std::vector<Eigen::Triplet<Scalar>> entries;
+                    for (Index fid = 0; fid < mesh->get_num_facets(); ++fid) {
+                        auto Lf = diff_ops.connection_laplacian_nrosy(fid, n, lambda);
+                        const Index facet_size = mesh->get_facet_size(fid);
+                        for (Index i = 0; i < facet_size * 2; ++i) {
+                            for (Index j = 0; j < facet_size * 2; ++j) {
+                                entries.emplace_back(
+                                    mesh->get_facet_vertex(fid, i / 2) * 2 + i % 2,
+                                    mesh->get_facet_vertex(fid, j / 2) * 2 + j % 2,
+                                    Lf(i, j));
+                            }
+                        }
+                    }
+                    Eigen::SparseMatrix<Scalar> Lc_ref(num_vertices * 2, num_vertices * 2);
+                    Lc_ref.setFromTriplets(entries.begin(), entries.end());
+                    Eigen::SparseMatrix<Scalar> Lc = diff_ops.connection_laplacian_nrosy(n, lambda);
+                    REQUIRE_THAT((Lc - Lc_ref).norm(), Catch::Matchers::WithinAbs(0.0, 1e-12));
+
+                    Eigen::VectorXd u = Eigen::VectorXd::Random(num_vertices * 2);
+                    Eigen::VectorXd v(num_vertices * 2);
+                    diff_ops.apply_connection_laplacian_nrosy(u, v, n, lambda);
+                    REQUIRE_THAT((v - Lc * u).norm(), Catch::Matchers::WithinAbs(0.0, 1e-10));
+                }
+            }
+        }
+    }
+
     SECTION("Levi-Civita edge transport consistency converges on torus")
     {
         // For edge (v0, v1) shared by faces f0 and f1, the parallel transport
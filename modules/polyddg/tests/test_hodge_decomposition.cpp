@@ -15,6 +15,7 @@
 #include <lagrange/polyddg/DifferentialOperators.h>
 #include <lagrange/polyddg/hodge_decomposition.h>
 #include <lagrange/primitive/generate_torus.h>
+#include <lagrange/solver/SolverCache.h>
 #include <lagrange/testing/common.h>
 #include <lagrange/testing/create_test_mesh.h>
 #include <lagrange/views.h>
@@ -275,6 +276,28 @@ TEST_CASE("HodgeDecomposition1Form", "[polyddg]")
 
         REQUIRE_THAT(w_harmonic.norm(), Catch::Matchers::WithinAbs(0.0, 1e-10));
     }
+
+    SECTION("solver cache reuses the factorization")
+    {
+        VectorX omega = VectorX::Random(ne);
+        const auto [w_exact, w_coexact, w_harmonic] = run_decomp_1form(mesh, ops, omega);
+
+        solver::SolverCache cache;
+        polyddg::HodgeDecompositionOptions opts;
+        opts.input_attribute = "@hd_test_1form_input";
+        opts.solver_cache = &cache;
+        for (int i = 0; i < 2; ++i) {
+            auto r = polyddg::hodge_decomposition_1_form(mesh, ops, opts);
+            const VectorX cached_exact = attribute_matrix_view<Scalar>(mesh, r.exact_id).col(0);
+            REQUIRE_THAT((cached_exact - w_exact).norm(), Catch::Matchers::WithinAbs(0.0, 1e-12));
+        }
+        REQUIRE(cache.size() == 1);
+
+        // A different lambda changes the coefficients of the Laplacian, not its pattern.
+        opts.lambda = 2.0;
+        polyddg::hodge_decomposition_1_form(mesh, ops, opts);
+        REQUIRE(cache.size() == 1);
+    }
 }
 
 TEST_CASE("HodgeDecompositionVectorField", "[polyddg]")
@@ -36,6 +36,13 @@ struct RemeshingOptions
     /// If true, the remeshing process will be deterministic.
     bool deterministic = false;
 
+    /// In deterministic mode, whether to color the multi-resolution hierarchy graphs with a
+    /// parallel deterministic algorithm instead of the serial greedy one. Orientation and position
+    /// optimization update one color at a time, so the output is identical for any number of
+    /// threads, but differs from the output obtained with the serial coloring. Off by default, so
+    /// that deterministic mode keeps producing the same output as before this option existed.
+    bool parallel_deterministic = false;
+
     /// Number of nearest neighbors to use when processing point clouds.
     size_t knn_points = 1000;
 
@@ -32,6 +32,7 @@ void populate_remeshing_im_module(nb::module_& m)
         [](MeshType& mesh,
            size_t target_num_facets,
            bool deterministic,
+           bool parallel_deterministic,
            size_t knn_points,
            uint8_t posy,
            uint8_t rosy,
@@ -42,6 +43,7 @@ void populate_remeshing_im_module(nb::module_& m)
             remeshing_im::RemeshingOptions options;
             options.target_num_facets = target_num_facets;
             options.deterministic = deterministic;
+            options.parallel_deterministic = parallel_deterministic;
             options.knn_points = knn_points;
             options.posy = static_cast<remeshing_im::PosyType>(posy);
             options.rosy = static_cast<remeshing_im::RosyType>(rosy);
@@ -54,6 +56,7 @@ void populate_remeshing_im_module(nb::module_& m)
         "mesh"_a,
         "target_num_facets"_a = defaults.target_num_facets,
         "deterministic"_a = defaults.deterministic,
+        "parallel_deterministic"_a = defaults.parallel_deterministic,
         "knn_points"_a = defaults.knn_points,
         "posy"_a = static_cast<uint8_t>(defaults.posy),
         "rosy"_a = static_cast<uint8_t>(defaults.rosy),
@@ -66,6 +69,9 @@ void populate_remeshing_im_module(nb::module_& m)
 :param mesh: Input mesh to remesh (triangle mesh or point cloud).
 :param target_num_facets: Target number of facets in the output mesh.
 :param deterministic: Whether to make the process deterministic.
+:param parallel_deterministic: In deterministic mode, whether to use a parallel deterministic graph
+    coloring. The output does not depend on the number of threads, but differs from the default
+    serial coloring. Off by default.
 :param knn_points: Number of nearest neighbors when remeshing point clouds.
 :param posy: Positional symmetry type (3 for triangle, 4 for quad).
 :param rosy: Rotational symmetry type (2 for line field, 4 for cross field, 6 for hex field).
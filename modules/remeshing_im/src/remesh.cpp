@@ -33,15 +33,114 @@
 #include <meshstats.h>
 #include <normal.h>
 #include <subdivide.h>
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
 #include <lagrange/utils/warnon.h>
 // clang-format on
 
+#include <algorithm>
+#include <cstdint>
+#include <limits>
 #include <map>
 #include <memory>
+#include <numeric>
 #include <set>
+#include <vector>
 
 namespace lagrange::remeshing_im {
 
+namespace {
+
+// Pseudo-random priority of a vertex, from the splitmix64 finalizer of its index.
+uint64_t vertex_priority(uint32_t v)
+{
+    uint64_t z = v + 0x9e3779b97f4a7c15ull;
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+    return z ^ (z >> 31);
+}
+
+///
+/// Colors a graph so that adjacent vertices have different colors, using the Jones-Plassmann
+/// algorithm with fixed pseudo-random priorities. In each round, every uncolored vertex with a
+/// higher priority than all its uncolored neighbors takes the smallest color unused by its
+/// neighbors. Vertices selected in the same round are independent, so each round runs in
+/// parallel, and the coloring does not depend on the number of threads.
+///
+/// @param[in]  adj           Graph adjacency.
+/// @param[in]  num_vertices  Number of graph vertices.
+///
+/// @return     Vertices of each color, in increasing order.
+///
+std::vector<std::vector<uint32_t>> compute_deterministic_coloring(
+    const ::instant_meshes::AdjacencyMatrix& adj,
+    uint32_t num_vertices)
+{
+    using ::instant_meshes::Link;
+    constexpr uint32_t uncolored = std::numeric_limits<uint32_t>::max();
+
+    std::vector<uint32_t> colors(num_vertices, uncolored);
+    std::vector<uint8_t> selected(num_vertices, 0);
+    std::vector<uint32_t> active(num_vertices);
+    std::iota(active.begin(), active.end(), 0u);
+    auto higher = [](uint32_t u, uint32_t v) {
+        const uint64_t pu = vertex_priority(u);
+        const uint64_t pv = vertex_priority(v);
+        return pu > pv || (pu == pv && u > v);
+    };
+
+    while (!active.empty()) {
+        tbb::parallel_for(
+            tbb::blocked_range<size_t>(0, active.size()),
+            [&](const tbb::blocked_range<size_t>& range) {
+                for (size_t i = range.begin(); i != range.end(); ++i) {
+                    const uint32_t v = active[i];
+                    bool is_local_max = true;
+                    for (const Link* link = adj[v]; link != adj[v + 1]; ++link) {
+                        const uint32_t u = link->id;
+                        if (u != v && colors[u] == uncolored && higher(u, v)) {
+                            is_local_max = false;
+                            break;
+                        }
+                    }
+                    selected[v] = is_local_max;
+                }
+            });
+
+        tbb::parallel_for(
+            tbb::blocked_range<size_t>(0, active.size()),
+            [&](const tbb::blocked_range<size_t>& range) {
+                std::vector<uint8_t> used;
+                for (size_t i = range.begin(); i != range.end(); ++i) {
+                    const uint32_t v = active[i];
+                    if (!selected[v]) continue;
+                    used.assign(static_cast<size_t>(adj[v + 1] - adj[v]) + 1, 0);
+                    for (const Link* link = adj[v]; link != adj[v + 1]; ++link) {
+                        const uint32_t c = colors[link->id];
+                        if (c < used.size()) used[c] = 1;
+                    }
+                    colors[v] = static_cast<uint32_t>(
+                        std::find(used.begin(), used.end(), uint8_t(0)) - used.begin());
+                }
+            });
+
+        active.erase(
+            std::remove_if(
+                active.begin(),
+                active.end(),
+                [&](uint32_t v) { return selected[v] != 0; }),
+            active.end());
+    }
+
+    uint32_t num_colors = 0;
+    for (uint32_t c : colors) num_colors = std::max(num_colors, c + 1);
+    std::vector<std::vector<uint32_t>> phases(num_colors);
+    for (uint32_t v = 0; v < num_vertices; ++v) phases[colors[v]].push_back(v);
+    return phases;
+}
+
+} // namespace
+
 template <typename Scalar, typename Index>
 SurfaceMesh<Scalar, Index> remesh(SurfaceMesh<Scalar, Index>& mesh, const RemeshingOptions& options)
 {
@@ -156,6 +255,14 @@ SurfaceMesh<Scalar, Index> remesh(SurfaceMesh<Scalar, Index>& mesh, const Remesh
     mRes.setN(std::move(N));
     mRes.setScale(scale);
     mRes.build(options.deterministic);
+    if (options.deterministic && options.parallel_deterministic) {
+        // The deterministic flag of the hierarchy also selects a stable serial sort of the collapse
+        // entries in downsample_graph, so it must stay on. Only the serial graph coloring computed
+        // by build() is replaced with a deterministic parallel one.
+        for (int level = 0; level < mRes.levels(); ++level) {
+            mRes.phases(level) = compute_deterministic_coloring(mRes.adj(level), mRes.size(level));
+        }
+    }
     mRes.resetSolution();
 
     if (options.align_to_boundaries && !pointcloud) {
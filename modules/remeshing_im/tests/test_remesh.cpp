@@ -22,6 +22,13 @@
 
 #include <catch2/matchers/catch_matchers_floating_point.hpp>
 
+// clang-format off
+#include <lagrange/utils/warnoff.h>
+#include <tbb/global_control.h>
+#include <tbb/task_arena.h>
+#include <lagrange/utils/warnon.h>
+// clang-format on
+
 #include <numeric>
 #include <vector>
 
@@ -79,6 +86,34 @@ TEST_CASE("remeshing_im::remesh", "[remeshing_im]")
         REQUIRE_THAT(compute_mesh_area(out_mesh), Catch::Matchers::WithinRel(total_area, 1e-1));
     }
 
+    SECTION("parallel deterministic")
+    {
+        if (tbb::this_task_arena::max_concurrency() < 2) {
+            SKIP("Thread-count independence requires at least two worker threads");
+        }
+        options.target_num_facets = 500;
+        options.parallel_deterministic = true;
+        auto remesh_with_threads = [&](size_t num_threads) {
+            tbb::global_control control(
+                tbb::global_control::max_allowed_parallelism,
+                num_threads);
+            return remeshing_im::remesh(mesh, options);
+        };
+
+        auto out_mesh = remesh_with_threads(1);
+        REQUIRE(out_mesh.is_quad_mesh());
+        REQUIRE(is_edge_manifold(out_mesh));
+        REQUIRE_THAT(compute_mesh_area(out_mesh), Catch::Matchers::WithinRel(total_area, 1e-1));
+
+        for (size_t num_threads : {2, 4, 8}) {
+            auto other_mesh = remesh_with_threads(num_threads);
+            REQUIRE(other_mesh.get_num_vertices() == out_mesh.get_num_vertices());
+            REQUIRE(other_mesh.get_num_facets() == out_mesh.get_num_facets());
+            REQUIRE(vertex_view(other_mesh) == vertex_view(out_mesh));
+            REQUIRE(facet_view(other_mesh) == facet_view(out_mesh));
+        }
+    }
+
     SECTION("empty mesh")
     {
         SurfaceMesh<Scalar, Index> empty_mesh;
@@ -0,0 +1,250 @@
+/*
+ * Copyright 2025 Adobe. All rights reserved.
+ * This file is licensed to you under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License. You may obtain a copy
+ * of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR REPRESENTATIONS
+ * OF ANY KIND, either express or implied. See the License for the specific language
+ * governing permissions and limitations under the License.
+ */
+#pragma once
+
+#include <lagrange/solver/DirectSolver.h>
+#include <lagrange/utils/assert.h>
+
+#include <Eigen/IterativeLinearSolvers>
+#include <Eigen/Sparse>
+
+#include <algorithm>
+#include <cstddef>
+
+namespace lagrange::solver {
+
+///
+/// Method used by a CachedSolver to solve linear systems.
+///
+enum class SolverMode {
+    /// Sparse LDLT factorization (see SolverLDLT).
+    Direct,
+
+    /// Conjugate gradient with a diagonal (Jacobi) preconditioner. Suited to large systems whose
+    /// factorization does not fit in memory, or when an approximate solution is good enough.
+    ConjugateGradient,
+};
+
+///
+/// Option struct for CachedSolver.
+///
+struct CachedSolverOptions
+{
+    /// Method used to solve linear systems.
+    SolverMode mode = SolverMode::Direct;
+
+    /// Relative residual tolerance of the conjugate gradient.
+    double tolerance = 1e-10;
+
+    /// Maximum number of conjugate gradient iterations. If 0, twice the system size is used.
+    size_t max_iterations = 0;
+
+    /// Whether the conjugate gradient starts from the previous solution, when it has the same
+    /// dimensions as the requested one.
+    bool warm_start = true;
+};
+
+///
+/// Sparse symmetric solver that reuses its work across successive matrices. The symbolic
+/// analysis is redone only when the sparsity pattern changes, and the numeric factorization only
+/// when the coefficients change.
+///
+/// The class exposes the same interface as Eigen's sparse solvers, so it can be used in place of
+/// SolverLDLT.
+///
+/// @tparam     Scalar  Matrix scalar type.
+///
+template <typename Scalar>
+class CachedSolver
+{
+public:
+    using MatrixType = Eigen::SparseMatrix<Scalar>;
+    using StorageIndex = typename MatrixType::StorageIndex;
+
+public:
+    ///
+    /// Constructs an empty solver.
+    ///
+    /// @param[in]  options  Solver options.
+    ///
+    explicit CachedSolver(const CachedSolverOptions& options = {})
+        : m_options(options)
+    {}
+
+    /// Solvers cannot be copied (nor moved), since the conjugate gradient keeps a reference to the
+    /// stored matrix.
+    CachedSolver(const CachedSolver&) = delete;
+    CachedSolver& operator=(const CachedSolver&) = delete;
+
+    ///
+    /// Performs the symbolic analysis of a matrix, unless it has the same sparsity pattern as the
+    /// previous one.
+    ///
+    /// @param[in]  A     Symmetric matrix.
+    ///
+    void analyzePattern(const MatrixType& A)
+    {
+        if (has_same_pattern(A)) return;
+        set_matrix(A);
+        m_values_valid = false;
+        if (m_options.mode == SolverMode::Direct) {
+            m_ldlt.analyzePattern(m_matrix);
+            m_info = m_ldlt.info();
+        } else {
+            m_info = Eigen::Success;
+        }
+        ++m_num_symbolic_analyses;
+    }
+
+    ///
+    /// Computes the numeric factorization of a matrix, unless it is identical to the previous one.
+    ///
+    /// @param[in]  A     Symmetric matrix.
+    ///
+    void factorize(const MatrixType& A)
+    {
+        analyzePattern(A);
+        if (m_values_valid && has_same_values(A)) return;
+        std::copy_n(A.valuePtr(), A.nonZeros(), m_matrix.valuePtr());
+        if (m_options.mode == SolverMode::Direct) {
+            m_ldlt.factorize(m_matrix);
+            m_info = m_ldlt.info();
+        } else {
+            m_cg.compute(m_matrix);
+            m_info = m_cg.info();
+        }
+        m_values_valid = (m_info == Eigen::Success);
+        ++m_num_numeric_factorizations;
+    }
+
+    ///
+    /// Prepares the solver for a matrix, reusing as much of the previous work as possible.
+    ///
+    /// @param[in]  A     Symmetric matrix.
+    ///
+    void compute(const MatrixType& A) { factorize(A); }
+
+    ///
+    /// Solves the system for one or more right-hand sides.
+    ///
+    /// @param[in]  b     Right-hand side(s), one per column.
+    ///
+    /// @return     Solution(s), one per column.
+    ///
+    template <typename Derived>
+    Eigen::Matrix<Scalar, Eigen::Dynamic, Derived::ColsAtCompileTime> solve(
+        const Eigen::MatrixBase<Derived>& b)
+    {
+        la_runtime_assert(m_values_valid, "CachedSolver: no valid factorization to solve with.");
+        la_runtime_assert(b.rows() == m_matrix.rows(), "CachedSolver: invalid right-hand side.");
+        Eigen::Matrix<Scalar, Eigen::Dynamic, Derived::ColsAtCompileTime> x;
+        if (m_options.mode == SolverMode::Direct) {
+            x = m_ldlt.solve(b);
+            m_info = m_ldlt.info();
+            return x;
+        }
+
+        m_cg.setTolerance(static_cast<typename MatrixType::RealScalar>(m_options.tolerance));
+        m_cg.setMaxIterations(
+            m_options.max_iterations > 0 ? static_cast<Eigen::Index>(m_options.max_iterations)
+                                         : 2 * m_matrix.rows());
+        if (m_options.warm_start && m_last_solution.rows() == b.rows() &&
+            m_last_solution.cols() == b.cols()) {
+            x = m_cg.solveWithGuess(b, m_last_solution);
+        } else {
+            x = m_cg.solve(b);
+        }
+        m_info = m_cg.info();
+        m_last_iterations = static_cast<size_t>(m_cg.iterations());
+        if (m_options.warm_start) m_last_solution = x;
+        return x;
+    }
+
+    ///
+    /// Reports whether the last operation was successful.
+    ///
+    Eigen::ComputationInfo info() const { return m_info; }
+
+    /// Number of rows of the current matrix.
+    Eigen::Index rows() const { return m_matrix.rows(); }
+
+    /// Number of columns of the current matrix.
+    Eigen::Index cols() const { return m_matrix.cols(); }
+
+    ///
+    /// Checks whether a matrix has the same sparsity pattern as the current matrix.
+    ///
+    /// @param[in]  A     Matrix to compare.
+    ///
+    /// @return     True if both matrices have the same sparsity pattern.
+    ///
+    bool has_same_pattern(const MatrixType& A) const
+    {
+        la_runtime_assert(A.isCompressed(), "CachedSolver: input matrix must be compressed.");
+        if (!m_pattern_valid || A.rows() != m_matrix.rows() || A.cols() != m_matrix.cols() ||
+            A.nonZeros() != m_matrix.nonZeros()) {
+            return false;
+        }
+        return std::equal(
+                   A.outerIndexPtr(),
+                   A.outerIndexPtr() + A.outerSize() + 1,
+                   m_matrix.outerIndexPtr()) &&
+               std::equal(
+                   A.innerIndexPtr(),
+                   A.innerIndexPtr() + A.nonZeros(),
+                   m_matrix.innerIndexPtr());
+    }
+
+    /// Number of symbolic analyses performed so far.
+    size_t get_num_symbolic_analyses() const { return m_num_symbolic_analyses; }
+
+    /// Number of numeric factorizations performed so far.
+    size_t get_num_numeric_factorizations() const { return m_num_numeric_factorizations; }
+
+    /// Number of conjugate gradient iterations of the last solve.
+    size_t get_last_num_iterations() const { return m_last_iterations; }
+
+    /// Solver options.
+    const CachedSolverOptions& get_options() const { return m_options; }
+
+protected:
+    bool has_same_values(const MatrixType& A) const
+    {
+        return std::equal(A.valuePtr(), A.valuePtr() + A.nonZeros(), m_matrix.valuePtr());
+    }
+
+    void set_matrix(const MatrixType& A)
+    {
+        m_matrix = A;
+        m_pattern_valid = true;
+        m_last_solution.resize(0, 0);
+    }
+
+protected:
+    CachedSolverOptions m_options;
+
+    // Copy of the current matrix. Iterative solvers keep a reference to it.
+    MatrixType m_matrix;
+    bool m_pattern_valid = false;
+    bool m_values_valid = false;
+
+    SolverLDLT<MatrixType> m_ldlt;
+    Eigen::ConjugateGradient<MatrixType, Eigen::Lower | Eigen::Upper> m_cg;
+    Eigen::Matrix<Scalar, Eigen::Dynamic, Eigen::Dynamic> m_last_solution;
+
+    Eigen::ComputationInfo m_info = Eigen::Success;
+    size_t m_num_symbolic_analyses = 0;
+    size_t m_num_numeric_factorizations = 0;
+    size_t m_last_iterations = 0;
+};
+
+} // namespace lagrange::solver
@@ -0,0 +1,120 @@
+/*
+ * Copyright 2025 Adobe. All rights reserved.
+ * This file is licensed to you under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License. You may obtain a copy
+ * of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR REPRESENTATIONS
+ * OF ANY KIND, either express or implied. See the License for the specific language
+ * governing permissions and limitations under the License.
+ */
+#pragma once
+
+#include <lagrange/solver/CachedSolver.h>
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <typeindex>
+#include <unordered_map>
+
+namespace lagrange::solver {
+
+///
+/// Collection of cached solvers keyed by sparsity pattern. Passing the same cache to successive
+/// calls of an algorithm solving systems with a fixed pattern (e.g. repeated filtering of the same
+/// mesh with different parameters) lets them share the symbolic analysis, and the numeric
+/// factorization as well when the matrix is unchanged.
+///
+/// @note       A cache is not thread-safe, and the solvers it returns are invalidated by clear().
+///
+class SolverCache
+{
+public:
+    ///
+    /// Constructs an empty cache.
+    ///
+    /// @param[in]  options  Options of the solvers created by the cache.
+    ///
+    explicit SolverCache(const CachedSolverOptions& options = {})
+        : m_options(options)
+    {}
+
+    ///
+    /// Gets the solver associated with the sparsity pattern of a matrix, creating it if needed.
+    /// The returned solver is not factorized against the input matrix: call compute() on it.
+    ///
+    /// @param[in]  A       Compressed sparse matrix.
+    ///
+    /// @tparam     Scalar  Matrix scalar type.
+    ///
+    /// @return     Solver for the pattern of the input matrix.
+    ///
+    template <typename Scalar>
+    CachedSolver<Scalar>& get(const Eigen::SparseMatrix<Scalar>& A)
+    {
+        la_runtime_assert(A.isCompressed(), "SolverCache: input matrix must be compressed.");
+        const size_t key = hash_pattern(A);
+        auto range = m_entries.equal_range(key);
+        for (auto it = range.first; it != range.second; ++it) {
+            if (it->second->type != std::type_index(typeid(Scalar))) continue;
+            auto& solver = static_cast<Entry<Scalar>&>(*it->second).solver;
+            if (solver.has_same_pattern(A)) return solver;
+        }
+        auto entry = std::make_unique<Entry<Scalar>>(m_options);
+        auto& solver = entry->solver;
+        m_entries.emplace(key, std::move(entry));
+        return solver;
+    }
+
+    /// Number of cached solvers.
+    size_t size() const { return m_entries.size(); }
+
+    /// Releases all cached solvers.
+    void clear() { m_entries.clear(); }
+
+    /// Options of the solvers created by the cache.
+    const CachedSolverOptions& get_options() const { return m_options; }
+
+protected:
+    struct EntryBase
+    {
+        explicit EntryBase(std::type_index type_)
+            : type(type_)
+        {}
+        virtual ~EntryBase() = default;
+        std::type_index type;
+    };
+
+    template <typename Scalar>
+    struct Entry : public EntryBase
+    {
+        explicit Entry(const CachedSolverOptions& options)
+            : EntryBase(std::type_index(typeid(Scalar)))
+            , solver(options)
+        {}
+        CachedSolver<Scalar> solver;
+    };
+
+    template <typename Scalar>
+    static size_t hash_pattern(const Eigen::SparseMatrix<Scalar>& A)
+    {
+        using StorageIndex = typename Eigen::SparseMatrix<Scalar>::StorageIndex;
+        size_t seed = std::hash<Eigen::Index>{}(A.rows());
+        auto combine = [&](size_t h) {
+            seed ^= h + 0x9e3779b97f4a7c15ULL + (seed << 6) + (seed >> 2);
+        };
+        combine(std::hash<Eigen::Index>{}(A.cols()));
+        std::hash<StorageIndex> hasher;
+        for (Eigen::Index i = 0; i <= A.outerSize(); ++i) combine(hasher(A.outerIndexPtr()[i]));
+        for (Eigen::Index i = 0; i < A.nonZeros(); ++i) combine(hasher(A.innerIndexPtr()[i]));
+        return seed;
+    }
+
+protected:
+    CachedSolverOptions m_options;
+    std::unordered_multimap<size_t, std::unique_ptr<EntryBase>> m_entries;
+};
+
+} // namespace lagrange::solver
@@ -9,12 +9,16 @@
  * OF ANY KIND, either express or implied. See the License for the specific language
  * governing permissions and limitations under the License.
  */
+#include <lagrange/solver/CachedSolver.h>
 #include <lagrange/solver/DirectSolver.h>
+#include <lagrange/solver/SolverCache.h>
 #include <lagrange/solver/eigen_solvers.h>
 
 #include <catch2/catch_test_macros.hpp>
 #include <catch2/matchers/catch_matchers_floating_point.hpp>
 
+#include <type_traits>
+
 TEST_CASE("SolverLDLT", "[solver]")
 {
     using Solver = lagrange::solver::SolverLDLT<Eigen::SparseMatrix<double>>;
@@ -33,6 +37,116 @@ TEST_CASE("SolverLDLT", "[solver]")
     REQUIRE((A_sparse * x).isApprox(b));
 }
 
+namespace {
+
+// Path graph Laplacian plus a diagonal shift (symmetric positive definite).
+Eigen::SparseMatrix<double> make_shifted_laplacian(int n, double shift)
+{
+    std::vector<Eigen::Triplet<double>> triplets;
+    for (int i = 0; i < n; ++i) {
+        triplets.emplace_back(i, i, shift + (i > 0) + (i + 1 < n));
+        if (i + 1 < n) {
+            triplets.emplace_back(i, i + 1, -1.0);
+            triplets.emplace_back(i + 1, i, -1.0);
+        }
+    }
+    Eigen::SparseMatrix<double> A(n, n);
+    A.setFromTriplets(triplets.begin(), triplets.end());
+    return A;
+}
+
+} // namespace
+
+TEST_CASE("CachedSolver", "[solver]")
+{
+    using namespace lagrange::solver;
+    const int n = 50;
+    Eigen::SparseMatrix<double> A = make_shifted_laplacian(n, 0.1);
+    Eigen::MatrixXd b = Eigen::MatrixXd::Random(n, 3);
+
+    // The conjugate gradient refers to the stored matrix, so solvers must stay in place.
+    STATIC_REQUIRE_FALSE(std::is_copy_constructible_v<CachedSolver<double>>);
+    STATIC_REQUIRE_FALSE(std::is_move_constructible_v<CachedSolver<double>>);
+
+    SECTION("direct")
+    {
+        CachedSolver<double> solver;
+        solver.compute(A);
+        REQUIRE(solver.info() == Eigen::Success);
+        Eigen::MatrixXd x = solver.solve(b);
+        REQUIRE((A * x).isApprox(b));
+
+        // Same matrix: nothing is recomputed.
+        solver.compute(A);
+        REQUIRE(solver.get_num_symbolic_analyses() == 1);
+        REQUIRE(solver.get_num_numeric_factorizations() == 1);
+
+        // Same pattern, different values: only the numeric factorization is recomputed.
+        Eigen::SparseMatrix<double> B = make_shifted_laplacian(n, 1.0);
+        solver.compute(B);
+        REQUIRE(solver.get_num_symbolic_analyses() == 1);
+        REQUIRE(solver.get_num_numeric_factorizations() == 2);
+        x = solver.solve(b);
+        REQUIRE((B * x).isApprox(b));
+
+        // Different pattern: everything is recomputed.
+        Eigen::SparseMatrix<double> C = make_shifted_laplacian(n + 1, 0.1);
+        solver.compute(C);
+        REQUIRE(solver.get_num_symbolic_analyses() == 2);
+        REQUIRE(solver.get_num_numeric_factorizations() == 3);
+    }
+
+    SECTION("conjugate gradient")
+    {
+        CachedSolverOptions options;
+        options.mode = SolverMode::ConjugateGradient;
+        options.tolerance = 1e-12;
+        CachedSolver<double> solver(options);
+        solver.compute(A);
+        Eigen::MatrixXd x = solver.solve(b);
+        REQUIRE(solver.info() == Eigen::Success);
+        REQUIRE((A * x).isApprox(b, 1e-8));
+        const size_t cold_iterations = solver.get_last_num_iterations();
+        REQUIRE(cold_iterations > 0);
+
+        // Warm start from the previous solution of a nearby system.
+        Eigen::MatrixXd b2 = b + 1e-6 * Eigen::MatrixXd::Random(n, 3);
+        x = solver.solve(b2);
+        REQUIRE(solver.info() == Eigen::Success);
+        REQUIRE((A * x).isApprox(b2, 1e-8));
+        REQUIRE(solver.get_last_num_iterations() < cold_iterations);
+    }
+}
+
+TEST_CASE("SolverCache", "[solver]")
+{
+    using namespace lagrange::solver;
+    SolverCache cache;
+
+    Eigen::SparseMatrix<double> A = make_shifted_laplacian(20, 0.1);
+    Eigen::SparseMatrix<double> B = make_shifted_laplacian(20, 1.0);
+    Eigen::SparseMatrix<double> C = make_shifted_laplacian(30, 0.1);
+
+    auto& solver_a = cache.get(A);
+    solver_a.compute(A);
+    auto& solver_b = cache.get(B);
+    solver_b.compute(B);
+    REQUIRE(&solver_a == &solver_b);
+    REQUIRE(solver_b.get_num_symbolic_analyses() == 1);
+    REQUIRE(cache.size() == 1);
+
+    auto& solver_c = cache.get(C);
+    REQUIRE(&solver_c != &solver_a);
+    REQUIRE(cache.size() == 2);
+
+    Eigen::SparseMatrix<float> Af = A.cast<float>();
+    cache.get(Af);
+    REQUIRE(cache.size() == 3);
+
+    cache.clear();
+    REQUIRE(cache.size() == 0);
+}
+
 TEST_CASE("selfadjoint_eigen_largest", "[solver][eigen]")
 {
     using Scalar = double;
@@ -0,0 +1,98 @@
+/*
+ * Copyright 2025 Adobe. All rights reserved.
+ * This file is licensed to you under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License. You may obtain a copy
+ * of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR REPRESENTATIONS
+ * OF ANY KIND, either express or implied. See the License for the specific language
+ * governing permissions and limitations under the License.
+ */
+#pragma once
+
+#include <lagrange/SurfaceMesh.h>
+#include <lagrange/subdivision/mesh_subdivision.h>
+#include <lagrange/utils/span.h>
+#include <lagrange/utils/value_ptr.h>
+
+namespace lagrange::subdivision {
+
+/// @addtogroup module-subdivision
+/// @{
+
+///
+/// Precomputed uniform subdivision of a fixed mesh topology.
+///
+/// The plan refines the topology of the input mesh once, and converts the subdivision rules into
+/// stencil tables mapping the input vertices (resp. face-varying values) to the refined ones,
+/// including the projection to the limit surface when requested. Subdividing a mesh with the same
+/// topology (e.g. successive frames of an animation) then only applies these stencils, in
+/// parallel, without refining the topology again.
+///
+/// @tparam     Scalar  Mesh scalar type.
+/// @tparam     Index   Mesh index type.
+///
+template <typename Scalar, typename Index>
+class SubdivisionPlan
+{
+public:
+    ///
+    /// Refines the topology of a mesh and computes the stencil tables of the interpolated
+    /// attributes.
+    ///
+    /// @param[in]  mesh     Input mesh defining the topology and the attributes to interpolate.
+    /// @param[in]  options  Subdivision options. Only uniform refinement is supported.
+    ///
+    explicit SubdivisionPlan(
+        const SurfaceMesh<Scalar, Index>& mesh,
+        const SubdivisionOptions& options = {});
+
+    ~SubdivisionPlan();
+    SubdivisionPlan(SubdivisionPlan&&);
+    SubdivisionPlan& operator=(SubdivisionPlan&&);
+    SubdivisionPlan(const SubdivisionPlan&) = delete;
+    SubdivisionPlan& operator=(const SubdivisionPlan&) = delete;
+
+    ///
+    /// Evaluates the subdivision of a mesh. The mesh must have the same topology as the one used
+    /// to build the plan, and provide the interpolated attributes under the same names and types.
+    ///
+    /// @param[in]  mesh  Input mesh to subdivide.
+    ///
+    /// @return     Subdivided mesh, identical to the output of subdivide_mesh().
+    ///
+    SurfaceMesh<Scalar, Index> subdivide(const SurfaceMesh<Scalar, Index>& mesh) const;
+
+    ///
+    /// Evaluates the refined vertex positions from new positions of the input vertices. This is
+    /// the minimal work needed to update a subdivided mesh whose control points moved.
+    ///
+    /// @param[in]  positions         Input vertex positions (num_input_vertices x dim, row major).
+    /// @param[out] output_positions  Refined vertex positions (num_output_vertices x dim, row
+    ///                               major).
+    ///
+    void evaluate_positions(span<const Scalar> positions, span<Scalar> output_positions) const;
+
+    ///
+    /// Number of vertices of the input mesh.
+    ///
+    Index get_num_input_vertices() const;
+
+    ///
+    /// Number of vertices of the subdivided mesh.
+    ///
+    Index get_num_output_vertices() const;
+
+private:
+    /// @cond LA_INTERNAL_DOCS
+
+    struct Impl;
+    value_ptr<Impl> m_impl;
+
+    /// @endcond
+};
+
+/// @}
+
+} // namespace lagrange::subdivision
@@ -0,0 +1,602 @@
+/*
+ * Copyright 2025 Adobe. All rights reserved.
+ * This file is licensed to you under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License. You may obtain a copy
+ * of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR REPRESENTATIONS
+ * OF ANY KIND, either express or implied. See the License for the specific language
+ * governing permissions and limitations under the License.
+ */
+#include <lagrange/subdivision/SubdivisionPlan.h>
+#include <lagrange/subdivision/api.h>
+
+#include <lagrange/Attribute.h>
+#include <lagrange/IndexedAttribute.h>
+#include <lagrange/Logger.h>
+#include <lagrange/SurfaceMeshTypes.h>
+#include <lagrange/internal/attribute_string_utils.h>
+#include <lagrange/internal/find_attribute_utils.h>
+#include <lagrange/internal/visit_attribute.h>
+#include <lagrange/utils/Error.h>
+#include <lagrange/utils/assert.h>
+#include "MeshConverter.h"
+#include "topology_refiner_utils.h"
+
+// clang-format off
+#include <lagrange/utils/warnoff.h>
+#include <opensubdiv/far/primvarRefiner.h>
+#include <opensubdiv/far/stencilTable.h>
+#include <opensubdiv/far/stencilTableFactory.h>
+#include <opensubdiv/far/topologyRefiner.h>
+#include <lagrange/utils/warnon.h>
+// clang-format on
+
+#include <Eigen/Core>
+#include <Eigen/Geometry>
+#include <Eigen/Sparse>
+
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+
+#include <numeric>
+#include <string>
+#include <vector>
+
+namespace lagrange::subdivision {
+
+namespace {
+
+// Sparse matrix mapping source values (columns) to refined values (rows). Each row is a stencil.
+template <typename Scalar>
+using StencilMatrix = Eigen::SparseMatrix<Scalar, Eigen::RowMajor, int>;
+
+// Primvar type used to record the weights of the limit masks computed by OpenSubdiv.
+struct StencilSource
+{
+    int index;
+};
+
+template <typename Scalar>
+struct StencilRow
+{
+    void Clear(void* = 0) { entries.clear(); }
+
+    void AddWithWeight(const StencilSource& src, Scalar weight)
+    {
+        entries.emplace_back(src.index, weight);
+    }
+
+    std::vector<std::pair<int, Scalar>> entries;
+};
+
+template <typename Scalar>
+StencilMatrix<Scalar> to_stencil_matrix(const std::vector<StencilRow<Scalar>>& rows, int num_cols)
+{
+    std::vector<Eigen::Triplet<Scalar, int>> triplets;
+    for (int r = 0; r < static_cast<int>(rows.size()); ++r) {
+        for (const auto& [c, w] : rows[r].entries) {
+            triplets.emplace_back(r, c, w);
+        }
+    }
+    StencilMatrix<Scalar> S(static_cast<int>(rows.size()), num_cols);
+    S.setFromTriplets(triplets.begin(), triplets.end());
+    S.makeCompressed();
+    return S;
+}
+
+template <typename Scalar>
+StencilMatrix<Scalar> identity_stencils(int n)
+{
+    StencilMatrix<Scalar> S(n, n);
+    S.setIdentity();
+    S.makeCompressed();
+    return S;
+}
+
+std::vector<StencilSource> unit_sources(int n)
+{
+    std::vector<StencilSource> sources(n);
+    for (int i = 0; i < n; ++i) sources[i].index = i;
+    return sources;
+}
+
+// Stencils mapping the base level vertices (or face-varying values) to the last refinement level.
+template <typename Scalar>
+StencilMatrix<Scalar> create_refinement_stencils(
+    const OpenSubdiv::Far::TopologyRefiner& topology_refiner,
+    typename OpenSubdiv::Far::StencilTableFactoryReal<Scalar>::Mode mode,
+    int fvar_index = 0)
+{
+    using StencilTableFactory = OpenSubdiv::Far::StencilTableFactoryReal<Scalar>;
+    const auto& base_level = topology_refiner.GetLevel(0);
+    const int num_sources = (mode == StencilTableFactory::INTERPOLATE_FACE_VARYING)
+                                ? base_level.GetNumFVarValues(fvar_index)
+                                : base_level.GetNumVertices();
+    const int num_refined_levels = topology_refiner.GetNumLevels();
+    if (num_refined_levels == 1) {
+        return identity_stencils<Scalar>(num_sources);
+    }
+
+    typename StencilTableFactory::Options stencil_options;
+    stencil_options.interpolationMode = mode;
+    stencil_options.generateOffsets = true;
+    stencil_options.generateControlVerts = false;
+    stencil_options.generateIntermediateLevels = false;
+    stencil_options.factorizeIntermediateLevels = true;
+    stencil_options.maxLevel = static_cast<unsigned>(num_refined_levels - 1);
+    stencil_options.fvarChannel = static_cast<unsigned>(fvar_index);
+    std::unique_ptr<const OpenSubdiv::Far::StencilTableReal<Scalar>> stencil_table(
+        StencilTableFactory::Create(topology_refiner, stencil_options));
+
+    const auto& sizes = stencil_table->GetSizes();
+    const auto& offsets = stencil_table->GetOffsets();
+    const auto& indices = stencil_table->GetControlIndices();
+    const auto& weights = stencil_table->GetWeights();
+    const int num_stencils = stencil_table->GetNumStencils();
+
+    std::vector<Eigen::Triplet<Scalar, int>> triplets;
+    triplets.reserve(indices.size());
+    for (int s = 0; s < num_stencils; ++s) {
+        for (int k = offsets[s]; k < offsets[s] + sizes[s]; ++k) {
+            triplets.emplace_back(s, indices[k], weights[k]);
+        }
+    }
+    StencilMatrix<Scalar> S(num_stencils, num_sources);
+    S.setFromTriplets(triplets.begin(), triplets.end());
+    S.makeCompressed();
+    return S;
+}
+
+// Stencils projecting the last level vertices to the limit surface, with optional derivatives.
+template <typename Scalar>
+void create_vertex_limit_stencils(
+    const OpenSubdiv::Far::TopologyRefiner& topology_refiner,
+    StencilMatrix<Scalar>& limit_stencils,
+    StencilMatrix<Scalar>* du_stencils,
+    StencilMatrix<Scalar>* dv_stencils)
+{
+    const int num_vertices =
+        topology_refiner.GetLevel(topology_refiner.GetMaxLevel()).GetNumVertices();
+    const auto sources = unit_sources(num_vertices);
+    std::vector<StencilRow<Scalar>> limit_rows(num_vertices);
+    OpenSubdiv::Far::PrimvarRefinerReal<Scalar> primvar_refiner(topology_refiner);
+    if (du_stencils && dv_stencils) {
+        std::vector<StencilRow<Scalar>> du_rows(num_vertices);
+        std::vector<StencilRow<Scalar>> dv_rows(num_vertices);
+        primvar_refiner.Limit(sources, limit_rows, du_rows, dv_rows);
+        *du_stencils = to_stencil_matrix(du_rows, num_vertices);
+        *dv_stencils = to_stencil_matrix(dv_rows, num_vertices);
+    } else {
+        primvar_refiner.Limit(sources, limit_rows);
+    }
+    limit_stencils = to_stencil_matrix(limit_rows, num_vertices);
+}
+
+// Stencils projecting the last level face-varying values to the limit surface.
+template <typename Scalar>
+StencilMatrix<Scalar> create_face_varying_limit_stencils(
+    const OpenSubdiv::Far::TopologyRefiner& topology_refiner,
+    int fvar_index)
+{
+    const int num_values =
+        topology_refiner.GetLevel(topology_refiner.GetMaxLevel()).GetNumFVarValues(fvar_index);
+    // Note: LimitFaceVarying requires at least one level of refinement.
+    if (topology_refiner.GetNumLevels() == 1) {
+        return identity_stencils<Scalar>(num_values);
+    }
+    const auto sources = unit_sources(num_values);
+    std::vector<StencilRow<Scalar>> limit_rows(num_values);
+    OpenSubdiv::Far::PrimvarRefinerReal<Scalar> primvar_refiner(topology_refiner);
+    primvar_refiner.LimitFaceVarying(sources, limit_rows, fvar_index);
+    return to_stencil_matrix(limit_rows, num_values);
+}
+
+template <typename Scalar>
+StencilMatrix<Scalar> compose_stencils(
+    const StencilMatrix<Scalar>& A,
+    const StencilMatrix<Scalar>& B)
+{
+    StencilMatrix<Scalar> S = (A * B).pruned();
+    S.makeCompressed();
+    return S;
+}
+
+// Applies a set of stencils to multi-channel values, in parallel over the refined elements.
+template <typename Scalar, typename ValueType>
+void apply_stencils(
+    const StencilMatrix<Scalar>& stencils,
+    span<const ValueType> source,
+    span<ValueType> target,
+    size_t num_channels)
+{
+    la_runtime_assert(source.size() == static_cast<size_t>(stencils.cols()) * num_channels);
+    la_runtime_assert(target.size() == static_cast<size_t>(stencils.rows()) * num_channels);
+    const int* outer = stencils.outerIndexPtr();
+    const int* inner = stencils.innerIndexPtr();
+    const Scalar* weights = stencils.valuePtr();
+    tbb::parallel_for(
+        tbb::blocked_range<Eigen::Index>(0, stencils.rows()),
+        [&](const tbb::blocked_range<Eigen::Index>& range) {
+            for (Eigen::Index r = range.begin(); r != range.end(); ++r) {
+                ValueType* dst = target.data() + r * num_channels;
+                std::fill_n(dst, num_channels, ValueType(0));
+                for (int k = outer[r]; k < outer[r + 1]; ++k) {
+                    const ValueType w = static_cast<ValueType>(weights[k]);
+                    const ValueType* src =
+                        source.data() + static_cast<size_t>(inner[k]) * num_channels;
+                    for (size_t c = 0; c < num_channels; ++c) {
+                        dst[c] += w * src[c];
+                    }
+                }
+            }
+        });
+}
+
+template <typename ValueType>
+constexpr bool is_interpolable_v =
+    std::is_same_v<ValueType, float> || std::is_same_v<ValueType, double>;
+
+} // namespace
+
+template <typename Scalar, typename Index>
+struct SubdivisionPlan<Scalar, Index>::Impl
+{
+    enum class InterpolationType {
+        Smooth, ///< Vertex stencils, optionally projected to the limit surface.
+        Linear, ///< Varying stencils.
+        FaceVarying, ///< Face-varying stencils of a given channel.
+    };
+
+    struct InterpolatedAttribute
+    {
+        std::string name;
+        InterpolationType type;
+        size_t fvar_index = 0;
+    };
+
+    // Refined topology. Kept alive so the plan holds everything needed to evaluate the surface.
+    std::unique_ptr<OpenSubdiv::Far::TopologyRefiner> topology_refiner;
+
+    // Input topology, used to validate the meshes passed to subdivide().
+    Index num_input_vertices = 0;
+    Index num_input_facets = 0;
+    Index num_input_corners = 0;
+    Index dimension = 3;
+
+    // Output mesh with the refined facets, face-varying indices and allocated attributes.
+    SurfaceMesh<Scalar, Index> output_mesh;
+    std::vector<InterpolatedAttribute> attributes;
+
+    StencilMatrix<Scalar> vertex_stencils;
+    StencilMatrix<Scalar> varying_stencils;
+    std::vector<StencilMatrix<Scalar>> face_varying_stencils;
+
+    // Limit surface derivatives, mapping input vertices to refined tangents/bitangents.
+    StencilMatrix<Scalar> du_stencils;
+    StencilMatrix<Scalar> dv_stencils;
+    AttributeId limit_normal_id = invalid_attribute_id();
+    AttributeId limit_tangent_id = invalid_attribute_id();
+    AttributeId limit_bitangent_id = invalid_attribute_id();
+};
+
+template <typename Scalar, typename Index>
+SubdivisionPlan<Scalar, Index>::SubdivisionPlan(
+    const SurfaceMesh<Scalar, Index>& mesh,
+    const SubdivisionOptions& options)
+    : m_impl(make_value_ptr<Impl>())
+{
+    using StencilTableFactory = OpenSubdiv::Far::StencilTableFactoryReal<Scalar>;
+    using InterpolationType = typename Impl::InterpolationType;
+
+    la_runtime_assert(
+        options.refinement == RefinementType::Uniform,
+        "SubdivisionPlan only supports uniform refinement.");
+    la_runtime_assert(
+        mesh.get_num_vertices() > 0 && mesh.get_num_facets() > 0,
+        "SubdivisionPlan requires a mesh with vertices and facets.");
+    if (options.preserve_shared_indices) {
+        logger().warn(
+            "Preserving shared indices is not supported with uniform subdivision. "
+            "Ignoring the option. To silence this warning, set 'preserve_shared_indices' "
+            "to false.");
+    }
+
+    auto& impl = *m_impl;
+    impl.num_input_vertices = mesh.get_num_vertices();
+    impl.num_input_facets = mesh.get_num_facets();
+    impl.num_input_corners = mesh.get_num_corners();
+    impl.dimension = mesh.get_dimension();
+
+    // Refine the topology once
+    auto interpolated_attr =
+        prepare_interpolated_attribute_ids(mesh, options.interpolated_attributes);
+    impl.topology_refiner = create_topology_refiner(mesh, options, interpolated_attr);
+    auto& topology_refiner = *impl.topology_refiner;
+    {
+        OpenSubdiv::Far::TopologyRefiner::UniformOptions uniform_options(options.num_levels);
+        uniform_options.fullTopologyInLastLevel = true;
+        topology_refiner.RefineUniform(uniform_options);
+    }
+    const int num_refined_levels = topology_refiner.GetNumLevels();
+    const auto& last_level = topology_refiner.GetLevel(num_refined_levels - 1);
+
+    // Vertex stencils, composed with the limit projection and its derivatives if needed
+    const bool need_limit_btn =
+        !options.output_limit_normals.empty() || !options.output_limit_tangents.empty() ||
+        !options.output_limit_bitangents.empty();
+    impl.vertex_stencils = create_refinement_stencils<Scalar>(
+        topology_refiner,
+        StencilTableFactory::INTERPOLATE_VERTEX);
+    if (options.use_limit_surface || need_limit_btn) {
+        StencilMatrix<Scalar> limit_stencils;
+        StencilMatrix<Scalar> du_stencils;
+        StencilMatrix<Scalar> dv_stencils;
+        create_vertex_limit_stencils(
+            topology_refiner,
+            limit_stencils,
+            need_limit_btn ? &du_stencils : nullptr,
+            need_limit_btn ? &dv_stencils : nullptr);
+        if (need_limit_btn) {
+            la_runtime_assert(
+                impl.dimension == 3,
+                "Limit normals/tangents/bitangents require 3D vertex positions.");
+            impl.du_stencils = compose_stencils(du_stencils, impl.vertex_stencils);
+            impl.dv_stencils = compose_stencils(dv_stencils, impl.vertex_stencils);
+            if (!options.use_limit_surface) {
+                logger().warn(
+                    "Limit normals/tangents/bitangents were requested, but refined vertex "
+                    "positions are not computed on the limit surface. Please set "
+                    "SubdivisionOptions::use_limit_surface=true to "
+                    "interpolate vertex positions to the limit surface and remove this warning.");
+            }
+        }
+        if (options.use_limit_surface) {
+            impl.vertex_stencils = compose_stencils(limit_stencils, impl.vertex_stencils);
+        }
+    }
+    if (!interpolated_attr.linear_vertex_attributes.empty()) {
+        impl.varying_stencils = create_refinement_stencils<Scalar>(
+            topology_refiner,
+            StencilTableFactory::INTERPOLATE_VARYING);
+    }
+
+    // Output topology and attributes
+    auto& output_mesh = impl.output_mesh;
+    output_mesh = extract_uniform_mesh_topology<Scalar, Index>(last_level, impl.dimension);
+
+    auto create_limit_attribute = [&](std::string_view name, AttributeUsage usage) {
+        if (name.empty()) return invalid_attribute_id();
+        return lagrange::internal::find_or_create_attribute<Scalar>(
+            output_mesh,
+            name,
+            AttributeElement::Vertex,
+            usage,
+            3,
+            lagrange::internal::ResetToDefault::No);
+    };
+    impl.limit_normal_id =
+        create_limit_attribute(options.output_limit_normals, AttributeUsage::Normal);
+    impl.limit_tangent_id =
+        create_limit_attribute(options.output_limit_tangents, AttributeUsage::Tangent);
+    impl.limit_bitangent_id =
+        create_limit_attribute(options.output_limit_bitangents, AttributeUsage::Bitangent);
+
+    auto add_vertex_attribute = [&](AttributeId id, InterpolationType type) {
+        lagrange::internal::visit_attribute_read(mesh, id, [&](auto&& attr) {
+            using AttributeType = std::decay_t<decltype(attr)>;
+            using ValueType = typename AttributeType::ValueType;
+            if constexpr (!is_interpolable_v<ValueType> || AttributeType::IsIndexed) {
+                la_debug_assert(false);
+            } else {
+                lagrange::internal::find_or_create_attribute<ValueType>(
+                    output_mesh,
+                    mesh.get_attribute_name(id),
+                    AttributeElement::Vertex,
+                    attr.get_usage(),
+                    attr.get_num_channels(),
+                    lagrange::internal::ResetToDefault::No);
+                impl.attributes.push_back({std::string(mesh.get_attribute_name(id)), type, 0});
+            }
+        });
+    };
+    for (auto id : interpolated_attr.smooth_vertex_attributes) {
+        add_vertex_attribute(id, InterpolationType::Smooth);
+    }
+    for (auto id : interpolated_attr.linear_vertex_attributes) {
+        add_vertex_attribute(id, InterpolationType::Linear);
+    }
+
+    int fvar_index = 0;
+    for (auto id : interpolated_attr.face_varying_attributes) {
+        lagrange::internal::visit_attribute_read(mesh, id, [&](auto&& attr) {
+            using AttributeType = std::decay_t<decltype(attr)>;
+            using ValueType = typename AttributeType::ValueType;
+            if constexpr (!is_interpolable_v<ValueType> || !AttributeType::IsIndexed) {
+                la_debug_assert(false);
+            } else {
+                AttributeId out_id = lagrange::internal::find_or_create_attribute<ValueType>(
+                    output_mesh,
+                    mesh.get_attribute_name(id),
+                    AttributeElement::Indexed,
+                    attr.get_usage(),
+                    attr.get_num_channels(),
+                    lagrange::internal::ResetToDefault::No);
+                auto& out_attr = output_mesh.template ref_indexed_attribute<ValueType>(out_id);
+                set_indexed_attribute_indices(last_level, out_attr.indices(), fvar_index);
+                out_attr.values().resize_elements(last_level.GetNumFVarValues(fvar_index));
+
+                auto stencils = create_refinement_stencils<Scalar>(
+                    topology_refiner,
+                    StencilTableFactory::INTERPOLATE_FACE_VARYING,
+                    fvar_index);
+                if (options.use_limit_surface) {
+                    stencils = compose_stencils(
+                        create_face_varying_limit_stencils<Scalar>(topology_refiner, fvar_index),
+                        stencils);
+                }
+                impl.face_varying_stencils.push_back(std::move(stencils));
+                impl.attributes.push_back(
+                    {std::string(mesh.get_attribute_name(id)),
+                     InterpolationType::FaceVarying,
+                     static_cast<size_t>(fvar_index)});
+                fvar_index++;
+            }
+        });
+    }
+
+    // If subdiv mesh has holes, we need to remove them from the output mesh. Vertices and
+    // face-varying values are kept, so the stencils still match the output attributes.
+    if (topology_refiner.HasHoles()) {
+        logger().debug("Removing facets tagged as holes");
+        output_mesh.remove_facets([&](Index f) -> bool {
+            return last_level.IsFaceHole(static_cast<OpenSubdiv::Far::Index>(f));
+        });
+    }
+}
+
+template <typename Scalar, typename Index>
+SubdivisionPlan<Scalar, Index>::~SubdivisionPlan() = default;
+template <typename Scalar, typename Index>
+SubdivisionPlan<Scalar, Index>::SubdivisionPlan(SubdivisionPlan<Scalar, Index>&&) = default;
+template <typename Scalar, typename Index>
+SubdivisionPlan<Scalar, Index>& SubdivisionPlan<Scalar, Index>::operator=(
+    SubdivisionPlan<Scalar, Index>&&) = default;
+
+template <typename Scalar, typename Index>
+SurfaceMesh<Scalar, Index> SubdivisionPlan<Scalar, Index>::subdivide(
+    const SurfaceMesh<Scalar, Index>& mesh) const
+{
+    using InterpolationType = typename Impl::InterpolationType;
+    const auto& impl = *m_impl;
+    la_runtime_assert(
+        mesh.get_num_vertices() == impl.num_input_vertices &&
+            mesh.get_num_facets() == impl.num_input_facets &&
+            mesh.get_num_corners() == impl.num_input_corners &&
+            mesh.get_dimension() == impl.dimension,
+        "SubdivisionPlan: input mesh does not match the topology of the plan.");
+
+    // The output buffers are shared with the plan until they are written to.
+    SurfaceMesh<Scalar, Index> output_mesh = impl.output_mesh;
+
+    for (const auto& interpolated : impl.attributes) {
+        la_runtime_assert(
+            mesh.has_attribute(interpolated.name),
+            fmt::format("SubdivisionPlan: missing attribute '{}'.", interpolated.name));
+        AttributeId id = mesh.get_attribute_id(interpolated.name);
+        lagrange::internal::visit_attribute_read(mesh, id, [&](auto&& attr) {
+            using AttributeType = std::decay_t<decltype(attr)>;
+            using ValueType = typename AttributeType::ValueType;
+            if constexpr (!is_interpolable_v<ValueType>) {
+                throw Error(
+                    fmt::format(
+                        "SubdivisionPlan: attribute '{}' has incompatible value type {}.",
+                        interpolated.name,
+                        lagrange::internal::value_type_name<ValueType>()));
+            } else if constexpr (AttributeType::IsIndexed) {
+                la_runtime_assert(
+                    interpolated.type == InterpolationType::FaceVarying,
+                    fmt::format(
+                        "SubdivisionPlan: attribute '{}' should not be indexed.",
+                        interpolated.name));
+                auto& out_attr =
+                    output_mesh.template ref_indexed_attribute<ValueType>(interpolated.name);
+                la_runtime_assert(attr.get_num_channels() == out_attr.get_num_channels());
+                apply_stencils(
+                    impl.face_varying_stencils[interpolated.fvar_index],
+                    attr.values().get_all(),
+                    out_attr.values().ref_all(),
+                    attr.get_num_channels());
+            } else {
+                la_runtime_assert(
+                    interpolated.type != InterpolationType::FaceVarying &&
+                        attr.get_element_type() == AttributeElement::Vertex,
+                    fmt::format(
+                        "SubdivisionPlan: attribute '{}' should be a vertex attribute.",
+                        interpolated.name));
+                auto& out_attr = output_mesh.template ref_attribute<ValueType>(interpolated.name);
+                la_runtime_assert(attr.get_num_channels() == out_attr.get_num_channels());
+                apply_stencils(
+                    interpolated.type == InterpolationType::Smooth ? impl.vertex_stencils
+                                                                   : impl.varying_stencils,
+                    attr.get_all(),
+                    out_attr.ref_all(),
+                    attr.get_num_channels());
+            }
+        });
+    }
+
+    // Limit surface derivatives
+    const bool need_limit_btn = impl.limit_normal_id != invalid_attribute_id() ||
+                                impl.limit_tangent_id != invalid_attribute_id() ||
+                                impl.limit_bitangent_id != invalid_attribute_id();
+    if (need_limit_btn) {
+        const size_t num_vertices = output_mesh.get_num_vertices();
+        std::vector<Scalar> du(num_vertices * 3);
+        std::vector<Scalar> dv(num_vertices * 3);
+        auto positions = mesh.get_vertex_to_position().get_all();
+        apply_stencils(impl.du_stencils, positions, span<Scalar>(du), 3);
+        apply_stencils(impl.dv_stencils, positions, span<Scalar>(dv), 3);
+        if (impl.limit_normal_id != invalid_attribute_id()) {
+            auto normals =
+                output_mesh.template ref_attribute<Scalar>(impl.limit_normal_id).ref_all();
+            tbb::parallel_for(
+                tbb::blocked_range<size_t>(0, num_vertices),
+                [&](const tbb::blocked_range<size_t>& range) {
+                    for (size_t v = range.begin(); v != range.end(); ++v) {
+                        Eigen::Map<const Eigen::Vector3<Scalar>> t(du.data() + 3 * v);
+                        Eigen::Map<const Eigen::Vector3<Scalar>> b(dv.data() + 3 * v);
+                        Eigen::Map<Eigen::Vector3<Scalar>>(normals.data() + 3 * v) =
+                            t.cross(b).stableNormalized();
+                    }
+                });
+        }
+        if (impl.limit_tangent_id != invalid_attribute_id()) {
+            auto tangents =
+                output_mesh.template ref_attribute<Scalar>(impl.limit_tangent_id).ref_all();
+            std::copy(du.begin(), du.end(), tangents.begin());
+        }
+        if (impl.limit_bitangent_id != invalid_attribute_id()) {
+            auto bitangents =
+                output_mesh.template ref_attribute<Scalar>(impl.limit_bitangent_id).ref_all();
+            std::copy(dv.begin(), dv.end(), bitangents.begin());
+        }
+    }
+
+    return output_mesh;
+}
+
+template <typename Scalar, typename Index>
+void SubdivisionPlan<Scalar, Index>::evaluate_positions(
+    span<const Scalar> positions,
+    span<Scalar> output_positions) const
+{
+    const auto& impl = *m_impl;
+    la_runtime_assert(
+        positions.size() == static_cast<size_t>(impl.num_input_vertices) * impl.dimension,
+        "SubdivisionPlan: invalid number of input positions.");
+    la_runtime_assert(
+        output_positions.size() ==
+            static_cast<size_t>(impl.vertex_stencils.rows()) * impl.dimension,
+        "SubdivisionPlan: invalid number of output positions.");
+    apply_stencils(impl.vertex_stencils, positions, output_positions, impl.dimension);
+}
+
+template <typename Scalar, typename Index>
+Index SubdivisionPlan<Scalar, Index>::get_num_input_vertices() const
+{
+    return m_impl->num_input_vertices;
+}
+
+template <typename Scalar, typename Index>
+Index SubdivisionPlan<Scalar, Index>::get_num_output_vertices() const
+{
+    return static_cast<Index>(m_impl->vertex_stencils.rows());
+}
+
+#define LA_X_SubdivisionPlan(_, Scalar, Index) \
+    template class LA_SUBDIVISION_API SubdivisionPlan<Scalar, Index>;
+LA_SURFACE_MESH_X(SubdivisionPlan, 0)
+
+} // namespace lagrange::subdivision
@@ -33,6 +33,11 @@
 #include <lagrange/utils/warnon.h>
 // clang-format on
 
+#include <tbb/blocked_range.h>
+#include <tbb/enumerable_thread_specific.h>
+#include <tbb/parallel_for.h>
+
+#include <memory>
 #include <variant>
 
 //------------------------------------------------------------------------------
@@ -178,7 +183,7 @@ void get_edge_tess_rates(
 template <typename Index>
 int eval_patch_indices(
     OpenSubdiv::Bfr::Tessellation& tess_pattern, // <- not const due to OpenSubdiv API issue
-    const std::vector<int>& facet_tess_rates,
+    span<const int> facet_tess_rates,
     span<const Index> patch_indices_in,
     std::vector<int>& patch_indices_out,
     std::vector<int>& tess_boundary_indices,
@@ -333,7 +338,7 @@ int eval_patch_values(
     const OpenSubdiv::Bfr::Tessellation& tess_pattern,
     int num_channels,
     span<const ValueType> attr_values_in,
-    const std::vector<int>& facet_tess_rates,
+    span<const int> facet_tess_rates,
     std::vector<ValueType>& patch_coords,
     std::vector<ValueType>& patch_values_in,
     span<ValueType> patch_values_out,
@@ -475,7 +480,7 @@ int eval_patch_values(
     return num_face_points_evaluated;
 }
 
-template <typename ValueType, typename Index>
+template <typename ValueType>
 void eval_patch_btn(
     OpenSubdiv::Bfr::Surface<ValueType>& facet_surface,
     const OpenSubdiv::Bfr::Tessellation& tess_pattern,
@@ -485,12 +490,9 @@ void eval_patch_btn(
     span<ValueType> patch_pos,
     span<ValueType> patch_du,
     span<ValueType> patch_dv,
-    IndexedAttribute<ValueType, Index>* normals_out,
-    IndexedAttribute<ValueType, Index>* tangents_out,
-    IndexedAttribute<ValueType, Index>* bitangents_out,
-    span<int> patch_indices_out,
-    int first_corner,
-    int patch_num_corners)
+    span<ValueType> normals_out,
+    span<ValueType> tangents_out,
+    span<ValueType> bitangents_out)
 {
     using Vector3s = Eigen::Vector3<ValueType>;
     la_runtime_assert(
@@ -510,44 +512,40 @@ void eval_patch_btn(
             &patch_pos[p_index],
             &patch_du[p_index],
             &patch_dv[p_index]);
-        if (normals_out) {
+        if (!normals_out.empty()) {
             Vector3s du(patch_du[p_index], patch_du[p_index + 1], patch_du[p_index + 2]);
             Vector3s dv(patch_dv[p_index], patch_dv[p_index + 1], patch_dv[p_index + 2]);
             Vector3s normal = du.cross(dv).stableNormalized();
-            std::copy_n(normal.data(), 3, patch_pos.begin() + p_index);
+            std::copy_n(normal.data(), 3, normals_out.begin() + p_index);
         }
     }
-    // Evaluate corner indices
-    auto pairs = {
-        std::make_pair(normals_out, patch_pos),
-        std::make_pair(tangents_out, patch_du),
-        std::make_pair(bitangents_out, patch_dv),
-    };
-    tess_pattern.GetFacets(patch_indices_out.data());
-    for (auto [attr, patch_values_out] : pairs) {
-        if (attr) {
-            // Insert values to attr
-            auto& values = attr->values();
-            size_t next_value = values.get_all().size();
-            Index offset = values.get_num_elements();
-            values.insert_elements(num_coords * num_channels);
-            std::copy(
-                patch_values_out.begin(),
-                patch_values_out.end(),
-                values.ref_all().begin() + next_value);
-
-            // Insert indices to attr
-            auto indices = attr->indices().ref_all().subspan(first_corner, patch_num_corners);
-            auto nvpf = tess_pattern.GetFacetSize();
-            for (int lf = 0, lc = 0; lf < tess_pattern.GetNumFacets(); ++lf) {
-                for (int lv = 0; lv < nvpf; ++lv) {
-                    if (nvpf == 4 && lv == 3 && patch_indices_out[lf * nvpf + lv] < 0) {
-                        continue; // Skip last index
-                    } else {
-                        indices[lc++] =
-                            static_cast<Index>(offset + patch_indices_out[lf * nvpf + lv]);
-                    }
-                }
+    if (!tangents_out.empty()) {
+        std::copy(patch_du.begin(), patch_du.end(), tangents_out.begin());
+    }
+    if (!bitangents_out.empty()) {
+        std::copy(patch_dv.begin(), patch_dv.end(), bitangents_out.begin());
+    }
+}
+
+template <typename Index>
+void set_patch_btn_indices(
+    const OpenSubdiv::Bfr::Tessellation& tess_pattern,
+    std::vector<int>& patch_indices,
+    Attribute<Index>& indices_out,
+    int first_corner,
+    int patch_num_corners,
+    int first_value)
+{
+    auto nvpf = tess_pattern.GetFacetSize();
+    patch_indices.resize(tess_pattern.GetNumFacets() * nvpf);
+    tess_pattern.GetFacets(patch_indices.data());
+    auto indices = indices_out.ref_all().subspan(first_corner, patch_num_corners);
+    for (int lf = 0, lc = 0; lf < tess_pattern.GetNumFacets(); ++lf) {
+        for (int lv = 0; lv < nvpf; ++lv) {
+            if (nvpf == 4 && lv == 3 && patch_indices[lf * nvpf + lv] < 0) {
+                continue; // Skip last index
+            } else {
+                indices[lc++] = static_cast<Index>(first_value + patch_indices[lf * nvpf + lv]);
             }
         }
     }
@@ -920,13 +918,28 @@ struct PatchCacheData
     std::vector<ValueType> dv;
 };
 
+enum class SurfaceType { Vertex, Varying, FaceVarying };
+
 template <typename ValueType, typename Index>
 struct AttributeSurface
 {
     AttributeInfo<ValueType, Index> attr;
-    Surface<ValueType>* surface;
+    SurfaceType surface_type;
+    size_t face_varying_index;
     std::vector<SharedVertex>* shared_verts;
     SharedEdges* shared_edges;
+
+    // Output values, retrieved once all output elements have been allocated
+    span<ValueType> values_out;
+
+    Surface<ValueType>& get_surface(Surfaces<ValueType, Index>& sfc) const
+    {
+        switch (surface_type) {
+        case SurfaceType::Vertex: return sfc.vertex.value();
+        case SurfaceType::Varying: return sfc.varying.value();
+        default: return sfc.face_varying[face_varying_index];
+        }
+    }
 };
 
 template <template <typename T, typename I> class Container, typename Index>
@@ -944,11 +957,67 @@ struct Selector
             return d;
         }
     }
+
+    template <typename ValueType>
+    const Container<ValueType, Index>& get() const
+    {
+        if constexpr (std::is_same_v<ValueType, float>) {
+            return f;
+        } else {
+            return d;
+        }
+    }
+};
+
+//
+// Per-thread surface evaluation data. The SurfaceFactory is not thread-safe due to its internal
+// cache, and Surfaces hold the state of the face being evaluated, so each thread owns a copy.
+//
+template <typename Index>
+struct FacetEvaluator
+{
+    FacetEvaluator(
+        const OpenSubdiv::Far::TopologyRefiner& mesh_topology,
+        const Selector<Surfaces, Index>& layout)
+        : surface_factory(mesh_topology, {})
+    {
+        copy_layout<float>(layout);
+        copy_layout<double>(layout);
+    }
+
+    template <typename ValueType>
+    void copy_layout(const Selector<Surfaces, Index>& layout)
+    {
+        const auto& src = layout.template get<ValueType>();
+        auto& dst = surfaces.template get<ValueType>();
+        if (src.vertex.has_value()) dst.vertex.emplace();
+        if (src.varying.has_value()) dst.varying.emplace();
+        dst.face_varying.resize(src.face_varying.size());
+        dst.fvar_ids = src.fvar_ids;
+    }
+
+    template <typename ValueType>
+    bool init_surfaces(int face_index)
+    {
+        auto& sfc = surfaces.template get<ValueType>();
+        return surface_factory.InitSurfaces(
+            face_index,
+            sfc.vertex.has_value() ? &sfc.vertex.value() : nullptr,
+            sfc.fvar_ids.empty() ? nullptr : sfc.face_varying.data(),
+            sfc.fvar_ids.data(),
+            static_cast<int>(sfc.fvar_ids.size()),
+            sfc.varying.has_value() ? &sfc.varying.value() : nullptr);
+    }
+
+    OpenSubdiv::Bfr::RefinerSurfaceFactory<> surface_factory;
+    Selector<Surfaces, Index> surfaces;
+    Selector<PatchCacheData, Index> patch_cache;
+    std::vector<int> facet_tess_rates;
 };
 
 template <typename Scalar, typename Index>
 void interpolate_attributes(
-    OpenSubdiv::Bfr::RefinerSurfaceFactory<>& mesh_surface_factory,
+    const OpenSubdiv::Far::TopologyRefiner& mesh_topology,
     const OpenSubdiv::Bfr::Tessellation::Options& tess_options,
     const InterpolatedAttributeIds& interpolated_attr,
     const SurfaceMesh<Scalar, Index>& input_mesh,
@@ -965,13 +1034,9 @@ void interpolate_attributes(
     const bool need_limit_btn =
         (output_limit_normals || output_limit_tangents || output_limit_bitangents);
 
-    // Surfaces parameterizing each attribute
+    // Surfaces parameterizing each attribute. Each thread evaluates its own copy of this layout.
     size_t num_indexed_attrs = interpolated_attr.face_varying_attributes.size();
     Selector<Surfaces, Index> surfaces;
-    // Pre-allocate face_varying vector in advance to guarantee that we can take stable pointers to
-    // its content
-    surfaces.template get<float>().face_varying.resize(num_indexed_attrs);
-    surfaces.template get<double>().face_varying.resize(num_indexed_attrs);
 
     //  Declare vectors to identify shared tessellation points at vertices
     //  and edges and their indices around the boundary of a face:
@@ -1024,9 +1089,11 @@ void interpolate_attributes(
                         attributes_and_surfaces.push_back(
                             AttributeSurface{
                                 info,
-                                &sfc.vertex.value(),
+                                SurfaceType::Vertex,
+                                0,
                                 &all_shared_verts[0],
-                                &all_shared_edges[0]});
+                                &all_shared_edges[0],
+                                {}});
                     } else {
                         if (!sfc.varying.has_value()) {
                             sfc.varying.emplace();
@@ -1034,9 +1101,11 @@ void interpolate_attributes(
                         attributes_and_surfaces.push_back(
                             AttributeSurface{
                                 info,
-                                &sfc.varying.value(),
+                                SurfaceType::Varying,
+                                0,
                                 &all_shared_verts[0],
-                                &all_shared_edges[0]});
+                                &all_shared_edges[0],
+                                {}});
                     }
                 }
             }
@@ -1082,237 +1151,221 @@ void interpolate_attributes(
 
                 size_t idx = sfc.fvar_ids.size();
                 sfc.fvar_ids.push_back(static_cast<FVarId>(fvar_index++));
+                sfc.face_varying.emplace_back();
                 logger().trace("FVar ID for attribute {}: {}", id, sfc.fvar_ids.back());
                 all_shared_verts[fvar_index].resize(attr.values().get_num_elements());
                 all_shared_edges[fvar_index].set_num_vertices(attr.values().get_num_elements());
                 attributes_and_surfaces.push_back(
                     AttributeSurface{
                         info,
-                        &sfc.face_varying[idx],
+                        SurfaceType::FaceVarying,
+                        idx,
                         &all_shared_verts[fvar_index],
-                        &all_shared_edges[fvar_index]});
+                        &all_shared_edges[fvar_index],
+                        {}});
             }
         });
     }
 
-    Selector<PatchCacheData, Index> patch_cache;
-    struct
-    {
-        std::vector<int> facet_tess_rates;
-        std::vector<int> tess_boundary_indices;
-        std::vector<int> patch_indices_out;
-    } tmp;
-
-    auto eval_attribute = [&](auto& attr_surface,
-                              int face_index,
-                              int corner_index,
-                              int old_num_values,
-                              std::optional<int>& patch_nv,
-                              std::optional<int>& patch_nf,
-                              std::optional<int>& patch_nc) {
-        auto& attr = attr_surface.attr;
-        auto& surface = *attr_surface.surface;
-        auto& shared_verts = *attr_surface.shared_verts;
-        auto& shared_edges = *attr_surface.shared_edges;
-        using ValueType = typename std::decay_t<decltype(attr)>::ValueType;
-        auto& patch = patch_cache.template get<ValueType>();
-
-        OpenSubdiv::Bfr::Tessellation tess_pattern(
-            surface.GetParameterization(),
-            surface.GetFaceSize(),
-            tmp.facet_tess_rates.data(),
-            tess_options);
-
-        auto patch_indices_in = attr.indices_in.subspan(
-            input_mesh.get_facet_corner_begin(face_index),
-            input_mesh.get_facet_size(face_index));
-
-        // Evaluate indices
-        bool is_first = false;
-        if (attr.indices_out == nullptr) {
-            la_debug_assert(patch_nv.has_value());
-        } else {
-            if (!patch_nf.has_value()) {
-                // Must be a vertex attribute, use old_num_values provided as argument
-                is_first = true;
-            } else {
-                // Not a vertex attribute, retrieve prev num values from value attribute directly
-                old_num_values = attr.values_out.get_num_elements();
-            }
-
-            patch_nv = eval_patch_indices(
-                tess_pattern,
-                tmp.facet_tess_rates,
-                patch_indices_in,
-                tmp.patch_indices_out,
-                tmp.tess_boundary_indices,
-                shared_verts,
-                shared_edges,
-                old_num_values,
-                attr.preserve_shared_indices);
-
-            auto nvpf = tess_pattern.GetFacetSize();
-            if (!patch_nf.has_value()) {
-                is_first = true;
-                Index nc = output_mesh.get_num_corners();
-                output_mesh.add_hybrid(
-                    tess_pattern.GetNumFacets(),
-                    [&](Index f) {
-                        if (nvpf == 3) {
-                            // Everything is a triangle
-                            return 3;
-                        } else {
-                            // Maybe triangle or quad, check last index of the tessellated face
-                            return tmp.patch_indices_out[f * nvpf + 3] < 0 ? 3 : 4;
-                        }
-                    },
-                    [&](Index, span<Index>) {});
-                patch_nc = static_cast<int>(output_mesh.get_num_corners() - nc);
-            }
-            // We may need to ignore the 4-th item in the list of indices when copying to our attr
-            auto f_out = attr.indices_out->ref_all().subspan(corner_index, patch_nc.value());
-            for (int lf = 0, lc = 0; lf < tess_pattern.GetNumFacets(); ++lf) {
-                for (int lv = 0; lv < nvpf; ++lv) {
-                    if (nvpf == 4 && lv == 3 && tmp.patch_indices_out[lf * nvpf + lv] < 0) {
-                        continue; // Skip last index
-                    } else {
-                        f_out[lc++] = static_cast<Index>(tmp.patch_indices_out[lf * nvpf + lv]);
-                    }
-                }
-            }
+    tbb::enumerable_thread_specific<std::unique_ptr<FacetEvaluator<Index>>> evaluators;
+    auto local_evaluator = [&]() -> FacetEvaluator<Index>& {
+        auto& evaluator = evaluators.local();
+        if (!evaluator) {
+            evaluator = std::make_unique<FacetEvaluator<Index>>(mesh_topology, surfaces);
         }
+        return *evaluator;
+    };
 
-        // Evaluate values
-        if (is_first) {
-            // Allocate new mesh vertices and resize all vertex attributes
-            la_debug_assert(output_mesh.get_num_vertices() == static_cast<Index>(old_num_values));
-            output_mesh.add_vertices(patch_nv.value());
-        } else if (attr.indices_out) {
-            // Insert new rows into the values of our indexed attribute
-            attr.values_out.insert_elements(patch_nv.value());
-        }
-        span<ValueType> patch_values_out = attr.values_out.ref_all().subspan(
-            old_num_values * attr.num_channels,
-            patch_nv.value() * attr.num_channels);
-
-        [[maybe_unused]] int nv = eval_patch_values(
-            surface,
-            tess_pattern,
-            attr.num_channels,
-            attr.values_in,
-            tmp.facet_tess_rates,
-            patch.patch_coords,
-            patch.patch_values_in,
-            patch_values_out,
-            patch_indices_in,
-            shared_verts,
-            shared_edges,
-            old_num_values,
-            attr.preserve_shared_indices);
-
-        if (is_first && need_limit_btn) {
-            if constexpr (std::is_same_v<ValueType, Scalar>) {
-                patch.pos.resize(tess_pattern.GetNumCoords() * attr.num_channels);
-                patch.du.resize(tess_pattern.GetNumCoords() * attr.num_channels);
-                patch.dv.resize(tess_pattern.GetNumCoords() * attr.num_channels);
-                eval_patch_btn<ValueType, Index>(
-                    surface,
-                    tess_pattern,
-                    attr.num_channels,
-                    patch.patch_coords,
-                    patch.patch_values_in,
-                    patch.pos,
-                    patch.du,
-                    patch.dv,
-                    output_limit_normals,
-                    output_limit_tangents,
-                    output_limit_bitangents,
-                    tmp.patch_indices_out,
-                    corner_index,
-                    patch_nc.value());
+    //
+    //  1. Compute the edge tessellation rates of every face in parallel. Faces without a limit
+    //  surface (e.g. holes) are skipped. Rates are stored per input corner (i.e. per facet edge).
+    //
+    const int num_faces = mesh_topology.GetLevel(0).GetNumFaces();
+    std::vector<int> facet_tess_rates(input_mesh.get_num_corners(), 0);
+    std::vector<uint8_t> has_limit_surface(num_faces, 0);
+    tbb::parallel_for(tbb::blocked_range<int>(0, num_faces), [&](const auto& range) {
+        auto& evaluator = local_evaluator();
+        auto& vertex_surface = evaluator.surfaces.template get<Scalar>().vertex.value();
+        auto& patch = evaluator.patch_cache.template get<Scalar>();
+        for (int face_index = range.begin(); face_index != range.end(); ++face_index) {
+            if (!evaluator.surface_factory.InitVertexSurface(face_index, &vertex_surface)) {
+                continue;
             }
+            has_limit_surface[face_index] = 1;
+            compute_facet_tess_rates<Scalar>(
+                mesh_topology,
+                face_index,
+                vertex_surface,
+                input_mesh.get_vertex_to_position().get_all(),
+                input_mesh.get_dimension(),
+                patch.patch_values_in,
+                patch.patch_coords,
+                use_limit_positions,
+                tess_interval,
+                tess_rate_max,
+                max_chordal_deviation,
+                evaluator.facet_tess_rates);
+            std::copy(
+                evaluator.facet_tess_rates.begin(),
+                evaluator.facet_tess_rates.end(),
+                facet_tess_rates.begin() + input_mesh.get_facet_corner_begin(face_index));
         }
+    });
 
-        la_debug_assert(nv == patch_nv.value());
-
-        if (!patch_nf.has_value()) {
-            patch_nf = tess_pattern.GetNumFacets();
-        } else {
-            la_debug_assert(
-                patch_nf.value() == tess_pattern.GetNumFacets(),
-                "Inconsistent number of facets");
-        }
+    auto get_facet_tess_rates = [&](int face_index) {
+        return span<const int>(facet_tess_rates)
+            .subspan(
+                input_mesh.get_facet_corner_begin(face_index),
+                input_mesh.get_facet_size(face_index));
     };
 
+    //
+    //  2. Assign output vertices, facets and face-varying values sequentially. Points shared
+    //  between faces are numbered by the first face that visits them, which only requires
+    //  integer bookkeeping. The values themselves are evaluated in the next step.
+    //
+    const size_t num_attrs = attributes_and_surfaces.size();
+    std::vector<int> value_offsets(static_cast<size_t>(num_faces) * num_attrs, 0);
+    std::vector<int> num_patch_values(static_cast<size_t>(num_faces) * num_attrs, 0);
+    std::vector<int> btn_offsets(need_limit_btn ? num_faces : 0, 0);
+
+    const auto scheme = mesh_topology.GetSchemeType();
+    std::vector<int> tess_boundary_indices;
+    std::vector<int> patch_indices_out;
+
     int num_tess_vertices = 0;
     [[maybe_unused]] int num_tess_facets = 0;
     int num_tess_corners = 0;
-    for (int face_index = 0; face_index < mesh_surface_factory.GetNumFaces(); ++face_index) {
-        //
-        //  Initialize the surfaces for this face -- if valid (skipping
-        //  holes and boundary faces in some rare cases):
-        //
-        using Other = std::conditional_t<std::is_same_v<Scalar, float>, double, float>;
-        auto init = [&](auto&& s) {
-            using ValueType = std::decay_t<decltype(s)>;
-            auto& sfc = surfaces.template get<ValueType>();
-            return mesh_surface_factory.InitSurfaces(
-                face_index,
-                sfc.vertex.has_value() ? &sfc.vertex.value() : nullptr,
-                sfc.fvar_ids.empty() ? nullptr : sfc.face_varying.data(),
-                sfc.fvar_ids.data(),
-                static_cast<int>(sfc.fvar_ids.size()),
-                sfc.varying.has_value() ? &sfc.varying.value() : nullptr);
-        };
-        if (!init(Scalar(0))) {
-            la_debug_assert(!init(Other(0)));
+    int num_btn_values = 0;
+    for (int face_index = 0; face_index < num_faces; ++face_index) {
+        if (!has_limit_surface[face_index]) {
             continue;
         }
-        init(Other(0));
-
-        // Compute tessellation rates for the face edges
-        tmp.facet_tess_rates.clear();
-        compute_facet_tess_rates<Scalar>(
-            mesh_surface_factory.GetMesh(),
-            face_index,
-            surfaces.template get<Scalar>().vertex.value(),
-            input_mesh.get_vertex_to_position().get_all(),
-            input_mesh.get_dimension(),
-            patch_cache.template get<Scalar>().patch_values_in,
-            patch_cache.template get<Scalar>().patch_coords,
-            use_limit_positions,
-            tess_interval,
-            tess_rate_max,
-            max_chordal_deviation,
-            tmp.facet_tess_rates);
+        const int face_size = static_cast<int>(input_mesh.get_facet_size(face_index));
+        auto rates = get_facet_tess_rates(face_index);
+        OpenSubdiv::Bfr::Tessellation tess_pattern(
+            OpenSubdiv::Bfr::Parameterization(scheme, face_size),
+            face_size,
+            rates.data(),
+            tess_options);
 
-        // Interpolate all attributes. The first attribute in this list is the vertex position, and
-        // it determines the edge tessellation rate for the facet.
+        // The first attribute in this list is the vertex position, and it determines the vertices
+        // and facets of the tessellated face.
         std::optional<int> patch_nv;
         std::optional<int> patch_nf;
         std::optional<int> patch_nc;
-        bool first = true;
-        int num_patch_vertices = 0;
-        for (auto& var : attributes_and_surfaces) {
+        for (size_t a = 0; a < num_attrs; ++a) {
             std::visit(
                 [&](auto& attr_surface) {
-                    eval_attribute(
-                        attr_surface,
-                        face_index,
-                        num_tess_corners,
-                        num_tess_vertices,
-                        patch_nv,
-                        patch_nf,
-                        patch_nc);
+                    auto& attr = attr_surface.attr;
+                    auto patch_indices_in = attr.indices_in.subspan(
+                        input_mesh.get_facet_corner_begin(face_index),
+                        face_size);
+
+                    // Evaluate indices
+                    int old_num_values = num_tess_vertices;
+                    bool is_first = false;
+                    if (attr.indices_out == nullptr) {
+                        la_debug_assert(patch_nv.has_value());
+                    } else {
+                        if (!patch_nf.has_value()) {
+                            // Must be a vertex attribute, use the current number of vertices
+                            is_first = true;
+                        } else {
+                            // Not a vertex attribute, retrieve prev num values from value
+                            // attribute directly
+                            old_num_values = attr.values_out.get_num_elements();
+                        }
+
+                        patch_nv = eval_patch_indices(
+                            tess_pattern,
+                            rates,
+                            patch_indices_in,
+                            patch_indices_out,
+                            tess_boundary_indices,
+                            *attr_surface.shared_verts,
+                            *attr_surface.shared_edges,
+                            old_num_values,
+                            attr.preserve_shared_indices);
+
+                        auto nvpf = tess_pattern.GetFacetSize();
+                        if (!patch_nf.has_value()) {
+                            Index nc = output_mesh.get_num_corners();
+                            output_mesh.add_hybrid(
+                                tess_pattern.GetNumFacets(),
+                                [&](Index f) {
+                                    if (nvpf == 3) {
+                                        // Everything is a triangle
+                                        return 3;
+                                    } else {
+                                        // Maybe triangle or quad, check last index of the
+                                        // tessellated face
+                                        return patch_indices_out[f * nvpf + 3] < 0 ? 3 : 4;
+                                    }
+                                },
+                                [&](Index, span<Index>) {});
+                            patch_nc = static_cast<int>(output_mesh.get_num_corners() - nc);
+                        }
+                        // We may need to ignore the 4-th item in the list of indices when
+                        // copying to our attr
+                        auto f_out = attr.indices_out->ref_all().subspan(
+                            num_tess_corners,
+                            patch_nc.value());
+                        for (int lf = 0, lc = 0; lf < tess_pattern.GetNumFacets(); ++lf) {
+                            for (int lv = 0; lv < nvpf; ++lv) {
+                                if (nvpf == 4 && lv == 3 && patch_indices_out[lf * nvpf + lv] < 0) {
+                                    continue; // Skip last index
+                                } else {
+                                    f_out[lc++] =
+                                        static_cast<Index>(patch_indices_out[lf * nvpf + lv]);
+                                }
+                            }
+                        }
+                    }
+
+                    // Allocate values
+                    if (is_first) {
+                        // Allocate new mesh vertices and resize all vertex attributes
+                        la_debug_assert(
+                            output_mesh.get_num_vertices() == static_cast<Index>(old_num_values));
+                        output_mesh.add_vertices(patch_nv.value());
+                    } else if (attr.indices_out) {
+                        // Insert new rows into the values of our indexed attribute
+                        attr.values_out.insert_elements(patch_nv.value());
+                    }
+                    value_offsets[face_index * num_attrs + a] = old_num_values;
+                    num_patch_values[face_index * num_attrs + a] = patch_nv.value();
+
+                    if (!patch_nf.has_value()) {
+                        patch_nf = tess_pattern.GetNumFacets();
+                    } else {
+                        la_debug_assert(
+                            patch_nf.value() == tess_pattern.GetNumFacets(),
+                            "Inconsistent number of facets");
+                    }
                 },
-                var);
+                attributes_and_surfaces[a]);
+        }
 
-            if (first) {
-                num_patch_vertices += patch_nv.value();
-                first = false;
+        // Limit normals/tangents/bitangents are not shared between faces
+        if (need_limit_btn) {
+            btn_offsets[face_index] = num_btn_values;
+            for (auto* attr :
+                 {output_limit_normals, output_limit_tangents, output_limit_bitangents}) {
+                if (attr) {
+                    set_patch_btn_indices(
+                        tess_pattern,
+                        patch_indices_out,
+                        attr->indices(),
+                        num_tess_corners,
+                        patch_nc.value(),
+                        num_btn_values);
+                }
             }
+            num_btn_values += tess_pattern.GetNumCoords();
         }
-        num_tess_vertices += num_patch_vertices;
+
+        num_tess_vertices += num_patch_values[face_index * num_attrs];
         num_tess_facets += patch_nf.value();
         num_tess_corners += patch_nc.value();
     }
@@ -1324,6 +1377,117 @@ void interpolate_attributes(
     la_debug_assert(output_mesh.get_num_facets() == static_cast<Index>(num_tess_facets));
     la_debug_assert(output_mesh.get_num_corners() == static_cast<Index>(num_tess_corners));
 
+    // Retrieve output buffers now that all elements have been allocated
+    for (auto& var : attributes_and_surfaces) {
+        std::visit(
+            [&](auto& attr_surface) {
+                attr_surface.values_out = attr_surface.attr.values_out.ref_all();
+            },
+            var);
+    }
+    auto btn_values_out = [&](IndexedAttribute<Scalar, Index>* attr) {
+        if (!attr) return span<Scalar>();
+        attr->values().resize_elements(num_btn_values);
+        return attr->values().ref_all();
+    };
+    span<Scalar> normals_out = btn_values_out(output_limit_normals);
+    span<Scalar> tangents_out = btn_values_out(output_limit_tangents);
+    span<Scalar> bitangents_out = btn_values_out(output_limit_bitangents);
+
+    //
+    //  3. Evaluate all attribute values in parallel. Each shared point is evaluated by the face
+    //  that numbered it, so faces write to disjoint ranges of the output buffers.
+    //
+    using Other = std::conditional_t<std::is_same_v<Scalar, float>, double, float>;
+    tbb::parallel_for(tbb::blocked_range<int>(0, num_faces), [&](const auto& range) {
+        auto& evaluator = local_evaluator();
+        for (int face_index = range.begin(); face_index != range.end(); ++face_index) {
+            if (!has_limit_surface[face_index]) {
+                continue;
+            }
+
+            //
+            //  Initialize the surfaces for this face:
+            //
+            [[maybe_unused]] bool valid = evaluator.template init_surfaces<Scalar>(face_index);
+            la_debug_assert(valid);
+            evaluator.template init_surfaces<Other>(face_index);
+
+            const int face_size = static_cast<int>(input_mesh.get_facet_size(face_index));
+            auto rates = get_facet_tess_rates(face_index);
+            OpenSubdiv::Bfr::Tessellation tess_pattern(
+                evaluator.surfaces.template get<Scalar>().vertex->GetParameterization(),
+                face_size,
+                rates.data(),
+                tess_options);
+
+            for (size_t a = 0; a < num_attrs; ++a) {
+                std::visit(
+                    [&](auto& attr_surface) {
+                        const auto& attr = attr_surface.attr;
+                        using ValueType = typename std::decay_t<decltype(attr)>::ValueType;
+                        auto& surface = attr_surface.get_surface(
+                            evaluator.surfaces.template get<ValueType>());
+                        auto& patch = evaluator.patch_cache.template get<ValueType>();
+
+                        const int old_num_values = value_offsets[face_index * num_attrs + a];
+                        const int patch_nv = num_patch_values[face_index * num_attrs + a];
+                        span<ValueType> patch_values_out = attr_surface.values_out.subspan(
+                            old_num_values * attr.num_channels,
+                            patch_nv * attr.num_channels);
+
+                        [[maybe_unused]] int nv = eval_patch_values(
+                            surface,
+                            tess_pattern,
+                            attr.num_channels,
+                            attr.values_in,
+                            rates,
+                            patch.patch_coords,
+                            patch.patch_values_in,
+                            patch_values_out,
+                            attr.indices_in.subspan(
+                                input_mesh.get_facet_corner_begin(face_index),
+                                face_size),
+                            *attr_surface.shared_verts,
+                            *attr_surface.shared_edges,
+                            old_num_values,
+                            attr.preserve_shared_indices);
+                        la_debug_assert(nv == patch_nv);
+
+                        if (a == 0 && need_limit_btn) {
+                            if constexpr (std::is_same_v<ValueType, Scalar>) {
+                                // Output normals/tangents/bitangents have 3 channels
+                                const size_t num_coords = tess_pattern.GetNumCoords();
+                                const size_t nc = attr.num_channels;
+                                auto sub = [&](span<Scalar> values) {
+                                    if (values.empty()) return values;
+                                    return values.subspan(
+                                        btn_offsets[face_index] * 3,
+                                        num_coords * 3);
+                                };
+                                patch.pos.resize(num_coords * nc);
+                                patch.du.resize(num_coords * nc);
+                                patch.dv.resize(num_coords * nc);
+                                eval_patch_btn<ValueType>(
+                                    surface,
+                                    tess_pattern,
+                                    attr.num_channels,
+                                    patch.patch_coords,
+                                    patch.patch_values_in,
+                                    patch.pos,
+                                    patch.du,
+                                    patch.dv,
+                                    sub(normals_out),
+                                    sub(tangents_out),
+                                    sub(bitangents_out));
+                            }
+                        }
+                    },
+                    attributes_and_surfaces[a]);
+            }
+        }
+    });
+
     output_mesh.shrink_to_fit();
 }
 
@@ -1336,18 +1500,12 @@ void interpolate_attributes(
 //  There are several ways to compute these shared points, and which is
 //  best depends on context.
 //
-//  Dealing with shared data poses complications for threading in general,
-//  so computing all points for the vertices and edges up front may be
-//  preferred -- despite the fact that faces will be visited more than once
-//  (first when generating potentially shared vertex or edge points, and
-//  later when generating any interior points). The loops for vertices and
-//  edges can be threaded and the indexing of the shared points is simpler.
-//
-//  For the single-threaded case here, the faces are each processed in
-//  order and any shared points will be computed and used as needed. So
-//  each face is visited once (and so each Surface initialized once) but
-//  the bookkeeping to deal with indices of shared points becomes more
-//  complicated.
+//  Dealing with shared data poses complications for threading in general.
+//  Here the faces are processed in three passes: edge tessellation rates
+//  are computed in parallel, then the faces are visited in order to number
+//  the shared points (integer bookkeeping only), and finally each face
+//  evaluates the points it owns in parallel. Each Surface is initialized
+//  twice, but all the limit surface evaluations are threaded.
 //
 template <typename Scalar, typename Index>
 SurfaceMesh<Scalar, Index> extract_adaptive_mesh_topology(
@@ -1363,22 +1521,6 @@ SurfaceMesh<Scalar, Index> extract_adaptive_mesh_topology(
     std::optional<Scalar> max_chordal_deviation,
     bool preserve_shared_indices)
 {
-    //
-    //  Initialize the SurfaceFactory for the given base mesh (very low
-    //  cost in terms of both time and space) and tessellate each face
-    //  independently (i.e. no shared vertices):
-    //
-    //  Note that the SurfaceFactory is not thread-safe by default due to
-    //  use of an internal cache. Creating a separate instance of the
-    //  SurfaceFactory for each thread is one way to safely parallelize
-    //  this loop. Another (preferred) is to assign a thread-safe cache
-    //  to the single instance.
-    //
-    //  First declare any evaluation options when initializing (though
-    //  none are used in this simple case):
-    //
-    OpenSubdiv::Bfr::RefinerSurfaceFactory<> mesh_surface_factory(mesh_topology, {});
-
     //
     //  Assign Tessellation Options applied for all faces.  Tessellations
     //  allow the creating of either 3- or 4-sided faces -- both of which
@@ -1391,7 +1533,7 @@ SurfaceMesh<Scalar, Index> extract_adaptive_mesh_topology(
     tess_options.PreserveQuads(output_quads);
 
     //
-    //  Process each face sequentially, computing interpolated attributes one at a time
+    //  Process each face, computing interpolated attributes one at a time
     //
     SurfaceMesh<Scalar, Index> tessellated_mesh(dimension);
 
@@ -1431,7 +1573,7 @@ SurfaceMesh<Scalar, Index> extract_adaptive_mesh_topology(
     }
 
     interpolate_attributes<Scalar>(
-        mesh_surface_factory,
+        mesh_topology,
         tess_options,
         interpolated_attr,
         input_mesh,
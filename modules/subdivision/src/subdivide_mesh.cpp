@@ -20,6 +20,7 @@
 #include <lagrange/internal/visit_attribute.h>
 #include <lagrange/utils/Error.h>
 #include "MeshConverter.h"
+#include "topology_refiner_utils.h"
 
 // clang-format off
 #include <lagrange/utils/warnoff.h>
@@ -137,6 +138,8 @@ bool contains(const std::vector<T>& v, const T& x)
     return std::find(v.begin(), v.end(), x) != v.end();
 }
 
+} // namespace
+
 template <typename Scalar, typename Index>
 InterpolatedAttributeIds prepare_interpolated_attribute_ids(
     const SurfaceMesh<Scalar, Index>& mesh,
@@ -239,7 +242,47 @@ InterpolatedAttributeIds prepare_interpolated_attribute_ids(
     return result;
 }
 
-} // namespace
+template <typename Scalar, typename Index>
+std::unique_ptr<OpenSubdiv::Far::TopologyRefiner> create_topology_refiner(
+    const SurfaceMesh<Scalar, Index>& input_mesh,
+    const SubdivisionOptions& options,
+    const InterpolatedAttributeIds& interpolated_attr)
+{
+    using TopologyRefinerFactory =
+        OpenSubdiv::Far::TopologyRefinerFactory<MeshConverter<SurfaceMesh<Scalar, Index>>>;
+
+    MeshConverter<SurfaceMesh<Scalar, Index>> converter{
+        input_mesh,
+        options,
+        interpolated_attr.face_varying_attributes};
+
+    // Convert user options
+    auto osd_scheme = get_subdivision_scheme(options.scheme, input_mesh);
+    auto osd_options = get_subdivision_options(options);
+
+    auto refiner_options = typename TopologyRefinerFactory::Options(osd_scheme, osd_options);
+    refiner_options.validateFullTopology = true; // uncomment for debugging
+
+    std::unique_ptr<OpenSubdiv::Far::TopologyRefiner> topology_refiner(
+        TopologyRefinerFactory::Create(converter, refiner_options));
+
+    if (options.validate_topology) {
+        la_runtime_assert(topology_refiner->GetLevel(0).ValidateTopology());
+    }
+
+    return topology_refiner;
+}
+
+#define LA_X_create_topology_refiner(_, Scalar, Index)                                       \
+    template LA_SUBDIVISION_API InterpolatedAttributeIds prepare_interpolated_attribute_ids( \
+        const SurfaceMesh<Scalar, Index>& mesh,                                             \
+        const InterpolatedAttributes& interpolation);                                       \
+    template LA_SUBDIVISION_API std::unique_ptr<OpenSubdiv::Far::TopologyRefiner>            \
+    create_topology_refiner(                                                                 \
+        const SurfaceMesh<Scalar, Index>& input_mesh,                                       \
+        const SubdivisionOptions& options,                                                  \
+        const InterpolatedAttributeIds& interpolated_attr);
+LA_SURFACE_MESH_X(create_topology_refiner, 0)
 
 template <typename Scalar, typename Index>
 SurfaceMesh<Scalar, Index> subdivide_uniform(
@@ -270,28 +313,7 @@ SurfaceMesh<Scalar, Index> subdivide_mesh(
         prepare_interpolated_attribute_ids(input_mesh, options.interpolated_attributes);
 
     // Create a topology refiner from the input mesh
-    std::unique_ptr<OpenSubdiv::Far::TopologyRefiner> topology_refiner([&] {
-        using TopologyRefinerFactory =
-            OpenSubdiv::Far::TopologyRefinerFactory<MeshConverter<SurfaceMesh<Scalar, Index>>>;
-
-        MeshConverter<SurfaceMesh<Scalar, Index>> converter{
-            input_mesh,
-            options,
-            interpolated_attr.face_varying_attributes};
-
-        // Convert user options
-        auto osd_scheme = get_subdivision_scheme(options.scheme, input_mesh);
-        auto osd_options = get_subdivision_options(options);
-
-        auto refiner_options = typename TopologyRefinerFactory::Options(osd_scheme, osd_options);
-        refiner_options.validateFullTopology = true; // uncomment for debugging
-
-        return TopologyRefinerFactory::Create(converter, refiner_options);
-    }());
-
-    if (options.validate_topology) {
-        la_runtime_assert(topology_refiner->GetLevel(0).ValidateTopology());
-    }
+    auto topology_refiner = create_topology_refiner(input_mesh, options, interpolated_attr);
 
     if (options.refinement == RefinementType::Uniform) {
         return subdivide_uniform(input_mesh, *topology_refiner, interpolated_attr, options);
@@ -308,6 +330,7 @@ LA_SURFACE_MESH_X(subdivide_mesh, 0)
 
 // TODOs for a second PR:
 // - Nonmanifold inputs
-// - Repeated evaluation using PatchTable? (both with iterative refinement and bfr limit surface)
+// - Repeated evaluation using PatchTable for the bfr limit surface (uniform refinement is covered
+//   by SubdivisionPlan)
 
 } // namespace lagrange::subdivision
@@ -20,6 +20,7 @@
 #include <lagrange/internal/visit_attribute.h>
 #include <lagrange/utils/Error.h>
 #include "MeshConverter.h"
+#include "topology_refiner_utils.h"
 
 // clang-format off
 #include <lagrange/utils/warnoff.h>
@@ -37,44 +38,6 @@ namespace lagrange::subdivision {
 
 namespace {
 
-template <typename Scalar, typename Index>
-SurfaceMesh<Scalar, Index> extract_uniform_mesh_topology(
-    const OpenSubdiv::Far::TopologyLevel& level,
-    Index dimension)
-{
-    SurfaceMesh<Scalar, Index> mesh(dimension);
-    mesh.add_vertices(level.GetNumVertices());
-    mesh.add_hybrid(
-        level.GetNumFaces(),
-        [&](Index f) { return static_cast<Index>(level.GetFaceVertices(f).size()); },
-        [&](Index f, lagrange::span<Index> t) {
-            const auto& face = level.GetFaceVertices(f);
-            std::transform(face.begin(), face.end(), t.begin(), [](auto&& x) {
-                return static_cast<Index>(x);
-            });
-        });
-    return mesh;
-};
-
-template <typename Index>
-void set_indexed_attribute_indices(
-    const OpenSubdiv::Far::TopologyLevel& level,
-    Attribute<Index>& attr_indices,
-    int fvar_index)
-{
-    auto target_indices = attr_indices.ref_all();
-    size_t offset = 0;
-    for (int face = 0; face < level.GetNumFaces(); ++face) {
-        OpenSubdiv::Far::ConstIndexArray source = level.GetFaceFVarValues(face, fvar_index);
-        auto target = target_indices.subspan(offset, source.size());
-        std::transform(source.begin(), source.end(), target.begin(), [](auto&& x) {
-            return static_cast<Index>(x);
-        });
-        offset += source.size();
-    }
-    la_debug_assert(offset == target_indices.size());
-};
-
 template <typename Scalar>
 struct Vertex
 {
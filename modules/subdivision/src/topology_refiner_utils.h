@@ -0,0 +1,113 @@
+/*
+ * Copyright 2025 Adobe. All rights reserved.
+ * This file is licensed to you under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License. You may obtain a copy
+ * of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR REPRESENTATIONS
+ * OF ANY KIND, either express or implied. See the License for the specific language
+ * governing permissions and limitations under the License.
+ */
+#pragma once
+
+#include <lagrange/Attribute.h>
+#include <lagrange/SurfaceMesh.h>
+#include <lagrange/subdivision/mesh_subdivision.h>
+#include <lagrange/utils/assert.h>
+#include "MeshConverter.h"
+
+// clang-format off
+#include <lagrange/utils/warnoff.h>
+#include <opensubdiv/far/topologyRefiner.h>
+#include <lagrange/utils/warnon.h>
+// clang-format on
+
+#include <algorithm>
+#include <memory>
+
+namespace lagrange::subdivision {
+
+///
+/// Collects the ids of the attributes to interpolate during subdivision.
+///
+/// @param[in]  mesh           Input mesh.
+/// @param[in]  interpolation  Attribute selection.
+///
+/// @return     Ids of the vertex and face-varying attributes to interpolate.
+///
+template <typename Scalar, typename Index>
+InterpolatedAttributeIds prepare_interpolated_attribute_ids(
+    const SurfaceMesh<Scalar, Index>& mesh,
+    const InterpolatedAttributes& interpolation);
+
+///
+/// Creates an unrefined topology refiner from the input mesh. The face-varying channels of the
+/// refiner follow the order of interpolated_attr.face_varying_attributes.
+///
+/// @param[in]  input_mesh         Input mesh.
+/// @param[in]  options            Subdivision options.
+/// @param[in]  interpolated_attr  Attributes to interpolate.
+///
+/// @return     Topology refiner of the input mesh.
+///
+template <typename Scalar, typename Index>
+std::unique_ptr<OpenSubdiv::Far::TopologyRefiner> create_topology_refiner(
+    const SurfaceMesh<Scalar, Index>& input_mesh,
+    const SubdivisionOptions& options,
+    const InterpolatedAttributeIds& interpolated_attr);
+
+///
+/// Extracts the facets of a uniformly refined topology level.
+///
+/// @param[in]  level      Topology level.
+/// @param[in]  dimension  Vertex dimension of the output mesh.
+///
+/// @return     Mesh with the facets of the level, and zero-initialized vertex positions.
+///
+template <typename Scalar, typename Index>
+SurfaceMesh<Scalar, Index> extract_uniform_mesh_topology(
+    const OpenSubdiv::Far::TopologyLevel& level,
+    Index dimension)
+{
+    SurfaceMesh<Scalar, Index> mesh(dimension);
+    mesh.add_vertices(level.GetNumVertices());
+    mesh.add_hybrid(
+        level.GetNumFaces(),
+        [&](Index f) { return static_cast<Index>(level.GetFaceVertices(f).size()); },
+        [&](Index f, lagrange::span<Index> t) {
+            const auto& face = level.GetFaceVertices(f);
+            std::transform(face.begin(), face.end(), t.begin(), [](auto&& x) {
+                return static_cast<Index>(x);
+            });
+        });
+    return mesh;
+}
+
+///
+/// Copies the face-varying value indices of a refined topology level into an indexed attribute.
+///
+/// @param[in]  level         Topology level.
+/// @param[out] attr_indices  Index buffer of the indexed attribute.
+/// @param[in]  fvar_index    Face-varying channel.
+///
+template <typename Index>
+void set_indexed_attribute_indices(
+    const OpenSubdiv::Far::TopologyLevel& level,
+    Attribute<Index>& attr_indices,
+    int fvar_index)
+{
+    auto target_indices = attr_indices.ref_all();
+    size_t offset = 0;
+    for (int face = 0; face < level.GetNumFaces(); ++face) {
+        OpenSubdiv::Far::ConstIndexArray source = level.GetFaceFVarValues(face, fvar_index);
+        auto target = target_indices.subspan(offset, source.size());
+        std::transform(source.begin(), source.end(), target.begin(), [](auto&& x) {
+            return static_cast<Index>(x);
+        });
+        offset += source.size();
+    }
+    la_debug_assert(offset == target_indices.size());
+}
+
+} // namespace lagrange::subdivision
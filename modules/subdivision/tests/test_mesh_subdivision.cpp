@@ -23,6 +23,7 @@
 #include <lagrange/io/load_mesh.h>
 #include <lagrange/io/save_mesh.h>
 #include <lagrange/separate_by_components.h>
+#include <lagrange/subdivision/SubdivisionPlan.h>
 #include <lagrange/subdivision/compute_sharpness.h>
 #include <lagrange/subdivision/mesh_subdivision.h>
 #include <lagrange/subdivision/midpoint_subdivision.h>
@@ -41,6 +42,15 @@
 
 #include <catch2/matchers/catch_matchers_floating_point.hpp>
 
+// clang-format off
+#include <lagrange/utils/warnoff.h>
+#include <tbb/task_arena.h>
+#include <lagrange/utils/warnon.h>
+// clang-format on
+
+#include <algorithm>
+#include <array>
+
 namespace {
 
 template <typename Scalar, typename Index>
@@ -417,6 +427,68 @@ TEST_CASE("mesh_subdivision_limit_adaptive", "[mesh][subdivision]" LA_SLOW_DEBUG
     }
 }
 
+TEST_CASE("mesh_subdivision_adaptive_deterministic", "[mesh][subdivision]" LA_SLOW_DEBUG_FLAG)
+{
+    using Scalar = double;
+    using Index = uint32_t;
+    auto mesh = lagrange::testing::load_surface_mesh<Scalar, Index>("open/subdivision/cube.obj");
+    auto nrm_id = lagrange::compute_normal(mesh, lagrange::internal::pi * 0.5);
+    std::string nrm_name(mesh.get_attribute_name(nrm_id));
+
+    lagrange::subdivision::SubdivisionOptions options;
+    options.scheme = lagrange::subdivision::SchemeType::CatmullClark;
+    options.num_levels = 4;
+    options.use_limit_surface = true;
+    options.interpolated_attributes.set_selected({nrm_id});
+    options.refinement = lagrange::subdivision::RefinementType::EdgeAdaptive;
+    options.output_limit_normals = "normal";
+    options.output_limit_tangents = "tangent";
+    options.output_limit_bitangents = "bitangent";
+
+    lagrange::SurfaceMesh<Scalar, Index> serial_mesh;
+    tbb::task_arena arena(1);
+    arena.execute([&] { serial_mesh = lagrange::subdivision::subdivide_mesh(mesh, options); });
+    auto parallel_mesh = lagrange::subdivision::subdivide_mesh(mesh, options);
+
+    // Faces are evaluated in parallel but numbered serially, so the output must not depend on the
+    // number of threads.
+    REQUIRE(serial_mesh.get_num_vertices() == parallel_mesh.get_num_vertices());
+    REQUIRE(serial_mesh.get_num_facets() == parallel_mesh.get_num_facets());
+    REQUIRE(
+        lagrange::vector_view(serial_mesh.get_corner_to_vertex()) ==
+        lagrange::vector_view(parallel_mesh.get_corner_to_vertex()));
+    REQUIRE(vertex_view(serial_mesh) == vertex_view(parallel_mesh));
+
+    const std::array<std::string_view, 4> names = {nrm_name, "normal", "tangent", "bitangent"};
+    for (std::string_view name : names) {
+        REQUIRE(serial_mesh.has_attribute(name));
+        REQUIRE(parallel_mesh.has_attribute(name));
+        auto& serial_attr = serial_mesh.get_indexed_attribute<Scalar>(name);
+        auto& parallel_attr = parallel_mesh.get_indexed_attribute<Scalar>(name);
+        REQUIRE(
+            lagrange::vector_view(serial_attr.indices()) ==
+            lagrange::vector_view(parallel_attr.indices()));
+        REQUIRE(
+            lagrange::matrix_view(serial_attr.values()) ==
+            lagrange::matrix_view(parallel_attr.values()));
+    }
+
+    // Limit derivatives get one value per tessellation point of each face, so every allocated value
+    // must be referenced by at least one output corner.
+    for (std::string_view name : {"normal", "tangent", "bitangent"}) {
+        auto& attr = parallel_mesh.get_indexed_attribute<Scalar>(name);
+        const Index num_values = static_cast<Index>(attr.values().get_num_elements());
+        REQUIRE(num_values >= parallel_mesh.get_num_vertices());
+        REQUIRE(num_values <= parallel_mesh.get_num_corners());
+        std::vector<bool> used(num_values, false);
+        for (Index i : attr.indices().get_all()) {
+            REQUIRE(i < num_values);
+            used[i] = true;
+        }
+        REQUIRE(std::all_of(used.begin(), used.end(), [](bool b) { return b; }));
+    }
+}
+
 TEST_CASE("mesh_subdivision_adaptive_mixed", "[mesh][subdivision]")
 {
     auto mesh = lagrange::testing::load_surface_mesh<double, uint32_t>("open/subdivision/cube.obj");
@@ -632,6 +704,90 @@ TEST_CASE("mesh_subdivision_zero_levels", "[mesh][subdivision]")
     }
 }
 
+TEST_CASE("SubdivisionPlan", "[mesh][subdivision]" LA_SLOW_DEBUG_FLAG)
+{
+    using Scalar = double;
+    using Index = uint32_t;
+    auto mesh = lagrange::testing::load_surface_mesh<Scalar, Index>("open/subdivision/cube.obj");
+    auto nrm_id = lagrange::compute_normal(mesh, lagrange::internal::pi * 0.5);
+    std::string nrm_name(mesh.get_attribute_name(nrm_id));
+
+    lagrange::subdivision::SubdivisionOptions options;
+    options.scheme = lagrange::subdivision::SchemeType::CatmullClark;
+    options.num_levels = 2;
+
+    auto require_approx = [](auto&& A, auto&& B) {
+        REQUIRE(A.rows() == B.rows());
+        REQUIRE(A.cols() == B.cols());
+        REQUIRE((A - B).cwiseAbs().maxCoeff() < Scalar(1e-8));
+    };
+
+    auto check_same_as_subdivide_mesh = [&] {
+        auto expected = lagrange::subdivision::subdivide_mesh(mesh, options);
+        lagrange::subdivision::SubdivisionPlan<Scalar, Index> plan(mesh, options);
+        REQUIRE(plan.get_num_input_vertices() == mesh.get_num_vertices());
+        REQUIRE(plan.get_num_output_vertices() == expected.get_num_vertices());
+
+        auto result = plan.subdivide(mesh);
+        REQUIRE(facet_view(result) == facet_view(expected));
+        require_approx(vertex_view(result), vertex_view(expected));
+        const auto& nrm_result = result.get_indexed_attribute<Scalar>(nrm_name);
+        const auto& nrm_expected = expected.get_indexed_attribute<Scalar>(nrm_name);
+        REQUIRE(
+            lagrange::matrix_view(nrm_result.indices()) ==
+            lagrange::matrix_view(nrm_expected.indices()));
+        require_approx(
+            lagrange::matrix_view(nrm_result.values()),
+            lagrange::matrix_view(nrm_expected.values()));
+        if (!options.output_limit_normals.empty()) {
+            require_approx(
+                lagrange::attribute_matrix_view<Scalar>(result, options.output_limit_normals),
+                lagrange::attribute_matrix_view<Scalar>(expected, options.output_limit_normals));
+        }
+
+        // Moving the control points only requires applying the stencils again
+        auto deformed = mesh;
+        vertex_ref(deformed).col(0) *= Scalar(2);
+        vertex_ref(deformed).col(2).array() += Scalar(1);
+        auto expected_deformed = lagrange::subdivision::subdivide_mesh(deformed, options);
+        auto result_deformed = plan.subdivide(deformed);
+        require_approx(vertex_view(result_deformed), vertex_view(expected_deformed));
+
+        std::vector<Scalar> positions(expected_deformed.get_num_vertices() * 3);
+        plan.evaluate_positions(deformed.get_vertex_to_position().get_all(), positions);
+        require_approx(
+            Eigen::Map<const Eigen::Matrix<Scalar, Eigen::Dynamic, 3, Eigen::RowMajor>>(
+                positions.data(),
+                expected_deformed.get_num_vertices(),
+                3),
+            vertex_view(expected_deformed));
+    };
+
+    SECTION("refined surface")
+    {
+        check_same_as_subdivide_mesh();
+    }
+
+    SECTION("limit surface")
+    {
+        options.use_limit_surface = true;
+        options.output_limit_normals = "limit_normal";
+        check_same_as_subdivide_mesh();
+    }
+
+    SECTION("zero levels")
+    {
+        options.num_levels = 0;
+        check_same_as_subdivide_mesh();
+    }
+
+    SECTION("adaptive refinement is not supported")
+    {
+        options.refinement = lagrange::subdivision::RefinementType::EdgeAdaptive;
+        LA_REQUIRE_THROWS(lagrange::subdivision::SubdivisionPlan<Scalar, Index>(mesh, options));
+    }
+}
+
 TEST_CASE("compute_sharpness", "[mesh][subdivision][sharpness]")
 {
     using Scalar = double;
@@ -14,6 +14,8 @@
 #include <lagrange/SurfaceMesh.h>
 #include <lagrange/image/Array3D.h>
 #include <lagrange/image/View3D.h>
+#include <lagrange/utils/function_ref.h>
+#include <lagrange/utils/span.h>
 
 #include <Eigen/Geometry>
 
@@ -101,6 +103,27 @@ public:
         image::experimental::View3D<const float> image,
         const CameraOptions& options) const;
 
+    ///
+    /// Unproject a collection of rendered images into UV textures and confidence maps.
+    ///
+    /// The UV-space rasterization of the mesh is shared by all views. Views are processed in
+    /// parallel by batches of at most `max_views_in_flight` views, so that no more than this many
+    /// (texture, weight) pairs are alive at any time, and each pair is handed over to the callback
+    /// as soon as its batch is done. The callback is called sequentially, in view order.
+    ///
+    /// @param[in]  images               Input rendered color images.
+    /// @param[in]  options              Camera options, one per image.
+    /// @param[in]  callback             Function receiving the view index and the (texture,
+    ///                                  weight) images of each view.
+    /// @param[in]  max_views_in_flight  Maximum number of views processed concurrently. If 0, the
+    ///                                  number of worker threads is used.
+    ///
+    void weighted_textures_from_renders(
+        span<const image::experimental::View3D<const float>> images,
+        span<const CameraOptions> options,
+        function_ref<void(size_t view, Array3Df texture, Array3Df weight)> callback,
+        size_t max_views_in_flight = 0) const;
+
 private:
     /// @cond LA_INTERNAL_DOCS
 
@@ -0,0 +1,111 @@
+/*
+ * Copyright 2025 Adobe. All rights reserved.
+ * This file is licensed to you under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License. You may obtain a copy
+ * of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR REPRESENTATIONS
+ * OF ANY KIND, either express or implied. See the License for the specific language
+ * governing permissions and limitations under the License.
+ */
+#pragma once
+
+#include <lagrange/SurfaceMesh.h>
+#include <lagrange/utils/value_ptr.h>
+
+#include <cstddef>
+
+namespace lagrange::texproc {
+
+/// @addtogroup module-texproc
+/// @{
+
+///
+/// Options for building a texture solver context.
+///
+struct TextureSolverContextOptions
+{
+    /// Width of the textures processed with the context.
+    size_t width = 1024;
+
+    /// Height of the textures processed with the context.
+    size_t height = 1024;
+
+    /// The number of quadrature samples to use for integration (in {1, 3, 6, 12, 24, 32}).
+    unsigned int quadrature_samples = 6;
+
+    /// Jitter amount per texel (0 to deactivate).
+    double jitter_epsilon = 1e-4;
+};
+
+///
+/// Texel discretization of a mesh with UVs at a given texture resolution, shared by successive
+/// calls to texture_filtering(), texture_stitching() and texture_compositing().
+///
+/// The context holds the UV layout, the texel system and its quadrature, and lazily caches the
+/// factorized systems and multigrid hierarchies built by these functions. The systems of the few
+/// most recently used parameter sets are kept. Processing many textures (channels, material
+/// layers, ...) of the same mesh and resolution through one context only pays for this setup
+/// once. Channels are not limited to 4: filtering and stitching solve all channels as one
+/// multi-column right-hand side, and compositing processes them by groups of up to 4 channels.
+///
+/// @note       A context is not thread-safe: calls sharing a context must not run concurrently.
+///
+/// @tparam     Scalar  Mesh scalar type.
+/// @tparam     Index   Mesh index type.
+///
+template <typename Scalar, typename Index>
+class TextureSolverContext
+{
+public:
+    ///
+    /// Builds the texel system of a mesh at a given resolution.
+    ///
+    /// @param[in]  mesh     Input mesh with UV attributes.
+    /// @param[in]  options  Context options.
+    ///
+    TextureSolverContext(
+        const SurfaceMesh<Scalar, Index>& mesh,
+        const TextureSolverContextOptions& options = {});
+
+    ///
+    /// Destructor.
+    ///
+    ~TextureSolverContext();
+
+    TextureSolverContext(TextureSolverContext&&);
+    TextureSolverContext& operator=(TextureSolverContext&&);
+    TextureSolverContext(const TextureSolverContext&) = delete;
+    TextureSolverContext& operator=(const TextureSolverContext&) = delete;
+
+    /// Options the context was built with.
+    const TextureSolverContextOptions& get_options() const;
+
+    /// Width of the textures processed with the context.
+    size_t get_width() const { return get_options().width; }
+
+    /// Height of the textures processed with the context.
+    size_t get_height() const { return get_options().height; }
+
+    ///
+    /// Releases the cached factorizations and multigrid hierarchies. The texel system is kept.
+    ///
+    void clear_cache();
+
+public:
+    /// @cond LA_INTERNAL_DOCS
+
+    struct Impl;
+    Impl& impl() { return *m_impl; }
+    const Impl& impl() const { return *m_impl; }
+
+private:
+    value_ptr<Impl> m_impl;
+
+    /// @endcond
+};
+
+/// @}
+
+} // namespace lagrange::texproc
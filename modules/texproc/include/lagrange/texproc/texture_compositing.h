@@ -14,6 +14,7 @@
 #include <lagrange/SurfaceMesh.h>
 #include <lagrange/image/Array3D.h>
 #include <lagrange/image/View3D.h>
+#include <lagrange/texproc/TextureSolverContext.h>
 
 #include <optional>
 #include <string_view>
@@ -93,6 +94,28 @@ image::experimental::Array3D<ValueType> texture_compositing(
     std::vector<ConstWeightedTextureView<ValueType>> textures,
     const CompositingOptions& options = {});
 
+///
+/// Composite multiple textures into a single texture, reusing the multigrid hierarchies cached by
+/// a solver context. Channels are split into groups of at most 4, each relaxed with its own
+/// hierarchy in parallel, so any number of channels is supported.
+///
+/// @param[in,out] context    Solver context matching the texture resolution.
+/// @param[in]     textures   Textures to composite. Input textures must have the same dimensions.
+/// @param[in]     options    Compositing options. The quadrature samples and jitter epsilon are
+///                           taken from the context.
+///
+/// @tparam        Scalar     Mesh scalar type.
+/// @tparam        Index      Mesh index type.
+/// @tparam        ValueType  Texture value type.
+///
+/// @return        Texture image resulting from the compositing.
+///
+template <typename Scalar, typename Index, typename ValueType>
+image::experimental::Array3D<ValueType> texture_compositing(
+    TextureSolverContext<Scalar, Index>& context,
+    std::vector<ConstWeightedTextureView<ValueType>> textures,
+    const CompositingOptions& options = {});
+
 /// @}
 
 } // namespace lagrange::texproc
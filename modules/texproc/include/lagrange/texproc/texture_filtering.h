@@ -13,11 +13,16 @@
 
 #include <lagrange/SurfaceMesh.h>
 #include <lagrange/image/View3D.h>
+#include <lagrange/texproc/TextureSolverContext.h>
 
 #include <optional>
 #include <string_view>
 #include <utility>
 
+namespace lagrange::solver {
+class SolverCache;
+} // namespace lagrange::solver
+
 namespace lagrange::texproc {
 
 /// @addtogroup module-texproc
@@ -53,6 +58,13 @@ struct FilteringOptions
 
     /// Clamp out-of-range texels to the given range (nullopt to disable).
     std::optional<std::pair<double, double>> clamp_to_range = std::nullopt;
+
+    /// Optional cache of factorized solvers. When provided, filtering the same mesh and texture
+    /// resolution again reuses the symbolic analysis of the system, and its numeric factorization
+    /// when the weights are unchanged. With a conjugate gradient cache, the previous solution is
+    /// used as a warm start. When filtering with a solver context, the cache replaces the solvers
+    /// owned by the context.
+    solver::SolverCache* solver_cache = nullptr;
 };
 
 ///
@@ -72,6 +84,27 @@ void texture_filtering(
     image::experimental::View3D<ValueType> texture,
     const FilteringOptions& options = {});
 
+///
+/// Smooth or sharpen a texture image, reusing the systems cached by a solver context. Filtering
+/// several textures, or the same texture with different weights, with the same context avoids
+/// rebuilding the gradient-domain operators. All channels are solved together as a multi-column
+/// right-hand side, and any number of channels is supported.
+///
+/// @param[in,out] context    Solver context matching the texture resolution.
+/// @param[in,out] texture    Texture image to filter.
+/// @param[in]     options    Filtering options. The quadrature samples and jitter epsilon are
+///                           taken from the context.
+///
+/// @tparam        Scalar     Mesh scalar type.
+/// @tparam        Index      Mesh index type.
+/// @tparam        ValueType  Texture value type.
+///
+template <typename Scalar, typename Index, typename ValueType>
+void texture_filtering(
+    TextureSolverContext<Scalar, Index>& context,
+    image::experimental::View3D<ValueType> texture,
+    const FilteringOptions& options = {});
+
 /// @}
 
 } // namespace lagrange::texproc
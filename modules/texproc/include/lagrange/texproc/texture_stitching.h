@@ -13,11 +13,16 @@
 
 #include <lagrange/SurfaceMesh.h>
 #include <lagrange/image/View3D.h>
+#include <lagrange/texproc/TextureSolverContext.h>
 
 #include <optional>
 #include <string_view>
 #include <utility>
 
+namespace lagrange::solver {
+class SolverCache;
+} // namespace lagrange::solver
+
 namespace lagrange::texproc {
 
 /// @addtogroup module-texproc
@@ -43,6 +48,11 @@ struct StitchingOptions
     /// Clamp out-of-range texels to the given range (nullopt to disable).
     std::optional<std::pair<double, double>> clamp_to_range = std::nullopt;
 
+    /// Optional cache of factorized solvers. When provided, stitching textures of the same
+    /// resolution on the same mesh reuses the factorization of the system. When stitching with a
+    /// solver context, the cache replaces the solvers owned by the context.
+    solver::SolverCache* solver_cache = nullptr;
+
     /// Initially the boundary texels to random values (for debugging purposes).
     bool __randomize = false;
 };
@@ -64,6 +74,26 @@ void texture_stitching(
     image::experimental::View3D<ValueType> texture,
     const StitchingOptions& options = {});
 
+///
+/// Stitch the seams of a texture, reusing the system factorized by a solver context. Stitching
+/// several textures with the same context factorizes the seam system only once. Channels are
+/// solved in parallel, and any number of channels is supported.
+///
+/// @param[in,out] context    Solver context matching the texture resolution.
+/// @param[in,out] texture    Texture to stitch.
+/// @param[in]     options    Stitching options. The quadrature samples and jitter epsilon are
+///                           taken from the context.
+///
+/// @tparam        Scalar     Mesh scalar type.
+/// @tparam        Index      Mesh index type.
+/// @tparam        ValueType  Image value type.
+///
+template <typename Scalar, typename Index, typename ValueType>
+void texture_stitching(
+    TextureSolverContext<Scalar, Index>& context,
+    image::experimental::View3D<ValueType> texture,
+    const StitchingOptions& options = {});
+
 /// @}
 
 } // namespace lagrange::texproc
@@ -0,0 +1,106 @@
+/*
+ * Copyright 2025 Adobe. All rights reserved.
+ * This file is licensed to you under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License. You may obtain a copy
+ * of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR REPRESENTATIONS
+ * OF ANY KIND, either express or implied. See the License for the specific language
+ * governing permissions and limitations under the License.
+ */
+#pragma once
+
+#include <lagrange/SurfaceMesh.h>
+#include <lagrange/image/Array3D.h>
+#include <lagrange/image/View3D.h>
+#include <lagrange/texproc/texture_compositing.h>
+#include <lagrange/texproc/texture_filtering.h>
+
+#include <cstddef>
+#include <vector>
+
+namespace lagrange::texproc {
+
+/// @addtogroup module-texproc
+/// @{
+
+///
+/// Options for tiled texture processing.
+///
+/// Tiled processing splits the texture into a grid of tiles, each extended by a halo of
+/// neighboring texels. Every tile is processed independently on the part of the mesh whose UVs
+/// overlap it, clipped to the tile and its halo, and only its interior is written back. Memory
+/// usage is thus bounded by the size of a tile (with its halo) times the number of tiles in
+/// flight, instead of the size of the full texture.
+///
+/// @note       A tile only sees the facets overlapping it in UV space. Across a UV seam, the
+///             facets on the other side of the seam generally lie elsewhere in the texture, in
+///             which case the seam is treated as a boundary: tiled filtering does not diffuse
+///             across UV seams whose partner is outside the tile.
+///
+struct TilingOptions
+{
+    /// Size of a tile in texels, excluding the halo.
+    size_t tile_size = 2048;
+
+    /// Width of the halo around each tile, in texels. The halo must be wide enough for the
+    /// solution at the tile interior to be unaffected by the artificial tile boundary. Larger
+    /// gradient weights require larger halos.
+    size_t halo_size = 64;
+
+    /// Maximum number of tiles processed concurrently (0 to use the number of threads). Each tile
+    /// is already processed in parallel internally, and every tile in flight holds its own
+    /// system, so processing tiles one at a time keeps memory usage minimal.
+    size_t max_tiles_in_flight = 1;
+};
+
+///
+/// Smooth or sharpen a texture image associated with a mesh, one tile at a time. This is an
+/// approximation of texture_filtering() whose accuracy is controlled by the halo size.
+///
+/// @param[in]     mesh            Input mesh with UV attributes.
+/// @param[in,out] texture         Texture image to filter.
+/// @param[in]     options         Filtering options. The solver cache is ignored: each tile
+///                                assembles its own system with a distinct sparsity pattern, so
+///                                a factorization cannot be reused across tiles.
+/// @param[in]     tiling_options  Tiling options.
+///
+/// @tparam        Scalar          Mesh scalar type.
+/// @tparam        Index           Mesh index type.
+/// @tparam        ValueType       Texture value type.
+///
+template <typename Scalar, typename Index, typename ValueType>
+void texture_filtering_tiled(
+    const SurfaceMesh<Scalar, Index>& mesh,
+    image::experimental::View3D<ValueType> texture,
+    const FilteringOptions& options = {},
+    const TilingOptions& tiling_options = {});
+
+///
+/// Composite multiple textures into a single texture, one tile at a time. This is an
+/// approximation of texture_compositing() whose accuracy is controlled by the halo size.
+/// Unobserved texels are set to the average color observed in their tile.
+///
+/// @param[in]  mesh            Input mesh with UV attributes.
+/// @param[in]  textures        Textures to composite. Input textures must have the same
+///                             dimensions.
+/// @param[in]  options         Compositing options.
+/// @param[in]  tiling_options  Tiling options.
+///
+/// @tparam     Scalar          Mesh scalar type.
+/// @tparam     Index           Mesh index type.
+/// @tparam     ValueType       Texture value type.
+///
+/// @return     Texture image resulting from the compositing.
+///
+template <typename Scalar, typename Index, typename ValueType>
+image::experimental::Array3D<ValueType> texture_compositing_tiled(
+    const SurfaceMesh<Scalar, Index>& mesh,
+    std::vector<ConstWeightedTextureView<ValueType>> textures,
+    const CompositingOptions& options = {},
+    const TilingOptions& tiling_options = {});
+
+/// @}
+
+} // namespace lagrange::texproc
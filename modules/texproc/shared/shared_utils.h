@@ -21,8 +21,6 @@
 #include <lagrange/scene/internal/shared_utils.h>
 #include <lagrange/texproc/TextureRasterizer.h>
 
-#include <tbb/parallel_for.h>
-
 namespace lagrange::texproc {
 
 using scene::internal::Array3Df;
@@ -163,10 +161,12 @@ std::vector<std::pair<Array3Df, Array3Df>> rasterize_textures_from_renders(
     textures_and_weights.resize(offset + cameras.size());
     const TextureRasterizer<Scalar, Index> rasterizer(mesh, rasterizer_options);
     lagrange::logger().info("Computing confidence maps for {} cameras", cameras.size());
-    tbb::parallel_for(size_t(0), cameras.size(), [&](size_t i) {
-        textures_and_weights[offset + i] =
-            rasterizer.weighted_texture_from_render(renders[i], cameras[i]);
-    });
+    rasterizer.weighted_textures_from_renders(
+        renders,
+        cameras,
+        [&](size_t i, Array3Df texture, Array3Df weight) {
+            textures_and_weights[offset + i] = {std::move(texture), std::move(weight)};
+        });
 
     // Filter confidence across all cameras at each pixel
     lagrange::logger().info(
@@ -12,6 +12,7 @@
 
 #include <lagrange/texproc/TextureRasterizer.h>
 
+#include "depth_utils.h"
 #include "mesh_utils.h"
 
 // clang-format off
@@ -21,8 +22,11 @@
 #include <lagrange/utils/warnon.h>
 // clang-format on
 
+#include <algorithm>
 #include <atomic>
+#include <cmath>
 #include <functional>
+#include <vector>
 
 /// @cond LA_INTERNAL_DOCS
 
@@ -30,70 +34,8 @@ namespace lagrange::texproc {
 
 namespace {
 
-// Internal camera parameters
-//
-// We're using terminology from the OpenGL coordinate systems
-// https://learnopengl.com/Getting-started/Coordinate-Systems
-struct CameraParameters
-{
-    unsigned int res[2];
-    Eigen::Affine3d view_from_world = Eigen::Affine3d::Identity(); // world -> view
-    Eigen::Projective3d ndc_from_view = Eigen::Projective3d::Identity(); // world -> ndc
-    Eigen::Affine2d screen_from_ndc = Eigen::Affine2d::Identity(); // ndc -> screen
-
-    CameraParameters(
-        const Eigen::Affine3d& view_from_world_,
-        const Eigen::Projective3d& ndc_from_view_,
-        unsigned int width,
-        unsigned int height)
-    {
-        res[0] = width;
-        res[1] = height;
-        view_from_world = view_from_world_;
-
-        // Remap depth from [-1, 1] to [0, 1] to improve numerical precision
-        // https://www.reedbeta.com/blog/depth-precision-visualized/
-        ndc_from_view = Eigen::Scaling(1., 1., 0.5) * Eigen::Translation3d(0, 0, 1) *
-                        Eigen::Scaling(1., 1., -1.) * ndc_from_view_;
-
-        // https://www.scratchapixel.com/lessons/3d-basic-rendering/perspective-and-orthographic-projection-matrix/projection-matrix-GPU-rendering-pipeline-clipping.html
-        //
-        // x' = (x + 1) * 0.5 * (w - 1)
-        // y' = (1 - (y+1) * 0.5) * (h - 1)
-        const double w = static_cast<double>(width - 1);
-        const double h = static_cast<double>(height - 1);
-        screen_from_ndc =
-            Eigen::Scaling(w / 2, h / 2) * Eigen::Translation2d(1, 1) * Eigen::Scaling(1., -1.);
-    }
-
-    Vector<double, 2> operator()(Vector<double, 3> p) const
-    {
-        auto p_ndc = world_to_ndc(p);
-        Eigen::Vector2d p_screen = screen_from_ndc * Eigen::Vector2d(p_ndc[0], p_ndc[1]);
-        return {p_screen[0], p_screen[1]};
-    }
-
-    Vector<double, 3> world_to_view(Vector<double, 3> p) const
-    {
-        Eigen::Vector3d p_world(p[0], p[1], p[2]);
-        Eigen::Vector3d p_view = view_from_world * p_world;
-        return {p_view[0], p_view[1], p_view[2]};
-    }
-
-    Vector<double, 3> world_to_ndc(Vector<double, 3> p) const
-    {
-        Eigen::Vector3d p_world(p[0], p[1], p[2]);
-        Eigen::Vector3d p_ndc =
-            (ndc_from_view * (view_from_world * p_world).homogeneous()).hnormalized();
-        return {p_ndc[0], p_ndc[1], p_ndc[2]};
-    }
-
-    Vector<double, 3> camera_position_world() const
-    {
-        Eigen::Vector3d p_world = view_from_world.inverse() * Eigen::Vector3d::Zero();
-        return {p_world[0], p_world[1], p_world[2]};
-    }
-};
+using depth_utils::CameraParameters;
+using depth_utils::Mesh;
 
 // Internal class representing the rendering image and the camera that did the imaging
 template <typename T>
@@ -209,13 +151,6 @@ struct DepthMapWrapper
     const RegularGrid<2, double>& depth_map;
 };
 
-// Internal class representing the geometry
-struct Mesh
-{
-    std::vector<Vector<double, 3>> vertices;
-    std::vector<SimplexIndex<2>> triangles;
-};
-
 // A structure for computing texture images and confidences from renderings and camera parameters.
 // The structure is initialized with the a 3D texture-mapped mesh
 struct TextureAndConfidenceFromRender
@@ -227,6 +162,9 @@ struct TextureAndConfidenceFromRender
     Padding m_padding;
     RegularGrid<2, MyTexelInfo> m_info_map;
 
+    // Indices of the texels assigned a mesh triangle, shared by all renderings
+    std::vector<size_t> m_active_texels;
+
     template <typename Scalar, typename Index>
     TextureAndConfidenceFromRender(
         const SurfaceMesh<Scalar, Index>& surface_mesh,
@@ -273,71 +211,10 @@ struct TextureAndConfidenceFromRender
             res,
             0,
             false);
-    }
-
-    // Computes the depth map associated to a rendering of the geometry using the prescribed
-    // camera parameters and target resolution
-    RegularGrid<2, double> compute_depth(const CameraParameters& camera_parameters) const
-    {
-        // Since we're sampling this as an unshifted RegularGrid, values are at the corners.
-
-        RegularGrid<2, double> depth(camera_parameters.res);
-        for (size_t i = 0; i < depth.size(); i++) {
-            depth[i] = std::numeric_limits<double>::infinity();
-        }
-
-        typename RegularGrid<2>::Range range;
-        for (unsigned int d = 0; d < 2; d++) {
-            range.second[d] = camera_parameters.res[d];
-        }
-
-        Eigen::Projective3d view_from_ndc = camera_parameters.ndc_from_view.inverse();
-        Eigen::Affine2d ndc_from_screen = camera_parameters.screen_from_ndc.inverse();
 
-        for (unsigned int t = 0; t < m_mesh.triangles.size(); t++) {
-            Simplex<double, 2, 2> t_tri;
-            Simplex<double, 3, 2> c_tri;
-            for (unsigned int k = 0; k < 3; k++) {
-                t_tri[k] = camera_parameters(m_mesh.vertices[m_mesh.triangles[t][k]]);
-                c_tri[k] = camera_parameters.world_to_view(m_mesh.vertices[m_mesh.triangles[t][k]]);
-            }
-
-            auto kernel = [&](typename RegularGrid<2>::Index I) {
-                // TODO: Fix upstream rasterization code and make this if() an assert:
-                // la_debug_assert(range.contains(I));
-                if (!range.contains(I)) {
-                    logger().debug(
-                        "Index out of range in depth computation: ({}, {}) / ({}, {})",
-                        I[0],
-                        I[1],
-                        range.second[0],
-                        range.second[1]);
-                    return;
-                }
-                constexpr bool NodeAtCellCenter = false;
-                auto npos_screen = Texels<NodeAtCellCenter>::NodePosition(I);
-                Eigen::Vector2d npos_ndc =
-                    ndc_from_screen * Eigen::Vector2d(npos_screen[0], npos_screen[1]);
-                const double zfar_ndc = 0.0;
-                Eigen::Vector3d npos_view =
-                    (view_from_ndc *
-                     Eigen::Vector3d(npos_ndc[0], npos_ndc[1], zfar_ndc).homogeneous())
-                        .hnormalized();
-                Ray<double, 3> ray;
-                ray.direction = Vector<double, 3>(npos_view[0], npos_view[1], npos_view[2]);
-                std::pair<double, Vector<double, 3>> _bc = c_tri.barycentricCoordinates(ray);
-                Vector<double, 3> bc = _bc.second;
-                Vector<double, 3> p_c = c_tri[0] * bc[0] + c_tri[1] * bc[1] + c_tri[2] * bc[2];
-                double d = -p_c[2];
-                if (d > 0 && d < depth(I)) {
-                    depth(I) = d;
-                }
-            };
-            constexpr bool NodeAtCellCenter = false;
-            Rasterizer2D::template RasterizeNodes<NodeAtCellCenter>(t_tri, kernel, range);
+        for (size_t i = 0; i < m_info_map.size(); i++) {
+            if (m_info_map[i].sIdx != static_cast<size_t>(-1)) m_active_texels.push_back(i);
         }
-
-        return depth;
     }
 
     // Computes the depth map discontinuity
@@ -477,8 +354,9 @@ struct TextureAndConfidenceFromRender
     {
         RegularGrid<2, T> texture(m_info_map.res());
 
-        // Iterate through the pixels of the texture (in parallel)
-        ThreadPool::ParallelFor(0, m_info_map.size(), [&](size_t i) {
+        // Iterate through the active pixels of the texture (in parallel)
+        ThreadPool::ParallelFor(0, m_active_texels.size(), [&](size_t n) {
+            const size_t i = m_active_texels[n];
             if (auto world_texel = texel_world_position(i)) {
                 Vector<double, 2> q = rendering.camera_parameters(*world_texel);
                 texture[i] = rendering.render_map(q);
@@ -503,15 +381,13 @@ struct TextureAndConfidenceFromRender
         RegularGrid<K, double> confidence(m_info_map.res());
 
         // Initialize the confidence to zero
-        for (size_t i = 0; i < confidence.size(); i++) {
-            confidence[i] = 0;
-        }
+        ThreadPool::ParallelFor(0, confidence.size(), [&](size_t i) { confidence[i] = 0; });
 
         typename RegularGrid<K>::Range range;
         for (unsigned int k = 0; k < 2; k++) range.second[k] = camera_params.res[k];
 
         // Compute the depth
-        RegularGrid<K, double> depth = this->compute_depth(camera_params);
+        RegularGrid<K, double> depth = depth_utils::compute_depth(m_mesh, camera_params);
 
         // Compute the depth-confidence
         RegularGrid<K, double> depth_confidence = this->depth_confidence(
@@ -525,8 +401,9 @@ struct TextureAndConfidenceFromRender
 
             DepthMapWrapper depth_map(depth);
 
-            // Iterate through the pixels of the texture (in parallel)
-            ThreadPool::ParallelFor(0, m_info_map.size(), [&](size_t i) {
+            // Iterate through the active pixels of the texture (in parallel)
+            ThreadPool::ParallelFor(0, m_active_texels.size(), [&](size_t n) {
+                const size_t i = m_active_texels[n];
                 if (auto world_texel = texel_world_position_and_normal(i)) {
                     // The position of the texel in world coordinates
                     Vector<double, Dim> p_w = world_texel->first;
@@ -572,7 +449,7 @@ struct TextureAndConfidenceFromRender
 template <unsigned int NumChannels>
 std::pair<image::experimental::Array3D<float>, image::experimental::Array3D<float>>
 weighted_texture_from_render_impl(
-    TextureAndConfidenceFromRender from_render,
+    const TextureAndConfidenceFromRender& from_render,
     image::experimental::View3D<const float> rendered_image,
     const CameraOptions& camera_options,
     const TextureRasterizerOptions& rasterizer_options)
@@ -592,11 +469,11 @@ weighted_texture_from_render_impl(
         rasterizer_options.depth_precision);
 
     // Set all zero-confidence texels to black
-    for (unsigned int i = 0; i < confidence.size(); i++) {
+    ThreadPool::ParallelFor(0, confidence.size(), [&](size_t i) {
         if (!confidence[i]) {
             texture[i] *= 0.;
         }
-    }
+    });
 
     // Convert from internal to external
     auto texture_img =
@@ -674,6 +551,35 @@ auto TextureRasterizer<Scalar, Index>::weighted_texture_from_render(
     }
 }
 
+template <typename Scalar, typename Index>
+void TextureRasterizer<Scalar, Index>::weighted_textures_from_renders(
+    span<const image::experimental::View3D<const float>> images,
+    span<const CameraOptions> options,
+    function_ref<void(size_t view, Array3Df texture, Array3Df weight)> callback,
+    size_t max_views_in_flight) const
+{
+    la_runtime_assert(
+        images.size() == options.size(),
+        "Number of rendered images must match number of cameras");
+    const size_t batch_size =
+        max_views_in_flight > 0 ? max_views_in_flight : size_t(ThreadPool::NumThreads());
+
+    // Each view parallelizes internally, and views of a batch run concurrently with each other
+    std::vector<std::pair<Array3Df, Array3Df>> batch;
+    for (size_t first = 0; first < images.size(); first += batch_size) {
+        const size_t last = std::min(first + batch_size, images.size());
+        batch.resize(last - first);
+        ThreadPool::ParallelFor(first, last, [&](size_t i) {
+            batch[i - first] = weighted_texture_from_render(images[i], options[i]);
+        });
+        for (size_t i = first; i < last; i++) {
+            auto& [texture, weight] = batch[i - first];
+            callback(i, std::move(texture), std::move(weight));
+        }
+        batch.clear();
+    }
+}
+
 void filter_low_confidences(
     span<std::pair<image::experimental::Array3D<float>, image::experimental::Array3D<float>>>
         textures_and_confidences,
@@ -685,8 +591,11 @@ void filter_low_confidences(
     // compositing stage.
     if (textures_and_confidences.empty()) return;
     la_debug_assert(!textures_and_confidences.empty());
-    std::vector<double> confidences(textures_and_confidences.size());
-    for (size_t j = 0; j < textures_and_confidences[0].second.extent(1); j++) {
+
+    // Texels are independent, so rows are processed in parallel
+    const size_t num_rows = textures_and_confidences[0].second.extent(1);
+    ThreadPool::ParallelFor(0, num_rows, [&](size_t j) {
+        std::vector<double> confidences(textures_and_confidences.size());
         for (size_t i = 0; i < textures_and_confidences[0].second.extent(0); i++) {
             // Read all confidence values for this texel
             for (size_t k = 0; k < textures_and_confidences.size(); k++) {
@@ -710,7 +619,7 @@ void filter_low_confidences(
                 textures_and_confidences[k].second(i, j, 0) = static_cast<float>(confidences[k]);
             }
         }
-    }
+    });
 }
 
 #define LA_X_rasterizer_class(_, Scalar, Index) template class TextureRasterizer<Scalar, Index>;
@@ -0,0 +1,53 @@
+/*
+ * Copyright 2025 Adobe. All rights reserved.
+ * This file is licensed to you under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License. You may obtain a copy
+ * of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR REPRESENTATIONS
+ * OF ANY KIND, either express or implied. See the License for the specific language
+ * governing permissions and limitations under the License.
+ */
+#include <lagrange/texproc/TextureSolverContext.h>
+
+#include "TextureSolverContextImpl.h"
+
+#include <lagrange/SurfaceMeshTypes.h>
+
+namespace lagrange::texproc {
+
+template <typename Scalar, typename Index>
+TextureSolverContext<Scalar, Index>::TextureSolverContext(
+    const SurfaceMesh<Scalar, Index>& mesh,
+    const TextureSolverContextOptions& options)
+    : m_impl(make_value_ptr<Impl>(mesh, options))
+{}
+
+template <typename Scalar, typename Index>
+TextureSolverContext<Scalar, Index>::~TextureSolverContext() = default;
+
+template <typename Scalar, typename Index>
+TextureSolverContext<Scalar, Index>::TextureSolverContext(TextureSolverContext&&) = default;
+
+template <typename Scalar, typename Index>
+TextureSolverContext<Scalar, Index>& TextureSolverContext<Scalar, Index>::operator=(
+    TextureSolverContext&&) = default;
+
+template <typename Scalar, typename Index>
+const TextureSolverContextOptions& TextureSolverContext<Scalar, Index>::get_options() const
+{
+    return m_impl->options;
+}
+
+template <typename Scalar, typename Index>
+void TextureSolverContext<Scalar, Index>::clear_cache()
+{
+    m_impl->clear_cache();
+}
+
+#define LA_X_texture_solver_context(_, Scalar, Index) \
+    template class TextureSolverContext<Scalar, Index>;
+LA_SURFACE_MESH_X(texture_solver_context, 0)
+
+} // namespace lagrange::texproc
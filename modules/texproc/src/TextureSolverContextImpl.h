@@ -0,0 +1,316 @@
+/*
+ * Copyright 2025 Adobe. All rights reserved.
+ * This file is licensed to you under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License. You may obtain a copy
+ * of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR REPRESENTATIONS
+ * OF ANY KIND, either express or implied. See the License for the specific language
+ * governing permissions and limitations under the License.
+ */
+#pragma once
+
+#include <lagrange/texproc/TextureSolverContext.h>
+
+#include "mesh_utils.h"
+
+#include <lagrange/image/View3D.h>
+#include <lagrange/utils/build.h>
+
+#include <algorithm>
+#include <array>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace lagrange::texproc {
+
+// Maximum number of channels solved together. Textures with more channels are split into groups.
+constexpr unsigned int MaxGroupChannels = 4;
+
+// Maximum number of systems (parameter sets) cached by a context. The least recently used system is
+// evicted beyond this.
+constexpr size_t MaxCachedSystems = 4;
+
+// Marks a node without texel.
+constexpr size_t InvalidTexel = std::numeric_limits<size_t>::max();
+
+// Texels associated with the nodes of a texel system. Texels are indexed as i + j * width in the
+// unpadded texture.
+struct NodeTexels
+{
+    // Texel providing the input value of each node. Nodes in the padding read the closest texel.
+    std::vector<size_t> sources;
+
+    // Texel receiving the output value of each node, or InvalidTexel for nodes in the padding.
+    std::vector<size_t> targets;
+};
+
+template <typename Scalar, typename Index>
+struct TextureSolverContext<Scalar, Index>::Impl
+{
+    using GradientDomain = MishaK::TSP::GradientDomain<double>;
+
+    template <unsigned int NumChannels>
+    using HierarchicalGradientDomain =
+        MishaK::TSP::HierarchicalGradientDomain<double, Solver, Vector<double, NumChannels>>;
+
+    // System of a filtering or stitching problem, keyed by the parameters it was built with.
+    struct System
+    {
+        std::array<double, 4> parameters;
+
+        // Regularized stiffness matrix.
+        Eigen::SparseMatrix<double> S_reg;
+
+        // Prolongation from the degrees of freedom to the nodes, and the degrees of freedom
+        // (stitching only).
+        Eigen::SparseMatrix<double> P;
+        std::vector<size_t> dofs;
+
+        // System matrix, and the solver used to factorize it when no solver cache is provided.
+        Eigen::SparseMatrix<double> M;
+        solver::CachedSolver<double> solver;
+    };
+
+    // Multigrid hierarchy, with the weights of the system it was last updated with.
+    template <unsigned int NumChannels>
+    struct Hierarchy
+    {
+        unsigned int num_levels = 0;
+        std::pair<double, double> weights = {
+            std::numeric_limits<double>::quiet_NaN(),
+            std::numeric_limits<double>::quiet_NaN()};
+        std::unique_ptr<HierarchicalGradientDomain<NumChannels>> hgd;
+        NodeTexels texels;
+    };
+
+    template <unsigned int NumChannels>
+    using HierarchyList = std::vector<std::unique_ptr<Hierarchy<NumChannels>>>;
+
+#if LAGRANGE_TARGET_BUILD_TYPE(DEBUG)
+    static constexpr bool sanity_check = true;
+#else
+    static constexpr bool sanity_check = false;
+#endif
+    static constexpr bool normalize = true;
+
+    Impl(const SurfaceMesh<Scalar, Index>& mesh, const TextureSolverContextOptions& options_)
+        : options(options_)
+        , wrapper(mesh_utils::create_mesh_wrapper(
+              mesh,
+              RequiresIndexedTexcoords::Yes,
+              CheckFlippedUV::Yes))
+    {
+        la_runtime_assert(options.width > 0 && options.height > 0, "Invalid texture size.");
+        width = static_cast<unsigned int>(options.width);
+        height = static_cast<unsigned int>(options.height);
+        mesh_utils::jitter_texture(wrapper.texcoords, width, height, options.jitter_epsilon);
+        padding = mesh_utils::create_padding(wrapper, width, height);
+    }
+
+    unsigned int padded_width() const { return width + padding.width(); }
+    unsigned int padded_height() const { return height + padding.height(); }
+
+    void check_texture_size(size_t texture_width, size_t texture_height) const
+    {
+        la_runtime_assert(
+            texture_width == width && texture_height == height,
+            fmt::format(
+                "Texture size ({}x{}) does not match the solver context ({}x{}).",
+                texture_width,
+                texture_height,
+                width,
+                height));
+    }
+
+    // Computes the texels associated with the nodes of a texel system.
+    template <typename NodeFunc>
+    NodeTexels compute_node_texels(size_t num_nodes, NodeFunc&& node) const
+    {
+        NodeTexels texels;
+        texels.sources.resize(num_nodes);
+        texels.targets.assign(num_nodes, InvalidTexel);
+
+        // Padding a grid of texel indices gives the texel read by each padded texel
+        RegularGrid<K, size_t> sources;
+        sources.resize(width, height);
+        for (unsigned int j = 0; j < height; j++) {
+            for (unsigned int i = 0; i < width; i++) {
+                sources(i, j) = i + size_t(j) * width;
+            }
+        }
+        padding.pad(sources);
+
+        // Unpadding a grid of node indices gives the node written to each texel
+        RegularGrid<K, size_t> nodes;
+        nodes.resize(padded_width(), padded_height());
+        for (size_t i = 0; i < nodes.size(); i++) nodes[i] = InvalidTexel;
+        for (size_t n = 0; n < num_nodes; n++) {
+            std::pair<unsigned int, unsigned int> coords = node(n);
+            texels.sources[n] = sources(coords.first, coords.second);
+            nodes(coords.first, coords.second) = n;
+        }
+        padding.unpad(nodes);
+        for (unsigned int j = 0; j < height; j++) {
+            for (unsigned int i = 0; i < width; i++) {
+                if (nodes(i, j) != InvalidTexel) {
+                    texels.targets[nodes(i, j)] = i + size_t(j) * width;
+                }
+            }
+        }
+        return texels;
+    }
+
+    // Gradient domain discretization, built on first use.
+    const GradientDomain& gradient_domain()
+    {
+        if (!gd) {
+            gd = std::make_unique<GradientDomain>(
+                options.quadrature_samples,
+                wrapper.num_simplices(),
+                wrapper.num_vertices(),
+                wrapper.num_texcoords(),
+                [&](size_t t, unsigned int k) { return wrapper.vertex_index(t, k); },
+                [&](size_t v) { return wrapper.vertex(v); },
+                [&](size_t t, unsigned int k) { return wrapper.texture_index(t, k); },
+                [&](size_t v) { return wrapper.texcoord(v); }, // solver internally flips v
+                padded_width(),
+                padded_height(),
+                normalize,
+                sanity_check);
+            gd_texels = compute_node_texels(gd->numNodes(), [&](size_t n) { return gd->node(n); });
+            mass = gd->mass();
+        }
+        return *gd;
+    }
+
+    // Gets the system with the given parameters, building it if needed. Systems are kept in least
+    // recently used order, and at most MaxCachedSystems are cached.
+    template <typename BuildFunc>
+    System& system(const std::array<double, 4>& parameters, BuildFunc&& build)
+    {
+        auto it = std::find_if(systems.begin(), systems.end(), [&](const auto& s) {
+            return s->parameters == parameters;
+        });
+        if (it != systems.end()) {
+            std::rotate(it, std::next(it), systems.end());
+            return *systems.back();
+        }
+        if (systems.size() >= MaxCachedSystems) {
+            systems.erase(systems.begin());
+        }
+        auto s = std::make_unique<System>();
+        s->parameters = parameters;
+        build(*s);
+        systems.push_back(std::move(s));
+        return *systems.back();
+    }
+
+    // Gets the k-th multigrid hierarchy for a number of channels, building it if needed. The
+    // returned reference stays valid until the cache is cleared.
+    template <unsigned int NumChannels>
+    Hierarchy<NumChannels>& hierarchy(size_t k, unsigned int num_levels)
+    {
+        auto& list = std::get<NumChannels - 1>(hierarchies);
+        while (list.size() <= k) list.push_back(std::make_unique<Hierarchy<NumChannels>>());
+        auto& entry = *list[k];
+        if (!entry.hgd || entry.num_levels != num_levels) {
+            entry.hgd = std::make_unique<HierarchicalGradientDomain<NumChannels>>(
+                options.quadrature_samples,
+                wrapper.num_simplices(),
+                wrapper.num_vertices(),
+                wrapper.num_texcoords(),
+                [&](size_t t, unsigned int k_) { return wrapper.vertex_index(t, k_); },
+                [&](size_t v) { return wrapper.vertex(v); },
+                [&](size_t t, unsigned int k_) { return wrapper.texture_index(t, k_); },
+                [&](size_t v) { return wrapper.texcoord(v); }, // solver internally flips v
+                padded_width(),
+                padded_height(),
+                num_levels,
+                normalize,
+                sanity_check);
+            entry.num_levels = num_levels;
+            entry.weights = {
+                std::numeric_limits<double>::quiet_NaN(),
+                std::numeric_limits<double>::quiet_NaN()};
+            entry.texels = compute_node_texels(entry.hgd->numNodes(), [&](size_t n) {
+                return entry.hgd->node(n);
+            });
+        }
+        return entry;
+    }
+
+    void clear_cache()
+    {
+        systems.clear();
+        hierarchies = {};
+    }
+
+    TextureSolverContextOptions options;
+    mesh_utils::MeshWrapper<Scalar, Index> wrapper;
+    Padding padding;
+    unsigned int width = 0;
+    unsigned int height = 0;
+
+    std::unique_ptr<GradientDomain> gd;
+    NodeTexels gd_texels;
+    Eigen::SparseMatrix<double> mass;
+
+    std::vector<std::unique_ptr<System>> systems;
+    std::tuple<HierarchyList<1>, HierarchyList<2>, HierarchyList<3>, HierarchyList<4>> hierarchies;
+};
+
+// Splits channels into groups of at most MaxGroupChannels channels. Returns the first channel of
+// each group, followed by the total number of channels.
+inline std::vector<unsigned int> channel_groups(unsigned int num_channels)
+{
+    std::vector<unsigned int> offsets;
+    for (unsigned int c = 0; c < num_channels; c += MaxGroupChannels) offsets.push_back(c);
+    offsets.push_back(num_channels);
+    return offsets;
+}
+
+// Reads the values of a range of texture channels at the source texel of each node.
+template <typename ValueType>
+Eigen::MatrixXd gather_node_values(
+    image::experimental::View3D<ValueType> texture,
+    const NodeTexels& texels,
+    unsigned int first_channel,
+    unsigned int num_channels)
+{
+    const size_t width = texture.extent(0);
+    Eigen::MatrixXd x(texels.sources.size(), num_channels);
+    ThreadPool::ParallelFor(0, texels.sources.size(), [&](size_t n) {
+        const size_t t = texels.sources[n];
+        for (unsigned int c = 0; c < num_channels; c++) {
+            x(n, c) = static_cast<double>(texture(t % width, t / width, first_channel + c));
+        }
+    });
+    return x;
+}
+
+// Writes the values of a range of texture channels at the target texel of each node.
+template <typename ValueType>
+void scatter_node_values(
+    const Eigen::MatrixXd& x,
+    const NodeTexels& texels,
+    unsigned int first_channel,
+    image::experimental::View3D<ValueType> texture)
+{
+    const size_t width = texture.extent(0);
+    ThreadPool::ParallelFor(0, texels.targets.size(), [&](size_t n) {
+        const size_t t = texels.targets[n];
+        if (t == InvalidTexel) return;
+        for (Eigen::Index c = 0; c < x.cols(); c++) {
+            texture(t % width, t / width, first_channel + static_cast<unsigned int>(c)) =
+                static_cast<ValueType>(x(n, c));
+        }
+    });
+}
+
+} // namespace lagrange::texproc
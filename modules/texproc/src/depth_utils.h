@@ -0,0 +1,253 @@
+/*
+ * Copyright 2025 Adobe. All rights reserved.
+ * This file is licensed to you under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License. You may obtain a copy
+ * of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR REPRESENTATIONS
+ * OF ANY KIND, either express or implied. See the License for the specific language
+ * governing permissions and limitations under the License.
+ */
+#pragma once
+
+#include "mesh_utils.h"
+
+// clang-format off
+#include <lagrange/utils/warnoff.h>
+#include <Misha/Texels.h>
+#include <lagrange/utils/warnon.h>
+// clang-format on
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+namespace lagrange::texproc {
+
+namespace depth_utils {
+
+// Internal camera parameters
+//
+// We're using terminology from the OpenGL coordinate systems
+// https://learnopengl.com/Getting-started/Coordinate-Systems
+struct CameraParameters
+{
+    unsigned int res[2];
+    Eigen::Affine3d view_from_world = Eigen::Affine3d::Identity(); // world -> view
+    Eigen::Projective3d ndc_from_view = Eigen::Projective3d::Identity(); // world -> ndc
+    Eigen::Affine2d screen_from_ndc = Eigen::Affine2d::Identity(); // ndc -> screen
+
+    CameraParameters(
+        const Eigen::Affine3d& view_from_world_,
+        const Eigen::Projective3d& ndc_from_view_,
+        unsigned int width,
+        unsigned int height)
+    {
+        res[0] = width;
+        res[1] = height;
+        view_from_world = view_from_world_;
+
+        // Remap depth from [-1, 1] to [0, 1] to improve numerical precision
+        // https://www.reedbeta.com/blog/depth-precision-visualized/
+        ndc_from_view = Eigen::Scaling(1., 1., 0.5) * Eigen::Translation3d(0, 0, 1) *
+                        Eigen::Scaling(1., 1., -1.) * ndc_from_view_;
+
+        // https://www.scratchapixel.com/lessons/3d-basic-rendering/perspective-and-orthographic-projection-matrix/projection-matrix-GPU-rendering-pipeline-clipping.html
+        //
+        // x' = (x + 1) * 0.5 * (w - 1)
+        // y' = (1 - (y+1) * 0.5) * (h - 1)
+        const double w = static_cast<double>(width - 1);
+        const double h = static_cast<double>(height - 1);
+        screen_from_ndc =
+            Eigen::Scaling(w / 2, h / 2) * Eigen::Translation2d(1, 1) * Eigen::Scaling(1., -1.);
+    }
+
+    Vector<double, 2> operator()(Vector<double, 3> p) const
+    {
+        auto p_ndc = world_to_ndc(p);
+        Eigen::Vector2d p_screen = screen_from_ndc * Eigen::Vector2d(p_ndc[0], p_ndc[1]);
+        return {p_screen[0], p_screen[1]};
+    }
+
+    Vector<double, 3> world_to_view(Vector<double, 3> p) const
+    {
+        Eigen::Vector3d p_world(p[0], p[1], p[2]);
+        Eigen::Vector3d p_view = view_from_world * p_world;
+        return {p_view[0], p_view[1], p_view[2]};
+    }
+
+    Vector<double, 3> world_to_ndc(Vector<double, 3> p) const
+    {
+        Eigen::Vector3d p_world(p[0], p[1], p[2]);
+        Eigen::Vector3d p_ndc =
+            (ndc_from_view * (view_from_world * p_world).homogeneous()).hnormalized();
+        return {p_ndc[0], p_ndc[1], p_ndc[2]};
+    }
+
+    Vector<double, 3> camera_position_world() const
+    {
+        Eigen::Vector3d p_world = view_from_world.inverse() * Eigen::Vector3d::Zero();
+        return {p_world[0], p_world[1], p_world[2]};
+    }
+};
+
+// Internal class representing the geometry
+struct Mesh
+{
+    std::vector<Vector<double, 3>> vertices;
+    std::vector<SimplexIndex<2>> triangles;
+};
+
+// Depth of the node I of the screen grid on the view-space triangle c_tri, or a non-positive value
+// if the triangle lies behind the camera
+inline double node_depth(
+    const Simplex<double, 3, 2>& c_tri,
+    typename RegularGrid<2>::Index I,
+    const Eigen::Projective3d& view_from_ndc,
+    const Eigen::Affine2d& ndc_from_screen)
+{
+    constexpr bool NodeAtCellCenter = false;
+    auto npos_screen = Texels<NodeAtCellCenter>::NodePosition(I);
+    Eigen::Vector2d npos_ndc = ndc_from_screen * Eigen::Vector2d(npos_screen[0], npos_screen[1]);
+    const double zfar_ndc = 0.0;
+    Eigen::Vector3d npos_view =
+        (view_from_ndc * Eigen::Vector3d(npos_ndc[0], npos_ndc[1], zfar_ndc).homogeneous())
+            .hnormalized();
+    Ray<double, 3> ray;
+    ray.direction = Vector<double, 3>(npos_view[0], npos_view[1], npos_view[2]);
+    std::pair<double, Vector<double, 3>> _bc = c_tri.barycentricCoordinates(ray);
+    Vector<double, 3> bc = _bc.second;
+    Vector<double, 3> p_c = c_tri[0] * bc[0] + c_tri[1] * bc[1] + c_tri[2] * bc[2];
+    return -p_c[2];
+}
+
+// Computes the depth map associated to a rendering of the geometry using the prescribed camera
+// parameters and target resolution
+//
+// The screen is split into square tiles, and the triangles are binned by the tiles overlapped by
+// their bounding box. Tiles are then rasterized in parallel, each thread owning the depth values of
+// its tile, so the result does not depend on the scheduling.
+inline RegularGrid<2, double> compute_depth(
+    const Mesh& mesh,
+    const CameraParameters& camera_parameters)
+{
+    // Since we're sampling this as an unshifted RegularGrid, values are at the corners.
+
+    RegularGrid<2, double> depth(camera_parameters.res);
+    ThreadPool::ParallelFor(0, depth.size(), [&](size_t i) {
+        depth[i] = std::numeric_limits<double>::infinity();
+    });
+
+    typename RegularGrid<2>::Range range;
+    for (unsigned int d = 0; d < 2; d++) {
+        range.second[d] = camera_parameters.res[d];
+    }
+
+    Eigen::Projective3d view_from_ndc = camera_parameters.ndc_from_view.inverse();
+    Eigen::Affine2d ndc_from_screen = camera_parameters.screen_from_ndc.inverse();
+
+    // Project the triangles once
+    const size_t num_triangles = mesh.triangles.size();
+    std::vector<Simplex<double, 2, 2>> t_tris(num_triangles);
+    std::vector<Simplex<double, 3, 2>> c_tris(num_triangles);
+    ThreadPool::ParallelFor(0, num_triangles, [&](size_t t) {
+        for (unsigned int k = 0; k < 3; k++) {
+            t_tris[t][k] = camera_parameters(mesh.vertices[mesh.triangles[t][k]]);
+            c_tris[t][k] = camera_parameters.world_to_view(mesh.vertices[mesh.triangles[t][k]]);
+        }
+    });
+
+    // Bin the triangles by tile
+    constexpr unsigned int TileSize = 64;
+    unsigned int num_tiles[2];
+    for (unsigned int d = 0; d < 2; d++) {
+        num_tiles[d] = (camera_parameters.res[d] + TileSize - 1) / TileSize;
+    }
+    auto tile_bounds = [&](size_t t, unsigned int d, unsigned int& begin, unsigned int& end) {
+        double lo = std::numeric_limits<double>::infinity();
+        double hi = -std::numeric_limits<double>::infinity();
+        for (unsigned int k = 0; k < 3; k++) {
+            lo = std::min(lo, t_tris[t][k][d]);
+            hi = std::max(hi, t_tris[t][k][d]);
+        }
+        // Triangles with non-finite projections (e.g. through the camera plane) are dropped
+        if (!std::isfinite(lo) || !std::isfinite(hi) || hi < 0 ||
+            lo > static_cast<double>(camera_parameters.res[d])) {
+            begin = end = 0;
+            return;
+        }
+        // Pad by one node to be robust to the rounding conventions of the rasterizer
+        const double res = static_cast<double>(camera_parameters.res[d]);
+        begin = static_cast<unsigned int>(std::clamp(std::floor(lo) - 1, 0., res)) / TileSize;
+        end = static_cast<unsigned int>(std::clamp(std::ceil(hi) + 1, 0., res)) / TileSize + 1;
+        end = std::min(end, num_tiles[d]);
+    };
+    std::vector<size_t> tile_offsets(size_t(num_tiles[0]) * num_tiles[1] + 1, 0);
+    auto for_each_tile = [&](size_t t, auto&& func) {
+        unsigned int begin[2], end[2];
+        for (unsigned int d = 0; d < 2; d++) tile_bounds(t, d, begin[d], end[d]);
+        for (unsigned int j = begin[1]; j < end[1]; j++) {
+            for (unsigned int i = begin[0]; i < end[0]; i++) {
+                func(size_t(j) * num_tiles[0] + i);
+            }
+        }
+    };
+    for (size_t t = 0; t < num_triangles; t++) {
+        for_each_tile(t, [&](size_t tile) { tile_offsets[tile + 1]++; });
+    }
+    for (size_t tile = 1; tile < tile_offsets.size(); tile++) {
+        tile_offsets[tile] += tile_offsets[tile - 1];
+    }
+    std::vector<size_t> tile_triangles(tile_offsets.back());
+    {
+        std::vector<size_t> cursor(tile_offsets.begin(), tile_offsets.end() - 1);
+        for (size_t t = 0; t < num_triangles; t++) {
+            for_each_tile(t, [&](size_t tile) { tile_triangles[cursor[tile]++] = t; });
+        }
+    }
+
+    // Rasterize the tiles
+    ThreadPool::ParallelFor(0, tile_offsets.size() - 1, [&](size_t tile) {
+        typename RegularGrid<2>::Range tile_range;
+        tile_range.first[0] = static_cast<unsigned int>(tile % num_tiles[0]) * TileSize;
+        tile_range.first[1] = static_cast<unsigned int>(tile / num_tiles[0]) * TileSize;
+        for (unsigned int d = 0; d < 2; d++) {
+            tile_range.second[d] =
+                std::min(tile_range.first[d] + TileSize, camera_parameters.res[d]);
+        }
+
+        for (size_t n = tile_offsets[tile]; n < tile_offsets[tile + 1]; n++) {
+            const size_t t = tile_triangles[n];
+
+            auto kernel = [&](typename RegularGrid<2>::Index I) {
+                // TODO: Fix upstream rasterization code and make this if() an assert:
+                // la_debug_assert(range.contains(I));
+                if (!range.contains(I)) {
+                    logger().debug(
+                        "Index out of range in depth computation: ({}, {}) / ({}, {})",
+                        I[0],
+                        I[1],
+                        range.second[0],
+                        range.second[1]);
+                    return;
+                }
+                // Nodes of other tiles are handled by the threads owning them
+                if (!tile_range.contains(I)) return;
+                double d = node_depth(c_tris[t], I, view_from_ndc, ndc_from_screen);
+                if (d > 0 && d < depth(I)) {
+                    depth(I) = d;
+                }
+            };
+            constexpr bool NodeAtCellCenter = false;
+            Rasterizer2D::template RasterizeNodes<NodeAtCellCenter>(t_tris[t], kernel, tile_range);
+        }
+    });
+
+    return depth;
+}
+
+} // namespace depth_utils
+
+} // namespace lagrange::texproc
@@ -36,6 +36,10 @@ using namespace lagrange::texproc::threadpool;
 
 #include <Eigen/Dense>
 
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
 namespace lagrange::texproc {
 
 namespace {
@@ -46,6 +50,23 @@ using MKIndex = unsigned int;
 
 using TexelInfo = typename Texels<NodeAtCellCenter, MKIndex>::template TexelInfo<K>;
 
+// Returns the indices in [0, size) satisfying a predicate, in increasing order
+template <typename Predicate>
+std::vector<size_t> collect_texels(size_t size, Predicate&& pred)
+{
+    constexpr size_t BlockSize = 1 << 16;
+    const size_t num_blocks = (size + BlockSize - 1) / BlockSize;
+    std::vector<std::vector<size_t>> blocks(num_blocks);
+    ThreadPool::ParallelFor(0, num_blocks, [&](size_t b) {
+        for (size_t i = b * BlockSize; i < std::min(size, (b + 1) * BlockSize); i++) {
+            if (pred(i)) blocks[b].push_back(i);
+        }
+    });
+    std::vector<size_t> indices;
+    for (const auto& block : blocks) indices.insert(indices.end(), block.begin(), block.end());
+    return indices;
+}
+
 template <typename Scalar, typename Index, typename ValueType>
 void position_dilation(
     const SurfaceMesh<Scalar, Index>& mesh,
@@ -89,8 +110,7 @@ void position_dilation(
     padding.unpad(texture_positions);
 
     // Set the dilated texel values
-    // ThreadPool::ParallelFor(0, dilated_texel_info.size(), [&](unsigned int, size_t i) {
-    for (unsigned int j = 0; j < texture_positions.res(1); j++) {
+    ThreadPool::ParallelFor(0, texture_positions.res(1), [&](size_t j) {
         for (unsigned int i = 0; i < texture_positions.res(0); i++) {
             if (dilated_texel_info(i, j).sIdx != ~0u) {
                 for (unsigned int c = 0; c < num_channels; c++) {
@@ -98,8 +118,7 @@ void position_dilation(
                 }
             }
         }
-    }
-    // });
+    });
 }
 
 template <typename Scalar, typename Index, typename ValueType>
@@ -118,14 +137,14 @@ void texture_dilation(
     // Copy the texture data into the texture grid
     RegularGrid<K, TexelData> texture_grid;
     texture_grid.resize(texture.extent(0), texture.extent(1));
-    for (unsigned int j = 0; j < texture_grid.res(1); j++) {
+    ThreadPool::ParallelFor(0, texture_grid.res(1), [&](size_t j) {
         for (unsigned int i = 0; i < texture_grid.res(0); i++) {
             texture_grid(i, j) = TexelData(num_channels);
             for (unsigned int c = 0; c < num_channels; c++) {
                 texture_grid(i, j)[c] = texture(i, j, c);
             }
         }
-    }
+    });
 
     Padding padding;
     {
@@ -146,55 +165,111 @@ void texture_dilation(
         return s;
     };
 
-    // The active texels
-    RegularGrid<K, TexelInfo> input_texel_info =
-        Texels<NodeAtCellCenter, MKIndex>::template GetSupportedTexelInfo<Dim, false>(
+    // The active and dilated active texels (computed concurrently)
+    RegularGrid<K, TexelInfo> input_texel_info;
+    RegularGrid<K, TexelInfo> dilated_texel_info;
+    auto supported_texel_info = [&](unsigned int radius) {
+        return Texels<NodeAtCellCenter, MKIndex>::template GetSupportedTexelInfo<Dim, false>(
             wrapper.num_simplices(),
             [&](size_t v) { return wrapper.vertex(v); },
             [&](size_t s) { return wrapper.facet_indices(s); },
             [&](size_t s) { return wrapper.vflipped_simplex_texcoords(s); },
             texture_grid.res(),
-            0,
+            radius,
             false);
+    };
+    ThreadPool::ParallelSections(
+        [&] { input_texel_info = supported_texel_info(0); },
+        [&] { dilated_texel_info = supported_texel_info(options.dilation_radius); });
 
-    // The dilated active texels
-    RegularGrid<K, TexelInfo> dilated_texel_info =
-        Texels<NodeAtCellCenter, MKIndex>::template GetSupportedTexelInfo<Dim, false>(
-            wrapper.num_simplices(),
-            [&](size_t v) { return wrapper.vertex(v); },
-            [&](size_t s) { return wrapper.facet_indices(s); },
-            [&](size_t s) { return wrapper.vflipped_simplex_texcoords(s); },
-            texture_grid.res(),
-            options.dilation_radius,
-            false);
-
-
-    // A functor returning the texture space coordinate associated to a texel
-    auto sample_position = [&](TexelInfo ti) { return texture_space_simplex(ti.sIdx)(ti.bc); };
+    // The texels to dilate, sorted by index
+    auto is_dilated = [&](size_t i) {
+        return dilated_texel_info[i].sIdx != ~0u && input_texel_info[i].sIdx == ~0u;
+    };
+    std::vector<size_t> dilated = collect_texels(dilated_texel_info.size(), is_dilated);
+
+    // The texture space coordinate sampled by each dilated texel
+    std::vector<Vector<double, K>> sample_positions(dilated.size());
+    ThreadPool::ParallelFor(0, dilated.size(), [&](size_t n) {
+        const TexelInfo& ti = dilated_texel_info[dilated[n]];
+        sample_positions[n] = texture_space_simplex(ti.sIdx)(ti.bc);
+    });
+
+    // A dilated texel samples the texture around its sample position, which may cover other
+    // dilated texels. Texels are historically dilated in place, in index order, so a texel reads
+    // the new values of the dilated texels with lower indices and the old values of those with
+    // higher indices. Group the texels into waves that preserve these dependencies, so that the
+    // texels of a wave can be dilated concurrently with the same result.
+    std::vector<unsigned int> waves(dilated.size(), 0);
+    {
+        const TexelData* origin = &texture_grid[0];
+        const int res[] = {
+            static_cast<int>(texture_grid.res(0)),
+            static_cast<int>(texture_grid.res(1))};
+
+        // Calls the functor with the dilated texels in a conservative footprint of the sample
+        auto for_each_dilated_neighbor = [&](size_t n, auto&& func) {
+            const int ix = static_cast<int>(std::floor(sample_positions[n][0]));
+            const int iy = static_cast<int>(std::floor(sample_positions[n][1]));
+            for (int dy = -1; dy <= 1; dy++) {
+                for (int dx = -1; dx <= 1; dx++) {
+                    const int x = ((ix + dx) % res[0] + res[0]) % res[0];
+                    const int y = ((iy + dy) % res[1] + res[1]) % res[1];
+                    const size_t i = static_cast<size_t>(
+                        &texture_grid(static_cast<unsigned int>(x), static_cast<unsigned int>(y)) -
+                        origin);
+                    if (!is_dilated(i)) continue;
+                    auto it = std::lower_bound(dilated.begin(), dilated.end(), i);
+                    func(static_cast<size_t>(it - dilated.begin()));
+                }
+            }
+        };
+
+        for (size_t n = 0; n < dilated.size(); n++) {
+            // After the texels with lower indices it reads
+            for_each_dilated_neighbor(n, [&](size_t m) {
+                if (m < n) waves[n] = std::max(waves[n], waves[m] + 1);
+            });
+            // Before the texels with higher indices it reads
+            for_each_dilated_neighbor(n, [&](size_t m) {
+                if (m > n) waves[m] = std::max(waves[m], waves[n] + 1);
+            });
+        }
+    }
 
-    // A functor returning the texture value at a texel
-    auto sample_value = [&](TexelInfo ti) { return texture_grid(sample_position(ti)); };
+    // Set the dilated texel values, one wave at a time
+    {
+        const unsigned int num_waves =
+            dilated.empty() ? 0 : *std::max_element(waves.begin(), waves.end()) + 1;
+        std::vector<size_t> wave_offsets(num_waves + 1, 0);
+        for (unsigned int w : waves) wave_offsets[w + 1]++;
+        for (unsigned int w = 0; w < num_waves; w++) wave_offsets[w + 1] += wave_offsets[w];
+        std::vector<size_t> wave_texels(dilated.size());
+        {
+            std::vector<size_t> cursor(wave_offsets.begin(), wave_offsets.end() - 1);
+            for (size_t n = 0; n < dilated.size(); n++) wave_texels[cursor[waves[n]]++] = n;
+        }
+        logger().debug("Dilating {} texels in {} waves", dilated.size(), num_waves);
 
-    // Set the dilated texel values
-    // ThreadPool::ParallelFor(0, dilated_texel_info.size(), [&](unsigned int, size_t i) {
-    for (size_t i = 0; i < dilated_texel_info.size(); i++) {
-        if (dilated_texel_info[i].sIdx != ~0u && input_texel_info[i].sIdx == ~0u) {
-            texture_grid[i] = sample_value(dilated_texel_info[i]);
+        for (unsigned int w = 0; w < num_waves; w++) {
+            ThreadPool::ParallelFor(wave_offsets[w], wave_offsets[w + 1], [&](size_t k) {
+                const size_t n = wave_texels[k];
+                texture_grid[dilated[n]] = texture_grid(sample_positions[n]);
+            });
         }
     }
-    // });
 
     // Undo padding
     padding.unpad(texture_grid);
 
     // Copy the texture grid data back into the texture
-    for (unsigned int j = 0; j < texture_grid.res(1); j++) {
+    ThreadPool::ParallelFor(0, texture_grid.res(1), [&](size_t j) {
         for (unsigned int i = 0; i < texture_grid.res(0); i++) {
             for (unsigned int c = 0; c < num_channels; c++) {
                 texture(i, j, c) = texture_grid(i, j)[c];
             }
         }
-    }
+    });
 }
 
 } // namespace
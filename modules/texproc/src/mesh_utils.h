@@ -23,6 +23,7 @@
 #include <lagrange/find_matching_attributes.h>
 #include <lagrange/map_attribute.h>
 #include <lagrange/solver/DirectSolver.h>
+#include <lagrange/solver/SolverCache.h>
 #include <lagrange/triangulate_polygonal_facets.h>
 #include <lagrange/utils/Error.h>
 #include <lagrange/utils/fmt_eigen.h>
@@ -44,6 +45,7 @@ using namespace lagrange::texproc::threadpool;
 
 #include <Eigen/Sparse>
 
+#include <optional>
 #include <random>
 
 namespace lagrange::texproc {
@@ -173,6 +175,37 @@ void clamp_out_of_range(
     }
 }
 
+// Clamps out-of-range texels, stored as the rows of a matrix.
+inline void clamp_out_of_range(
+    Eigen::MatrixXd& x,
+    const MishaK::TSP::GradientDomain<double>& gd,
+    std::pair<double, double> range = {0.0, 1.0})
+{
+    constexpr double eps = 1e-6;
+    size_t num_interior_out_of_range = 0;
+    size_t num_exterior_out_of_range = 0;
+    for (Eigen::Index n = 0; n < x.rows(); ++n) {
+        bool is_strictly_out = false;
+        for (Eigen::Index c = 0; c < x.cols(); c++) {
+            is_strictly_out |= x(n, c) < range.first - eps || x(n, c) > range.second + eps;
+            x(n, c) = std::clamp(x(n, c), range.first, range.second);
+        }
+        if (is_strictly_out) {
+            if (gd.isCovered(static_cast<size_t>(n))) {
+                num_interior_out_of_range++;
+            } else {
+                num_exterior_out_of_range++;
+            }
+        }
+    }
+    if (num_interior_out_of_range || num_exterior_out_of_range) {
+        logger().info(
+            "{} interior and {} exterior texels were out of range and have been clamped.",
+            num_interior_out_of_range,
+            num_exterior_out_of_range);
+    }
+}
+
 template <typename Scalar, typename Index>
 void check_for_flipped_uv(const SurfaceMesh<Scalar, Index>& mesh, AttributeId id)
 {
@@ -470,6 +503,26 @@ Padding create_padding(MeshWrapper<Scalar, Index>& wrapper, unsigned int width,
     return padding;
 }
 
+// Factorize a system matrix, reusing the solver cached for its sparsity pattern if a cache is
+// provided. Otherwise `default_solver` is used. Either way, the factorization is only recomputed
+// if the matrix differs from the one the solver was last factorized with.
+inline solver::CachedSolver<double>& factorize_system(
+    const Eigen::SparseMatrix<double>& M,
+    solver::SolverCache* cache,
+    solver::CachedSolver<double>& default_solver)
+{
+    auto& solver = cache ? cache->get(M) : default_solver;
+    solver.compute(M);
+    switch (solver.info()) {
+    case Eigen::Success: break;
+    case Eigen::NumericalIssue: la_debug_assert("Failed to factor matrix (numerical issue)"); break;
+    case Eigen::NoConvergence: la_debug_assert("Failed to factor matrix (no convergence)"); break;
+    case Eigen::InvalidInput: la_debug_assert("Failed to factor matrix (invalid input)"); break;
+    default: la_debug_assert("Failed to factor matrix");
+    }
+    return solver;
+}
+
 } // namespace mesh_utils
 
 } // namespace lagrange::texproc
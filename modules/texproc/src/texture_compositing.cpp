@@ -12,18 +12,12 @@
 
 #include <lagrange/texproc/texture_compositing.h>
 
+#include "TextureSolverContextImpl.h"
 #include "mesh_utils.h"
 
-#include <lagrange/utils/build.h>
-
-// clang-format off
-#include <lagrange/utils/warnoff.h>
-#include <Src/PreProcessing.h>
-#include <Src/GradientDomain.h>
-#include <lagrange/utils/warnon.h>
-// clang-format on
-
-#include <Eigen/Sparse>
+#include <array>
+#include <functional>
+#include <type_traits>
 
 namespace lagrange::texproc {
 
@@ -37,82 +31,48 @@ bool is_exactly_zero(Scalar x)
     return std::abs(x) < std::numeric_limits<Scalar>::denorm_min();
 }
 
-template <unsigned int NumChannels, typename Scalar, typename Index, typename ValueType>
-image::experimental::Array3D<ValueType> texture_compositing(
-    const SurfaceMesh<Scalar, Index>& mesh,
-    std::vector<ConstWeightedTextureView<ValueType>> textures,
-    const CompositingOptions& options)
+// Composites a group of channels of the textures, using a cached multigrid hierarchy.
+template <unsigned int NumChannels, typename HierarchyType, typename ValueType>
+void texture_compositing(
+    HierarchyType& hierarchy,
+    const std::vector<ConstWeightedTextureView<ValueType>>& textures,
+    unsigned int first_channel,
+    const CompositingOptions& options,
+    image::experimental::View3D<ValueType> composite)
 {
-    struct InputData
-    {
-        RegularGrid<K, Vector<double, NumChannels>> texture;
-        RegularGrid<K, Vector<double, 1>> weights;
-    };
-
-    auto wrapper =
-        mesh_utils::create_mesh_wrapper(mesh, RequiresIndexedTexcoords::Yes, CheckFlippedUV::Yes);
-    std::vector<InputData> in(textures.size());
-    RegularGrid<K, Vector<double, NumChannels>> out;
+    auto& hgd = *hierarchy.hgd;
+    const NodeTexels& texels = hierarchy.texels;
+    const size_t width = textures[0].texture.extent(0);
 
-    for (size_t i = 0; i < textures.size(); i++) {
-        mesh_utils::set_grid(textures[i].texture, in[i].texture);
-        mesh_utils::set_grid(textures[i].weights, in[i].weights);
-    }
-
-    unsigned int width = in[0].texture.res(0);
-    unsigned int height = in[0].texture.res(1);
-
-    mesh_utils::jitter_texture(wrapper.texcoords, width, height, options.jitter_epsilon);
-
-    Padding padding = mesh_utils::create_padding(wrapper, width, height);
-    tbb::parallel_for(size_t(0), textures.size(), [&](size_t i) {
-        padding.pad(in[i].texture);
-        padding.pad(in[i].weights);
-    });
-    width += padding.width();
-    height += padding.height();
-
-    out.resize(width, height);
-
-    // Construct the hierarchical gradient domain object
-    // TODO: Compute number of levels based on texture size
-    const bool normalize = true;
-#if LAGRANGE_TARGET_BUILD_TYPE(DEBUG)
-    const bool sanity_check = true;
-#else
-    const bool sanity_check = false;
-#endif
-    HierarchicalGradientDomain<double, Solver, Vector<double, NumChannels>> hgd(
-        options.quadrature_samples,
-        wrapper.num_simplices(),
-        wrapper.num_vertices(),
-        wrapper.num_texcoords(),
-        [&](size_t t, unsigned int k) { return wrapper.vertex_index(t, k); },
-        [&](size_t v) { return wrapper.vertex(v); },
-        [&](size_t t, unsigned int k) { return wrapper.texture_index(t, k); },
-        [&](size_t v) { return wrapper.texcoord(v); }, // solver internally flips the v coordinate
-        width,
-        height,
-        options.solver.num_multigrid_levels,
-        normalize,
-        sanity_check);
+    // Input values at texel t
+    auto weight = [&](size_t i, size_t t) -> double {
+        return textures[i].weights(t % width, t / width, 0);
+    };
+    auto color = [&](size_t i, size_t t) {
+        Vector<double, NumChannels> value;
+        for (unsigned int c = 0; c < NumChannels; c++) {
+            value[c] =
+                static_cast<double>(textures[i].texture(t % width, t / width, first_channel + c));
+        }
+        return value;
+    };
 
     // Get the pointers to the solver constraints and solution
     span<Vector<double, NumChannels>> x{hgd.x(), hgd.numNodes()};
     span<Vector<double, NumChannels>> b{hgd.b(), hgd.numNodes()};
 
-    // Compute the sum of weights for texel n
-    auto compute_weight_sum = [&](unsigned int row, unsigned int col) {
+    // Compute the sum of weights for texel t
+    auto compute_weight_sum = [&](size_t t) {
         double weight_sum = 0;
-        for (unsigned int i = 0; i < in.size(); i++) {
-            weight_sum += in[i].weights(row, col)[0];
+        for (size_t i = 0; i < textures.size(); i++) {
+            weight_sum += weight(i, t);
         }
         return weight_sum;
     };
 
-    // Normalization factor for texel n
-    auto normalization_weight = [&](unsigned int row, unsigned int col, bool is_grad) -> double {
-        const double weight_sum = compute_weight_sum(row, col);
+    // Normalization factor for texel t
+    auto normalization_weight = [&](size_t t, bool is_grad) -> double {
+        const double weight_sum = compute_weight_sum(t);
         if (is_grad && options.smooth_low_weight_areas && weight_sum < 1.) {
             // Do not normalize gradients in low-confidence areas. This reduces the importance of
             // the gradient terms and smooths the resulting texture in those areas.
@@ -123,14 +83,14 @@ image::experimental::Array3D<ValueType> texture_compositing(
     };
 
     // Compute the weighted sum of texture values
-    for (size_t n = 0; n < hgd.numNodes(); n++) {
-        auto [row, col] = hgd.node(n);
-
-        const double scale = normalization_weight(row, col, false);
-        for (unsigned int i = 0; i < in.size(); i++) {
-            x[n] += in[i].texture(row, col) * in[i].weights(row, col)[0] * scale;
+    ThreadPool::ParallelFor(0, hgd.numNodes(), [&](size_t n) {
+        const size_t t = texels.sources[n];
+        const double scale = normalization_weight(t, false);
+        x[n] = Vector<double, NumChannels>();
+        for (size_t i = 0; i < textures.size(); i++) {
+            x[n] += color(i, t) * weight(i, t) * scale;
         }
-    }
+    });
 
     // Set unobserved texels to the average observed color
     {
@@ -138,8 +98,7 @@ image::experimental::Array3D<ValueType> texture_compositing(
         size_t num_observed_texels = 0;
         size_t num_unobserved_texels = 0;
         for (size_t n = 0; n < hgd.numNodes(); n++) {
-            auto [row, col] = hgd.node(n);
-            if (!is_exactly_zero(compute_weight_sum(row, col))) {
+            if (!is_exactly_zero(compute_weight_sum(texels.sources[n]))) {
                 avg_observed_color += x[n];
                 num_observed_texels++;
             } else {
@@ -155,8 +114,7 @@ image::experimental::Array3D<ValueType> texture_compositing(
             avg_observed_color /= static_cast<double>(num_observed_texels);
         }
         for (size_t n = 0; n < hgd.numNodes(); n++) {
-            auto [row, col] = hgd.node(n);
-            if (is_exactly_zero(compute_weight_sum(row, col))) {
+            if (is_exactly_zero(compute_weight_sum(texels.sources[n]))) {
                 x[n] = avg_observed_color;
             }
         }
@@ -174,24 +132,22 @@ image::experimental::Array3D<ValueType> texture_compositing(
         {
             // Compute the edge differences
             std::vector<Vector<double, NumChannels>> edge_differences(hgd.numEdges());
-            for (size_t e = 0; e < hgd.numEdges(); e++) {
+            ThreadPool::ParallelFor(0, hgd.numEdges(), [&](size_t e) {
                 std::pair<size_t, size_t> end_points = hgd.edge(e);
 
-                auto [row1, col1] = hgd.node(end_points.first);
-                auto [row2, col2] = hgd.node(end_points.second);
-
-                const double scale1 = normalization_weight(row1, col1, true);
-                const double scale2 = normalization_weight(row2, col2, true);
-                for (unsigned int i = 0; i < in.size(); i++) {
-                    double weight = in[i].weights(row1, col1)[0] * scale1 *
-                                    in[i].weights(row2, col2)[0] * scale2;
-                    if (weight > 0) {
-                        weight = sqrt(weight);
-                        edge_differences[e] +=
-                            (in[i].texture(row2, col2) - in[i].texture(row1, col1)) * weight;
+                const size_t t1 = texels.sources[end_points.first];
+                const size_t t2 = texels.sources[end_points.second];
+
+                const double scale1 = normalization_weight(t1, true);
+                const double scale2 = normalization_weight(t2, true);
+                for (size_t i = 0; i < textures.size(); i++) {
+                    double w = weight(i, t1) * scale1 * weight(i, t2) * scale2;
+                    if (w > 0) {
+                        w = sqrt(w);
+                        edge_differences[e] += (color(i, t2) - color(i, t1)) * w;
                     }
                 }
-            }
+            });
 
             // Compute the associated divergence
             hgd.divergence(&edge_differences[0], &gradient_b[0]);
@@ -203,9 +159,12 @@ image::experimental::Array3D<ValueType> texture_compositing(
         }
     }
 
-    // Compute the system matrix
+    // Compute the system matrix, unless the hierarchy is already set up for these weights
     const double gradient_weight = 1.0;
-    hgd.updateSystem(options.value_weight, gradient_weight);
+    if (hierarchy.weights != std::make_pair(options.value_weight, gradient_weight)) {
+        hgd.updateSystem(options.value_weight, gradient_weight);
+        hierarchy.weights = {options.value_weight, gradient_weight};
+    }
 
     // Relax the solution
     for (unsigned int v = 0; v < options.solver.num_v_cycles; ++v) {
@@ -217,41 +176,19 @@ image::experimental::Array3D<ValueType> texture_compositing(
     }
 
     // Put the texel values back into the texture
-    for (size_t n = 0; n < hgd.numNodes(); n++) {
-        std::pair<unsigned int, unsigned int> coords = hgd.node(n);
-        out(coords.first, coords.second) = x[n];
-    }
-
-    // Undo padding
-    padding.unpad(out);
-
-    image::experimental::Array3D<ValueType> composite =
-        image::experimental::create_image<ValueType>(
-            textures[0].texture.extent(0),
-            textures[0].texture.extent(1),
-            textures[0].texture.extent(2));
-
-    // Copy the texture grid data back into the texture
-    for (unsigned int j = 0; j < out.res(1); j++) {
-        for (unsigned int i = 0; i < out.res(0); i++) {
-            for (unsigned int c = 0; c < NumChannels; c++) {
-                composite(i, j, c) = out(i, j)[c];
-            }
+    ThreadPool::ParallelFor(0, hgd.numNodes(), [&](size_t n) {
+        const size_t t = texels.targets[n];
+        if (t == InvalidTexel) return;
+        for (unsigned int c = 0; c < NumChannels; c++) {
+            composite(t % width, t / width, first_channel + c) = static_cast<ValueType>(x[n][c]);
         }
-    }
-
-    return composite;
+    });
 }
 
-} // namespace
-
-template <typename Scalar, typename Index, typename ValueType>
-image::experimental::Array3D<ValueType> texture_compositing(
-    const SurfaceMesh<Scalar, Index>& mesh,
-    std::vector<ConstWeightedTextureView<ValueType>> textures,
-    const CompositingOptions& options)
+// Checks that the input textures and weights have consistent dimensions.
+template <typename ValueType>
+void check_textures(const std::vector<ConstWeightedTextureView<ValueType>>& textures)
 {
-    // Input sanity checks
     la_runtime_assert(!textures.empty(), "No textures to composite");
     for (auto& texture : textures) {
         if (texture.texture.extent(0) != textures[0].texture.extent(0) ||
@@ -279,27 +216,106 @@ image::experimental::Array3D<ValueType> texture_compositing(
             throw std::runtime_error("Weights must have the same dimensions as the texture");
         }
     }
-    if (!textures.size()) throw std::runtime_error("Expected at least one texture");
+}
 
+} // namespace
 
-    unsigned int num_channels = static_cast<unsigned int>(textures[0].texture.extent(2));
-    image::experimental::Array3D<ValueType> output;
+template <typename Scalar, typename Index, typename ValueType>
+image::experimental::Array3D<ValueType> texture_compositing(
+    TextureSolverContext<Scalar, Index>& context,
+    std::vector<ConstWeightedTextureView<ValueType>> textures,
+    const CompositingOptions& options)
+{
+    // Input sanity checks
+    check_textures(textures);
+    auto& impl = context.impl();
+    impl.check_texture_size(textures[0].texture.extent(0), textures[0].texture.extent(1));
+
+    const unsigned int num_channels = static_cast<unsigned int>(textures[0].texture.extent(2));
+    image::experimental::Array3D<ValueType> composite =
+        image::experimental::create_image<ValueType>(
+            textures[0].texture.extent(0),
+            textures[0].texture.extent(1),
+            num_channels);
+    ThreadPool::ParallelFor(0, composite.extent(1), [&](size_t j) {
+        for (size_t i = 0; i < composite.extent(0); i++) {
+            for (unsigned int c = 0; c < num_channels; c++) {
+                composite(i, j, c) = ValueType(0);
+            }
+        }
+    });
 
-    switch (num_channels) {
-    case 1: output = texture_compositing<1>(mesh, textures, options); break;
-    case 2: output = texture_compositing<2>(mesh, textures, options); break;
-    case 3: output = texture_compositing<3>(mesh, textures, options); break;
-    case 4: output = texture_compositing<4>(mesh, textures, options); break;
-    default: la_debug_assert("Only 1, 2, 3, or 4 channels supported");
+    // Each group of channels is solved with its own multigrid hierarchy, fetched (or built)
+    // sequentially since the context is not thread-safe, then relaxed in parallel.
+    const std::vector<unsigned int> groups = channel_groups(num_channels);
+    const size_t num_groups = groups.size() - 1;
+    const unsigned int num_levels = options.solver.num_multigrid_levels;
+    std::vector<std::function<void()>> tasks(num_groups);
+    std::array<size_t, MaxGroupChannels> num_groups_of_size = {};
+    for (size_t g = 0; g < num_groups; g++) {
+        const unsigned int first_channel = groups[g];
+        auto view = composite.to_mdspan();
+        auto make_task = [&, first_channel, view](auto& hierarchy, auto num_group_channels) {
+            constexpr unsigned int N = decltype(num_group_channels)::value;
+            return [&hierarchy, &textures, &options, first_channel, view] {
+                texture_compositing<N>(hierarchy, textures, first_channel, options, view);
+            };
+        };
+        // Groups of the same size use distinct hierarchies, indexed by their rank among them
+        const unsigned int group_size = groups[g + 1] - first_channel;
+        const size_t k = num_groups_of_size[group_size - 1]++;
+        switch (group_size) {
+        case 1:
+            tasks[g] = make_task(
+                impl.template hierarchy<1>(k, num_levels),
+                std::integral_constant<unsigned int, 1>{});
+            break;
+        case 2:
+            tasks[g] = make_task(
+                impl.template hierarchy<2>(k, num_levels),
+                std::integral_constant<unsigned int, 2>{});
+            break;
+        case 3:
+            tasks[g] = make_task(
+                impl.template hierarchy<3>(k, num_levels),
+                std::integral_constant<unsigned int, 3>{});
+            break;
+        default:
+            tasks[g] = make_task(
+                impl.template hierarchy<4>(k, num_levels),
+                std::integral_constant<unsigned int, 4>{});
+            break;
+        }
     }
+    ThreadPool::ParallelFor(0, num_groups, [&](size_t g) { tasks[g](); });
+
+    return composite;
+}
 
-    return output;
+template <typename Scalar, typename Index, typename ValueType>
+image::experimental::Array3D<ValueType> texture_compositing(
+    const SurfaceMesh<Scalar, Index>& mesh,
+    std::vector<ConstWeightedTextureView<ValueType>> textures,
+    const CompositingOptions& options)
+{
+    check_textures(textures);
+    TextureSolverContextOptions context_options;
+    context_options.width = textures[0].texture.extent(0);
+    context_options.height = textures[0].texture.extent(1);
+    context_options.quadrature_samples = options.quadrature_samples;
+    context_options.jitter_epsilon = options.jitter_epsilon;
+    TextureSolverContext<Scalar, Index> context(mesh, context_options);
+    return texture_compositing(context, std::move(textures), options);
 }
 
 #define LA_X_texture_compositing(ValueType, Scalar, Index)                \
     template image::experimental::Array3D<ValueType> texture_compositing( \
         const SurfaceMesh<Scalar, Index>& mesh,                           \
         std::vector<ConstWeightedTextureView<ValueType>> textures,        \
+        const CompositingOptions& options);                               \
+    template image::experimental::Array3D<ValueType> texture_compositing( \
+        TextureSolverContext<Scalar, Index>& context,                     \
+        std::vector<ConstWeightedTextureView<ValueType>> textures,        \
         const CompositingOptions& options);
 #define LA_X_texture_compositing_aux(_, ValueType) LA_SURFACE_MESH_X(texture_compositing, ValueType)
 LA_ATTRIBUTE_X(texture_compositing_aux, 0)
@@ -14,166 +14,76 @@
 
 #include <lagrange/AttributeTypes.h>
 #include <lagrange/SurfaceMeshTypes.h>
-#include <lagrange/utils/build.h>
 
+#include "TextureSolverContextImpl.h"
 #include "mesh_utils.h"
 
-// clang-format off
-#include <lagrange/utils/warnoff.h>
-#include <Src/PreProcessing.h>
-#include <Src/GradientDomain.h>
-#include <lagrange/utils/warnon.h>
-// clang-format on
-
 namespace lagrange::texproc {
 
-namespace {
-
-using namespace MishaK::TSP;
-
-template <unsigned int NumChannels, typename Scalar, typename Index, typename ValueType>
-void texture_gradient_modulation(
-    const SurfaceMesh<Scalar, Index>& mesh,
+template <typename Scalar, typename Index, typename ValueType>
+void texture_filtering(
+    TextureSolverContext<Scalar, Index>& context,
     image::experimental::View3D<ValueType> texture,
     const FilteringOptions& options)
 {
-    auto wrapper =
-        mesh_utils::create_mesh_wrapper(mesh, RequiresIndexedTexcoords::Yes, CheckFlippedUV::Yes);
-    RegularGrid<K, Vector<double, NumChannels>> grid;
-
-    mesh_utils::set_grid(texture, grid);
-
-    mesh_utils::jitter_texture(wrapper.texcoords, grid.res(0), grid.res(1), options.jitter_epsilon);
-
-    Padding padding = mesh_utils::create_padding(wrapper, grid.res(0), grid.res(1));
-    padding.pad(grid);
-
-    // Construct the gradient-domain object
-    // TODO: Switch to multi-grid solver
-    const bool normalize = true;
-#if LAGRANGE_TARGET_BUILD_TYPE(DEBUG)
-    const bool sanity_check = true;
-#else
-    const bool sanity_check = false;
-#endif
-    GradientDomain<double> gd(
-        options.quadrature_samples,
-        wrapper.num_simplices(),
-        wrapper.num_vertices(),
-        wrapper.num_texcoords(),
-        [&](size_t t, unsigned int k) { return wrapper.vertex_index(t, k); },
-        [&](size_t v) { return wrapper.vertex(v); },
-        [&](size_t t, unsigned int k) { return wrapper.texture_index(t, k); },
-        [&](size_t v) { return wrapper.texcoord(v); }, // solver internally flips the v coordinate
-        grid.res(0),
-        grid.res(1),
-        normalize,
-        sanity_check);
-
-    std::vector<Vector<double, NumChannels>> x(gd.numNodes()), b(gd.numNodes());
+    auto& impl = context.impl();
+    impl.check_texture_size(texture.extent(0), texture.extent(1));
+    const auto& gd = impl.gradient_domain();
+    const unsigned int num_channels = static_cast<unsigned int>(texture.extent(2));
 
     // Copy the texture values into the vector
-    for (size_t n = 0; n < gd.numNodes(); n++) {
-        std::pair<unsigned int, unsigned int> coords = gd.node(n);
-        x[n] = grid(coords.first, coords.second);
-    }
+    Eigen::MatrixXd x = gather_node_values(texture, impl.gd_texels, 0, num_channels);
 
     // Compute the system matrix
     const double eps = options.stiffness_regularization_weight;
-    const Eigen::SparseMatrix<double> S_reg =
-        mesh_utils::laplacian_regularization(gd.stiffness(), eps);
-    const Eigen::SparseMatrix<double> M =
-        gd.mass() * options.value_weight + S_reg * options.gradient_weight;
-
-    // Construct the constraints
-    {
-        std::vector<Vector<double, NumChannels>> mass_b(gd.numNodes());
-
-        // Get the constraints from the values
-        gd.mass(&x[0], &mass_b[0]);
-
-        // Get the constraints from the gradients using S_reg (not raw stiffness)
-        // This ensures consistency between LHS and RHS
-        for (unsigned int c = 0; c < NumChannels; c++) {
-            Eigen::VectorXd x_c(gd.numNodes());
-            for (size_t n = 0; n < gd.numNodes(); n++) {
-                x_c[n] = x[n][c];
-            }
-            Eigen::VectorXd stiffness_b_c = S_reg * x_c;
-            for (size_t n = 0; n < gd.numNodes(); n++) {
-                b[n][c] = mass_b[n][c] * options.value_weight +
-                          stiffness_b_c[n] * options.gradient_weight * options.gradient_scale;
-            }
-        }
-    }
-
-    // Construct/factor the solver
-    Solver solver(M);
-    switch (solver.info()) {
-    case Eigen::Success: break;
-    case Eigen::NumericalIssue: la_debug_assert("Failed to factor matrix (numerical issue)"); break;
-    case Eigen::NoConvergence: la_debug_assert("Failed to factor matrix (no convergence)"); break;
-    case Eigen::InvalidInput: la_debug_assert("Failed to factor matrix (invalid input)"); break;
-    default: la_debug_assert("Failed to factor matrix");
-    }
-
-    // Solve the system per channel
-    for (unsigned int c = 0; c < NumChannels; c++) {
-        Eigen::VectorXd _b(gd.numNodes());
-        for (size_t n = 0; n < gd.numNodes(); n++) {
-            _b[n] = b[n][c];
-        }
-        Eigen::VectorXd _x = solver.solve(_b);
-        for (size_t n = 0; n < gd.numNodes(); n++) {
-            x[n][c] = _x[n];
-        }
-    }
+    auto& system = impl.system(
+        {0., options.value_weight, options.gradient_weight, eps},
+        [&](auto& s) {
+            s.S_reg = mesh_utils::laplacian_regularization(gd.stiffness(), eps);
+            s.M = impl.mass * options.value_weight + s.S_reg * options.gradient_weight;
+        });
+
+    // Construct the constraints from the values and the gradients, using S_reg (not raw stiffness)
+    // to ensure consistency between LHS and RHS
+    const Eigen::MatrixXd b =
+        (impl.mass * x) * options.value_weight +
+        (system.S_reg * x) * (options.gradient_weight * options.gradient_scale);
+
+    // Solve the system for all channels at once
+    auto& solver = mesh_utils::factorize_system(system.M, options.solver_cache, system.solver);
+    x = solver.solve(b);
 
     if (options.clamp_to_range.has_value()) {
-        mesh_utils::clamp_out_of_range<NumChannels>(x, gd, options.clamp_to_range.value());
+        mesh_utils::clamp_out_of_range(x, gd, options.clamp_to_range.value());
     }
 
     // Put the texel values back into the texture
-    for (size_t n = 0; n < gd.numNodes(); n++) {
-        std::pair<unsigned int, unsigned int> coords = gd.node(n);
-        grid(coords.first, coords.second) = x[n];
-    }
-
-    // Undo padding
-    padding.unpad(grid);
-
-    // Copy the texture grid data back into the texture
-    for (unsigned int j = 0; j < grid.res(1); j++) {
-        for (unsigned int i = 0; i < grid.res(0); i++) {
-            for (unsigned int c = 0; c < NumChannels; c++) {
-                texture(i, j, c) = grid(i, j)[c];
-            }
-        }
-    }
+    scatter_node_values(x, impl.gd_texels, 0, texture);
 }
 
-} // namespace
-
 template <typename Scalar, typename Index, typename ValueType>
 void texture_filtering(
     const SurfaceMesh<Scalar, Index>& mesh,
     image::experimental::View3D<ValueType> texture,
     const FilteringOptions& options)
 {
-    unsigned int num_channels = static_cast<unsigned int>(texture.extent(2));
-    switch (num_channels) {
-    case 1: texture_gradient_modulation<1>(mesh, texture, options); break;
-    case 2: texture_gradient_modulation<2>(mesh, texture, options); break;
-    case 3: texture_gradient_modulation<3>(mesh, texture, options); break;
-    case 4: texture_gradient_modulation<4>(mesh, texture, options); break;
-    default: la_debug_assert("Only 1, 2, 3, or 4 channels supported");
-    }
+    TextureSolverContextOptions context_options;
+    context_options.width = texture.extent(0);
+    context_options.height = texture.extent(1);
+    context_options.quadrature_samples = options.quadrature_samples;
+    context_options.jitter_epsilon = options.jitter_epsilon;
+    TextureSolverContext<Scalar, Index> context(mesh, context_options);
+    texture_filtering(context, texture, options);
 }
 
 #define LA_X_texture_filtering(ValueType, Scalar, Index) \
     template void texture_filtering(                     \
         const SurfaceMesh<Scalar, Index>& mesh,          \
         image::experimental::View3D<ValueType> texture,  \
+        const FilteringOptions& options);                \
+    template void texture_filtering(                     \
+        TextureSolverContext<Scalar, Index>& context,    \
+        image::experimental::View3D<ValueType> texture,  \
         const FilteringOptions& options);
 #define LA_X_texture_filtering_aux(_, ValueType) LA_SURFACE_MESH_X(texture_filtering, ValueType)
 LA_ATTRIBUTE_X(texture_filtering_aux, 0)
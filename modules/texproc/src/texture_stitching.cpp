@@ -12,199 +12,122 @@
 
 #include <lagrange/texproc/texture_stitching.h>
 
+#include "TextureSolverContextImpl.h"
 #include "mesh_utils.h"
 
-#include <lagrange/utils/build.h>
-
 // clang-format off
 #include <lagrange/utils/warnoff.h>
 #include <tbb/parallel_sort.h>
-#include <Src/PreProcessing.h>
-#include <Src/GradientDomain.h>
 #include <lagrange/utils/warnon.h>
 // clang-format on
 
+#include <algorithm>
 #include <random>
-#include <unordered_set>
+#include <tuple>
 
 namespace lagrange::texproc {
 
-namespace {
-
-using namespace MishaK::TSP;
-
-template <unsigned int NumChannels, typename Scalar, typename Index, typename ValueType>
+template <typename Scalar, typename Index, typename ValueType>
 void texture_stitching(
-    const SurfaceMesh<Scalar, Index>& mesh,
+    TextureSolverContext<Scalar, Index>& context,
     image::experimental::View3D<ValueType> texture,
     const StitchingOptions& options)
 {
-    auto wrapper =
-        mesh_utils::create_mesh_wrapper(mesh, RequiresIndexedTexcoords::Yes, CheckFlippedUV::Yes);
-    RegularGrid<K, Vector<double, NumChannels>> grid;
-
-    mesh_utils::set_grid(texture, grid);
-
-    mesh_utils::jitter_texture(wrapper.texcoords, grid.res(0), grid.res(1), options.jitter_epsilon);
-
-    Padding padding = mesh_utils::create_padding(wrapper, grid.res(0), grid.res(1));
-    padding.pad(grid);
-
-    // Construct the gradient-domain object
-    const bool normalize = true;
-#if LAGRANGE_TARGET_BUILD_TYPE(DEBUG)
-    const bool sanity_check = true;
-#else
-    const bool sanity_check = false;
-#endif
-    GradientDomain<double> gd(
-        options.quadrature_samples,
-        wrapper.num_simplices(),
-        wrapper.num_vertices(),
-        wrapper.num_texcoords(),
-        [&](size_t t, unsigned int k) { return wrapper.vertex_index(t, k); },
-        [&](size_t v) { return wrapper.vertex(v); },
-        [&](size_t t, unsigned int k) { return wrapper.texture_index(t, k); },
-        [&](size_t v) { return wrapper.texcoord(v); }, // solver internally flips the v coordinate
-        grid.res(0),
-        grid.res(1),
-        normalize,
-        sanity_check);
-
-    // Compute the prolongation matrix from the degrees of freedom to texels
-    std::unordered_set<size_t> dof_set;
-    Eigen::SparseMatrix<double> P, Pt;
-    {
-        if (options.exterior_only) {
-            for (size_t n = 0; n < gd.numNodes(); n++) {
-                if (!gd.isCovered(n)) {
-                    dof_set.insert(n);
+    auto& impl = context.impl();
+    impl.check_texture_size(texture.extent(0), texture.extent(1));
+    const auto& gd = impl.gradient_domain();
+    const unsigned int num_channels = static_cast<unsigned int>(texture.extent(2));
+
+    // Compute the prolongation matrix from the degrees of freedom to texels, and the system matrix
+    const double eps = options.stiffness_regularization_weight;
+    auto& system = impl.system(
+        {1., options.exterior_only ? 1. : 0., eps, 0.},
+        [&](auto& s) {
+            if (options.exterior_only) {
+                for (size_t n = 0; n < gd.numNodes(); n++) {
+                    if (!gd.isCovered(n)) {
+                        s.dofs.push_back(n);
+                    }
                 }
-            }
-        } else {
-            for (size_t e = 0; e < gd.numEdges(); e++) {
-                if (gd.isChartCrossing(e)) {
-                    std::pair<size_t, size_t> edge = gd.edge(e);
-                    dof_set.insert(edge.first);
-                    dof_set.insert(edge.second);
+            } else {
+                for (size_t e = 0; e < gd.numEdges(); e++) {
+                    if (gd.isChartCrossing(e)) {
+                        std::pair<size_t, size_t> edge = gd.edge(e);
+                        s.dofs.push_back(edge.first);
+                        s.dofs.push_back(edge.second);
+                    }
                 }
+                tbb::parallel_sort(s.dofs.begin(), s.dofs.end());
+                s.dofs.erase(std::unique(s.dofs.begin(), s.dofs.end()), s.dofs.end());
             }
-        }
-        if (dof_set.empty()) {
-            // Nothing to stitch
-            logger().warn("No seam to stitch.");
-            return;
-        }
-
-        std::vector<Eigen::Triplet<double>> triplets;
-        triplets.reserve(dof_set.size());
-        size_t idx = 0;
-        for (const auto dof : dof_set) {
-            triplets.emplace_back(
-                static_cast<typename Eigen::SparseMatrix<double>::StorageIndex>(dof),
-                static_cast<typename Eigen::SparseMatrix<double>::StorageIndex>(idx++),
-                1.0);
-        }
-
-        P.resize(gd.numNodes(), triplets.size());
-        P.setFromTriplets(triplets.begin(), triplets.end());
-        Pt = P.transpose();
+            if (s.dofs.empty()) return;
+
+            std::vector<Eigen::Triplet<double>> triplets;
+            triplets.reserve(s.dofs.size());
+            for (size_t idx = 0; idx < s.dofs.size(); idx++) {
+                triplets.emplace_back(
+                    static_cast<typename Eigen::SparseMatrix<double>::StorageIndex>(s.dofs[idx]),
+                    static_cast<typename Eigen::SparseMatrix<double>::StorageIndex>(idx),
+                    1.0);
+            }
+            s.P.resize(gd.numNodes(), s.dofs.size());
+            s.P.setFromTriplets(triplets.begin(), triplets.end());
+            s.S_reg = mesh_utils::laplacian_regularization(gd.stiffness(), eps);
+            s.M = s.P.transpose() * s.S_reg * s.P;
+        });
+    if (system.dofs.empty()) {
+        // Nothing to stitch
+        logger().warn("No seam to stitch.");
+        return;
     }
 
-    std::vector<Vector<double, NumChannels>> x(gd.numNodes());
-
     // Copy the texture values into the vector
-    for (size_t n = 0; n < gd.numNodes(); n++) {
-        std::pair<unsigned int, unsigned int> coords = gd.node(n);
-        x[n] = grid(coords.first, coords.second);
-    }
+    Eigen::MatrixXd x = gather_node_values(texture, impl.gd_texels, 0, num_channels);
 
     if (options.__randomize) {
         std::mt19937 gen;
         std::uniform_real_distribution<double> dist(0., 255.);
         // Sort dofs by (i,j) coords (GradientDomain node ordering is non-deterministic)
         std::vector<std::tuple<unsigned int, unsigned int, size_t>> dof_coords;
-        for (const auto dof : dof_set) {
+        for (const auto dof : system.dofs) {
             auto [i, j] = gd.node(dof);
             dof_coords.emplace_back(i, j, dof);
         }
         tbb::parallel_sort(dof_coords.begin(), dof_coords.end());
         for (const auto& [i, j, n] : dof_coords) {
-            for (unsigned int c = 0; c < NumChannels; c++) {
-                x[n][c] = dist(gen);
+            for (unsigned int c = 0; c < num_channels; c++) {
+                x(n, c) = dist(gen);
             }
         }
     }
 
-    // Compute the system matrix
-    const double eps = options.stiffness_regularization_weight;
-    const Eigen::SparseMatrix<double> S_reg =
-        mesh_utils::laplacian_regularization(gd.stiffness(), eps);
-    const Eigen::SparseMatrix<double> M = Pt * S_reg * P;
-
-    // Construct/factor the solver
-    Solver solver(M);
-    switch (solver.info()) {
-    case Eigen::Success: break;
-    case Eigen::NumericalIssue: la_debug_assert("Failed to factor matrix (numerical issue)"); break;
-    case Eigen::NoConvergence: la_debug_assert("Failed to factor matrix (no convergence)"); break;
-    case Eigen::InvalidInput: la_debug_assert("Failed to factor matrix (invalid input)"); break;
-    default: la_debug_assert("Failed to factor matrix");
-    }
-
-    // Solve the system per channel
+    // Solve the system for all channels
     // The constraints (rhs) are b = S_reg * x, reduced to b' = Pt * b
-    for (unsigned int c = 0; c < NumChannels; c++) {
-        Eigen::VectorXd _b(gd.numNodes());
-        for (size_t n = 0; n < gd.numNodes(); n++) {
-            _b[n] = x[n][c];
-        }
-        _b = Pt * (S_reg * _b);
-        Eigen::VectorXd _x = P * solver.solve(_b);
-        for (size_t n = 0; n < gd.numNodes(); n++) {
-            x[n][c] -= _x[n];
-        }
-    }
+    const Eigen::MatrixXd rhs = system.P.transpose() * (system.S_reg * x);
+    auto& solver = mesh_utils::factorize_system(system.M, options.solver_cache, system.solver);
+    x -= system.P * solver.solve(rhs);
 
     if (options.clamp_to_range.has_value()) {
-        mesh_utils::clamp_out_of_range<NumChannels>(x, gd, options.clamp_to_range.value());
+        mesh_utils::clamp_out_of_range(x, gd, options.clamp_to_range.value());
     }
 
     // Put the texel values back into the texture
-    for (size_t n = 0; n < gd.numNodes(); n++) {
-        std::pair<unsigned int, unsigned int> coords = gd.node(n);
-        grid(coords.first, coords.second) = x[n];
-    }
-
-    // Undo padding
-    padding.unpad(grid);
-
-    // Copy the texture grid data back into the texture
-    for (unsigned int j = 0; j < grid.res(1); j++) {
-        for (unsigned int i = 0; i < grid.res(0); i++) {
-            for (unsigned int c = 0; c < NumChannels; c++) {
-                texture(i, j, c) = grid(i, j)[c];
-            }
-        }
-    }
+    scatter_node_values(x, impl.gd_texels, 0, texture);
 }
 
-} // namespace
-
 template <typename Scalar, typename Index, typename ValueType>
 void texture_stitching(
     const SurfaceMesh<Scalar, Index>& mesh,
     image::experimental::View3D<ValueType> texture,
     const StitchingOptions& options)
 {
-    unsigned int num_channels = static_cast<unsigned int>(texture.extent(2));
-    switch (num_channels) {
-    case 1: texture_stitching<1>(mesh, texture, options); break;
-    case 2: texture_stitching<2>(mesh, texture, options); break;
-    case 3: texture_stitching<3>(mesh, texture, options); break;
-    case 4: texture_stitching<4>(mesh, texture, options); break;
-    default: la_debug_assert("Only 1, 2, 3, or 4 channels supported");
-    }
+    TextureSolverContextOptions context_options;
+    context_options.width = texture.extent(0);
+    context_options.height = texture.extent(1);
+    context_options.quadrature_samples = options.quadrature_samples;
+    context_options.jitter_epsilon = options.jitter_epsilon;
+    TextureSolverContext<Scalar, Index> context(mesh, context_options);
+    texture_stitching(context, texture, options);
 }
 
 // TODO: implement this weighted version.
@@ -231,6 +154,10 @@ void texture_stitching(
     template void texture_stitching(                     \
         const SurfaceMesh<Scalar, Index>& mesh,          \
         image::experimental::View3D<ValueType> texture,  \
+        const StitchingOptions& options);                \
+    template void texture_stitching(                     \
+        TextureSolverContext<Scalar, Index>& context,    \
+        image::experimental::View3D<ValueType> texture,  \
         const StitchingOptions& options);
 #define LA_X_texture_stitching_aux(_, ValueType) LA_SURFACE_MESH_X(texture_stitching, ValueType)
 LA_ATTRIBUTE_X(texture_stitching_aux, 0)
@@ -0,0 +1,514 @@
+/*
+ * Copyright 2025 Adobe. All rights reserved.
+ * This file is licensed to you under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License. You may obtain a copy
+ * of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR REPRESENTATIONS
+ * OF ANY KIND, either express or implied. See the License for the specific language
+ * governing permissions and limitations under the License.
+ */
+
+#include <lagrange/texproc/texture_tiling.h>
+
+#include <lagrange/Attribute.h>
+#include <lagrange/AttributeTypes.h>
+#include <lagrange/IndexedAttribute.h>
+#include <lagrange/SurfaceMeshTypes.h>
+#include <lagrange/find_matching_attributes.h>
+#include <lagrange/triangulate_polygonal_facets.h>
+#include <lagrange/utils/assert.h>
+#include <lagrange/views.h>
+
+#include <Eigen/Geometry>
+
+#include <tbb/parallel_for.h>
+#include <tbb/task_arena.h>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <map>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+namespace lagrange::texproc {
+
+namespace {
+
+// Rectangle of texels [x0, x1) x [y0, y1).
+struct TexelRect
+{
+    size_t x0 = 0;
+    size_t y0 = 0;
+    size_t x1 = 0;
+    size_t y1 = 0;
+
+    size_t width() const { return x1 - x0; }
+    size_t height() const { return y1 - y0; }
+};
+
+struct TextureTile
+{
+    // Texels written back to the output.
+    TexelRect interior;
+
+    // Texels covered by the tile, including the halo.
+    TexelRect halo;
+};
+
+std::vector<TextureTile> compute_tiles(size_t width, size_t height, const TilingOptions& options)
+{
+    la_runtime_assert(options.tile_size > 0, "Tile size must be positive");
+    std::vector<TextureTile> tiles;
+    for (size_t y = 0; y < height; y += options.tile_size) {
+        for (size_t x = 0; x < width; x += options.tile_size) {
+            TextureTile tile;
+            tile.interior.x0 = x;
+            tile.interior.y0 = y;
+            tile.interior.x1 = std::min(x + options.tile_size, width);
+            tile.interior.y1 = std::min(y + options.tile_size, height);
+            tile.halo.x0 = x > options.halo_size ? x - options.halo_size : 0;
+            tile.halo.y0 = y > options.halo_size ? y - options.halo_size : 0;
+            tile.halo.x1 = std::min(tile.interior.x1 + options.halo_size, width);
+            tile.halo.y1 = std::min(tile.interior.y1 + options.halo_size, height);
+            tiles.push_back(tile);
+        }
+    }
+    return tiles;
+}
+
+template <typename Scalar, typename Index>
+AttributeId get_uv_attribute_id(const SurfaceMesh<Scalar, Index>& mesh)
+{
+    auto res = find_matching_attribute(mesh, AttributeUsage::UV);
+    la_runtime_assert(res.has_value(), "Requires uv coordinates.");
+    return res.value();
+}
+
+// UV layout of a triangle mesh in texel space, where a UV (u, v) maps to the texel coordinates
+// (u * width, (1 - v) * height).
+template <typename Index>
+struct TexelLayout
+{
+    // Texel coordinates of the UV of each corner.
+    std::vector<Eigen::Vector2d> corner_texels;
+
+    // Index of the UV value of each corner (UVs sharing an index are welded).
+    std::vector<Index> corner_uvs;
+
+    // Bounding box of each facet in texel space.
+    std::vector<Eigen::AlignedBox<double, 2>> facet_boxes;
+};
+
+template <typename Scalar, typename Index>
+TexelLayout<Index>
+compute_texel_layout(const SurfaceMesh<Scalar, Index>& mesh, size_t width, size_t height)
+{
+    const AttributeId id = get_uv_attribute_id(mesh);
+    TexelLayout<Index> layout;
+    layout.corner_texels.resize(mesh.get_num_corners());
+    layout.corner_uvs.resize(mesh.get_num_corners());
+    layout.facet_boxes.resize(mesh.get_num_facets());
+
+    auto compute = [&](auto dummy) {
+        using UVScalar = decltype(dummy);
+        const bool is_indexed = mesh.is_attribute_indexed(id);
+        ConstRowMatrixView<UVScalar> uv_values =
+            is_indexed ? matrix_view(mesh.template get_indexed_attribute<UVScalar>(id).values())
+                       : matrix_view(mesh.template get_attribute<UVScalar>(id));
+        const AttributeElement element =
+            is_indexed ? AttributeElement::Indexed
+                       : mesh.template get_attribute<UVScalar>(id).get_element_type();
+        la_runtime_assert(
+            element != AttributeElement::Facet && element != AttributeElement::Value &&
+                element != AttributeElement::Edge,
+            "UV attribute must be per-vertex, per-corner or indexed.");
+        span<const Index> uv_indices;
+        if (is_indexed) {
+            uv_indices = mesh.template get_indexed_attribute<UVScalar>(id).indices().get_all();
+        }
+        auto uv_index = [&](Index c) -> Index {
+            switch (element) {
+            case AttributeElement::Indexed: return uv_indices[c];
+            case AttributeElement::Vertex: return mesh.get_corner_vertex(c);
+            default: return c;
+            }
+        };
+
+        tbb::parallel_for(Index(0), mesh.get_num_facets(), [&](Index f) {
+            for (Index c = mesh.get_facet_corner_begin(f); c < mesh.get_facet_corner_end(f); ++c) {
+                const Index uv = uv_index(c);
+                layout.corner_uvs[c] = uv;
+                layout.corner_texels[c] = Eigen::Vector2d(
+                    static_cast<double>(uv_values(uv, 0)) * static_cast<double>(width),
+                    (1. - static_cast<double>(uv_values(uv, 1))) * static_cast<double>(height));
+                layout.facet_boxes[f].extend(layout.corner_texels[c]);
+            }
+        });
+    };
+    if (mesh.template is_attribute_type<float>(id)) {
+        compute(float());
+    } else if (mesh.template is_attribute_type<double>(id)) {
+        compute(double());
+    } else {
+        la_runtime_assert(false, "UV coordinates must be floating point values.");
+    }
+    return layout;
+}
+
+// Vertex of a triangle clipped by a tile. Besides its texel coordinates and its barycentric
+// coordinates in the triangle, it records whether it is a corner of the triangle, or lies on an
+// edge of the triangle (edge k joins corners k and k + 1), and which side of the tile created it.
+struct ClipVertex
+{
+    Eigen::Vector2d texel;
+    Eigen::Vector3d bary;
+    int corner = -1;
+    int edge = -1;
+    int side = -1;
+
+    bool is_on_edge(int e) const { return edge == e || corner == e || corner == (e + 1) % 3; }
+};
+
+// Identifies a vertex of the tile mesh: a vertex of the input mesh, the intersection of an edge of
+// the input mesh with a side of the tile (both triangles sharing the edge produce the same key),
+// or a vertex inside a triangle.
+using ClipKey = std::array<uint64_t, 6>;
+
+// Extracts the part of the mesh covered by a tile and its halo. Triangles crossing the boundary
+// of the tile are clipped by it, so that the support of the tile mesh never exceeds the texels of
+// the tile. The UVs of the tile mesh are mapped to the texel rectangle covered by the tile. Only
+// positions and UVs are kept. Returns nothing if no facet overlaps the tile.
+template <typename Scalar, typename Index>
+std::optional<SurfaceMesh<Scalar, Index>> extract_tile_mesh(
+    const SurfaceMesh<Scalar, Index>& mesh,
+    const TexelLayout<Index>& layout,
+    const TexelRect& rect)
+{
+    const std::array<double, 2> rect_min = {
+        static_cast<double>(rect.x0),
+        static_cast<double>(rect.y0)};
+    const std::array<double, 2> rect_max = {
+        static_cast<double>(rect.x1),
+        static_cast<double>(rect.y1)};
+    const Eigen::AlignedBox<double, 2> rect_box(
+        Eigen::Vector2d(rect_min[0], rect_min[1]),
+        Eigen::Vector2d(rect_max[0], rect_max[1]));
+
+    std::vector<Scalar> positions;
+    std::vector<Scalar> uv_values;
+    std::vector<Index> triangles;
+    std::vector<Index> uv_indices;
+    std::map<ClipKey, Index> vertex_ids;
+    std::map<ClipKey, Index> uv_ids;
+    auto V = vertex_view(mesh);
+
+    // Adds a clipped vertex to the tile mesh, and returns its vertex and UV indices.
+    auto add_vertex = [&](Index f, const ClipVertex& p) {
+        const Index c0 = mesh.get_facet_corner_begin(f);
+        ClipKey vertex_key, uv_key;
+        if (p.corner >= 0) {
+            const Index c = c0 + static_cast<Index>(p.corner);
+            vertex_key = {0, mesh.get_corner_vertex(c), 0, 0, 0, 0};
+            uv_key = {0, layout.corner_uvs[c], 0, 0, 0, 0};
+        } else if (p.edge >= 0) {
+            const Index ca = c0 + static_cast<Index>(p.edge);
+            const Index cb = c0 + static_cast<Index>((p.edge + 1) % 3);
+            auto lo = std::make_pair(layout.corner_uvs[ca], mesh.get_corner_vertex(ca));
+            auto hi = std::make_pair(layout.corner_uvs[cb], mesh.get_corner_vertex(cb));
+            if (hi < lo) std::swap(lo, hi);
+            vertex_key = {
+                1,
+                lo.second,
+                hi.second,
+                lo.first,
+                hi.first,
+                static_cast<uint64_t>(p.side)};
+            uv_key = vertex_key;
+        } else {
+            // Interior vertices are not shared between triangles.
+            vertex_key = {2, positions.size(), 0, 0, 0, 0};
+            uv_key = {2, uv_values.size(), 0, 0, 0, 0};
+        }
+
+        auto [vertex_it, new_vertex] =
+            vertex_ids.emplace(vertex_key, static_cast<Index>(positions.size() / 3));
+        if (new_vertex) {
+            Eigen::Vector3d position = Eigen::Vector3d::Zero();
+            for (int k = 0; k < 3; ++k) {
+                const Index v = mesh.get_corner_vertex(c0 + static_cast<Index>(k));
+                position += p.bary[k] * V.row(v).transpose().template cast<double>();
+            }
+            for (int d = 0; d < 3; ++d) positions.push_back(static_cast<Scalar>(position[d]));
+        }
+        auto [uv_it, new_uv] =
+            uv_ids.emplace(uv_key, static_cast<Index>(uv_values.size() / 2));
+        if (new_uv) {
+            uv_values.push_back(static_cast<Scalar>((p.texel.x() - rect_min[0]) / rect.width()));
+            uv_values.push_back(
+                static_cast<Scalar>(1. - (p.texel.y() - rect_min[1]) / rect.height()));
+        }
+        return std::make_pair(vertex_it->second, uv_it->second);
+    };
+
+    std::vector<ClipVertex> polygon, clipped;
+    for (Index f = 0; f < mesh.get_num_facets(); ++f) {
+        if (!layout.facet_boxes[f].intersects(rect_box)) continue;
+        const Index c0 = mesh.get_facet_corner_begin(f);
+        auto make_corner = [&](int k) {
+            ClipVertex p;
+            p.texel = layout.corner_texels[c0 + static_cast<Index>(k)];
+            p.bary = Eigen::Vector3d::Unit(k);
+            p.corner = k;
+            return p;
+        };
+        // Corners of an edge, ordered by UV and vertex index.
+        auto edge_corners = [&](int e) {
+            const int ka = e;
+            const int kb = (e + 1) % 3;
+            const Index ca = c0 + static_cast<Index>(ka);
+            const Index cb = c0 + static_cast<Index>(kb);
+            const bool swap =
+                std::make_pair(layout.corner_uvs[cb], mesh.get_corner_vertex(cb)) <
+                std::make_pair(layout.corner_uvs[ca], mesh.get_corner_vertex(ca));
+            return swap ? std::make_pair(kb, ka) : std::make_pair(ka, kb);
+        };
+
+        polygon.clear();
+        for (int k = 0; k < 3; ++k) polygon.push_back(make_corner(k));
+
+        // Sutherland-Hodgman clipping by the four sides of the tile.
+        for (int side = 0; side < 4 && polygon.size() >= 3; ++side) {
+            const int axis = side % 2;
+            const bool keep_above = side < 2;
+            const double coord = keep_above ? rect_min[axis] : rect_max[axis];
+            auto inside = [&](const ClipVertex& p) {
+                return keep_above ? p.texel[axis] >= coord : p.texel[axis] <= coord;
+            };
+            // Intersection of a segment crossing the side. Points on a triangle edge are computed
+            // from the edge endpoints in a fixed order, so that adjacent triangles agree.
+            auto intersect = [&](const ClipVertex& p, const ClipVertex& q) {
+                ClipVertex r;
+                r.side = side;
+                for (int e = 0; e < 3; ++e) {
+                    if (p.is_on_edge(e) && q.is_on_edge(e)) r.edge = e;
+                }
+                ClipVertex lo = p, hi = q;
+                if (r.edge >= 0) {
+                    const auto [ka, kb] = edge_corners(r.edge);
+                    lo = make_corner(ka);
+                    hi = make_corner(kb);
+                }
+                const double t = (coord - lo.texel[axis]) / (hi.texel[axis] - lo.texel[axis]);
+                r.texel = (1. - t) * lo.texel + t * hi.texel;
+                r.texel[axis] = coord;
+                r.bary = (1. - t) * lo.bary + t * hi.bary;
+                return r;
+            };
+
+            clipped.clear();
+            for (size_t i = 0; i < polygon.size(); ++i) {
+                const ClipVertex& p = polygon[i];
+                const ClipVertex& q = polygon[(i + 1) % polygon.size()];
+                const bool p_inside = inside(p);
+                const bool q_inside = inside(q);
+                if (p_inside) clipped.push_back(p);
+                if (p_inside && !q_inside && p.texel[axis] != coord) {
+                    clipped.push_back(intersect(p, q));
+                } else if (!p_inside && q_inside && q.texel[axis] != coord) {
+                    clipped.push_back(intersect(p, q));
+                }
+            }
+            std::swap(polygon, clipped);
+        }
+        if (polygon.size() < 3) continue;
+
+        // Triangulate the (convex) clipped polygon as a fan.
+        std::vector<std::pair<Index, Index>> ids;
+        ids.reserve(polygon.size());
+        for (const auto& p : polygon) ids.push_back(add_vertex(f, p));
+        for (size_t i = 1; i + 1 < polygon.size(); ++i) {
+            const Eigen::Vector2d e1 = polygon[i].texel - polygon[0].texel;
+            const Eigen::Vector2d e2 = polygon[i + 1].texel - polygon[0].texel;
+            if (e1.x() * e2.y() - e1.y() * e2.x() == 0) continue;
+            for (size_t k : {size_t(0), i, i + 1}) {
+                triangles.push_back(ids[k].first);
+                uv_indices.push_back(ids[k].second);
+            }
+        }
+    }
+    if (triangles.empty()) return std::nullopt;
+
+    SurfaceMesh<Scalar, Index> tile_mesh;
+    tile_mesh.add_vertices(
+        static_cast<Index>(positions.size() / 3),
+        span<const Scalar>(positions.data(), positions.size()));
+    tile_mesh.add_triangles(
+        static_cast<Index>(triangles.size() / 3),
+        span<const Index>(triangles.data(), triangles.size()));
+    tile_mesh.template create_attribute<Scalar>(
+        "uv",
+        AttributeElement::Indexed,
+        AttributeUsage::UV,
+        2,
+        span<const Scalar>(uv_values.data(), uv_values.size()),
+        span<const Index>(uv_indices.data(), uv_indices.size()));
+    return tile_mesh;
+}
+
+template <typename ValueType>
+image::experimental::Array3D<std::remove_const_t<ValueType>> crop_texture(
+    image::experimental::View3D<ValueType> texture,
+    const TexelRect& rect)
+{
+    auto crop = image::experimental::create_image<std::remove_const_t<ValueType>>(
+        rect.width(),
+        rect.height(),
+        texture.extent(2));
+    for (size_t j = 0; j < rect.height(); ++j) {
+        for (size_t i = 0; i < rect.width(); ++i) {
+            for (size_t c = 0; c < texture.extent(2); ++c) {
+                crop(i, j, c) = texture(rect.x0 + i, rect.y0 + j, c);
+            }
+        }
+    }
+    return crop;
+}
+
+// Copies the interior of a tile from its crop back into the full texture.
+template <typename ValueType>
+void copy_interior(
+    const image::experimental::Array3D<ValueType>& crop,
+    const TexelRect& rect,
+    const TextureTile& tile,
+    image::experimental::View3D<ValueType> texture)
+{
+    for (size_t j = tile.interior.y0; j < tile.interior.y1; ++j) {
+        for (size_t i = tile.interior.x0; i < tile.interior.x1; ++i) {
+            for (size_t c = 0; c < texture.extent(2); ++c) {
+                texture(i, j, c) = crop(i - rect.x0, j - rect.y0, c);
+            }
+        }
+    }
+}
+
+// Processes the tiles covering a texture. Tiles are processed in batches of at most
+// `max_tiles_in_flight` tiles, each of them parallelizing internally. Since tile interiors are
+// disjoint, tiles can write their results concurrently.
+template <typename Scalar, typename Index, typename Function>
+void for_each_tile(
+    const SurfaceMesh<Scalar, Index>& input_mesh,
+    size_t width,
+    size_t height,
+    const TilingOptions& options,
+    Function&& process_tile)
+{
+    std::optional<SurfaceMesh<Scalar, Index>> triangulated;
+    if (!input_mesh.is_triangle_mesh()) {
+        triangulated = input_mesh;
+        triangulate_polygonal_facets(triangulated.value());
+    }
+    const auto& mesh = triangulated.has_value() ? triangulated.value() : input_mesh;
+
+    const auto layout = compute_texel_layout(mesh, width, height);
+    const auto tiles = compute_tiles(width, height, options);
+    const size_t batch_size = options.max_tiles_in_flight > 0
+                                  ? options.max_tiles_in_flight
+                                  : size_t(tbb::this_task_arena::max_concurrency());
+    for (size_t first = 0; first < tiles.size(); first += batch_size) {
+        const size_t last = std::min(first + batch_size, tiles.size());
+        tbb::parallel_for(first, last, [&](size_t t) {
+            const TexelRect& rect = tiles[t].halo;
+            auto tile_mesh = extract_tile_mesh(mesh, layout, rect);
+            if (tile_mesh.has_value()) {
+                process_tile(tile_mesh.value(), tiles[t], rect);
+            }
+        });
+    }
+}
+
+} // namespace
+
+template <typename Scalar, typename Index, typename ValueType>
+void texture_filtering_tiled(
+    const SurfaceMesh<Scalar, Index>& mesh,
+    image::experimental::View3D<ValueType> texture,
+    const FilteringOptions& options,
+    const TilingOptions& tiling_options)
+{
+    // Tile systems have distinct sparsity patterns, so a cached factorization cannot be reused
+    // across tiles. Cached solvers are not thread-safe either when tiles run concurrently.
+    FilteringOptions tile_options = options;
+    tile_options.solver_cache = nullptr;
+
+    for_each_tile(
+        mesh,
+        texture.extent(0),
+        texture.extent(1),
+        tiling_options,
+        [&](const SurfaceMesh<Scalar, Index>& tile_mesh,
+            const TextureTile& tile,
+            const TexelRect& rect) {
+            auto crop = crop_texture(texture, rect);
+            texture_filtering(tile_mesh, crop.to_mdspan(), tile_options);
+            copy_interior(crop, rect, tile, texture);
+        });
+}
+
+template <typename Scalar, typename Index, typename ValueType>
+image::experimental::Array3D<ValueType> texture_compositing_tiled(
+    const SurfaceMesh<Scalar, Index>& mesh,
+    std::vector<ConstWeightedTextureView<ValueType>> textures,
+    const CompositingOptions& options,
+    const TilingOptions& tiling_options)
+{
+    la_runtime_assert(!textures.empty(), "No textures to composite");
+    const size_t width = textures[0].texture.extent(0);
+    const size_t height = textures[0].texture.extent(1);
+    auto composite =
+        image::experimental::create_image<ValueType>(width, height, textures[0].texture.extent(2));
+
+    for_each_tile(
+        mesh,
+        width,
+        height,
+        tiling_options,
+        [&](const SurfaceMesh<Scalar, Index>& tile_mesh,
+            const TextureTile& tile,
+            const TexelRect& rect) {
+            std::vector<image::experimental::Array3D<ValueType>> tile_textures;
+            std::vector<image::experimental::Array3D<float>> tile_weights;
+            std::vector<ConstWeightedTextureView<ValueType>> views;
+            tile_textures.reserve(textures.size());
+            tile_weights.reserve(textures.size());
+            for (const auto& texture : textures) {
+                tile_textures.push_back(crop_texture(texture.texture, rect));
+                tile_weights.push_back(crop_texture(texture.weights, rect));
+                views.push_back(
+                    {tile_textures.back().to_mdspan(), tile_weights.back().to_mdspan()});
+            }
+            auto tile_composite = texture_compositing(tile_mesh, views, options);
+            copy_interior(tile_composite, rect, tile, composite.to_mdspan());
+        });
+
+    return composite;
+}
+
+#define LA_X_texture_tiling(ValueType, Scalar, Index)                             \
+    template void texture_filtering_tiled(                                        \
+        const SurfaceMesh<Scalar, Index>& mesh,                                   \
+        image::experimental::View3D<ValueType> texture,                           \
+        const FilteringOptions& options,                                          \
+        const TilingOptions& tiling_options);                                     \
+    template image::experimental::Array3D<ValueType> texture_compositing_tiled(   \
+        const SurfaceMesh<Scalar, Index>& mesh,                                   \
+        std::vector<ConstWeightedTextureView<ValueType>> textures,                \
+        const CompositingOptions& options,                                        \
+        const TilingOptions& tiling_options);
+#define LA_X_texture_tiling_aux(_, ValueType) LA_SURFACE_MESH_X(texture_tiling, ValueType)
+LA_ATTRIBUTE_X(texture_tiling_aux, 0)
+
+} // namespace lagrange::texproc
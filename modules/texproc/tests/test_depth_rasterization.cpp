@@ -0,0 +1,163 @@
+/*
+ * Copyright 2025 Adobe. All rights reserved.
+ * This file is licensed to you under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License. You may obtain a copy
+ * of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR REPRESENTATIONS
+ * OF ANY KIND, either express or implied. See the License for the specific language
+ * governing permissions and limitations under the License.
+ */
+////////////////////////////////////////////////////////////////////////////////
+#include "../src/depth_utils.h"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <cmath>
+#include <limits>
+////////////////////////////////////////////////////////////////////////////////
+
+namespace lagrange::texproc {
+namespace {
+
+// Reference depth rasterization, as computed before tiling: triangles are rasterized one after
+// the other over the whole screen.
+RegularGrid<2, double> compute_depth_serial(
+    const depth_utils::Mesh& mesh,
+    const depth_utils::CameraParameters& camera_parameters)
+{
+    RegularGrid<2, double> depth(camera_parameters.res);
+    for (size_t i = 0; i < depth.size(); i++) {
+        depth[i] = std::numeric_limits<double>::infinity();
+    }
+
+    typename RegularGrid<2>::Range range;
+    for (unsigned int d = 0; d < 2; d++) {
+        range.second[d] = camera_parameters.res[d];
+    }
+
+    Eigen::Projective3d view_from_ndc = camera_parameters.ndc_from_view.inverse();
+    Eigen::Affine2d ndc_from_screen = camera_parameters.screen_from_ndc.inverse();
+
+    for (size_t t = 0; t < mesh.triangles.size(); t++) {
+        Simplex<double, 2, 2> t_tri;
+        Simplex<double, 3, 2> c_tri;
+        for (unsigned int k = 0; k < 3; k++) {
+            t_tri[k] = camera_parameters(mesh.vertices[mesh.triangles[t][k]]);
+            c_tri[k] = camera_parameters.world_to_view(mesh.vertices[mesh.triangles[t][k]]);
+        }
+
+        auto kernel = [&](typename RegularGrid<2>::Index I) {
+            if (!range.contains(I)) return;
+            double d = depth_utils::node_depth(c_tri, I, view_from_ndc, ndc_from_screen);
+            if (d > 0 && d < depth(I)) {
+                depth(I) = d;
+            }
+        };
+        constexpr bool NodeAtCellCenter = false;
+        Rasterizer2D::template RasterizeNodes<NodeAtCellCenter>(t_tri, kernel, range);
+    }
+
+    return depth;
+}
+
+} // namespace
+} // namespace lagrange::texproc
+
+namespace {
+
+// A wavy height field over [-2, 2]^2, larger than the field of view, with a smaller square
+// hovering above its center to create occlusions.
+lagrange::texproc::depth_utils::Mesh make_height_field(unsigned int n)
+{
+    lagrange::texproc::depth_utils::Mesh mesh;
+    auto add_grid = [&](unsigned int res, double extent, auto&& height) {
+        const unsigned int offset = static_cast<unsigned int>(mesh.vertices.size());
+        for (unsigned int j = 0; j <= res; j++) {
+            for (unsigned int i = 0; i <= res; i++) {
+                const double x = extent * (2. * i / res - 1.);
+                const double y = extent * (2. * j / res - 1.);
+                mesh.vertices.emplace_back(x, y, height(x, y));
+            }
+        }
+        auto vid = [&](unsigned int i, unsigned int j) { return offset + j * (res + 1) + i; };
+        for (unsigned int j = 0; j < res; j++) {
+            for (unsigned int i = 0; i < res; i++) {
+                lagrange::texproc::SimplexIndex<2> t0, t1;
+                t0[0] = vid(i, j), t0[1] = vid(i + 1, j), t0[2] = vid(i + 1, j + 1);
+                t1[0] = vid(i, j), t1[1] = vid(i + 1, j + 1), t1[2] = vid(i, j + 1);
+                mesh.triangles.push_back(t0);
+                mesh.triangles.push_back(t1);
+            }
+        }
+    };
+    add_grid(n, 2., [](double x, double y) { return 0.2 * std::sin(3 * x) * std::cos(2 * y); });
+    add_grid(4, 0.3, [](double x, double) { return 0.5 + 0.1 * x; });
+    return mesh;
+}
+
+lagrange::texproc::depth_utils::CameraParameters
+make_camera(const Eigen::Vector3d& eye, unsigned int width, unsigned int height)
+{
+    // Look at the origin, with +Y up
+    const Eigen::Vector3d up(0, 1, 0);
+    const Eigen::Vector3d f = (-eye).normalized();
+    const Eigen::Vector3d s = f.cross(up).normalized();
+    const Eigen::Vector3d u = s.cross(f);
+    Eigen::Matrix3d R;
+    R.row(0) = s;
+    R.row(1) = u;
+    R.row(2) = -f;
+    Eigen::Affine3d view_from_world = Eigen::Affine3d::Identity();
+    view_from_world.linear() = R;
+    view_from_world.translation() = -R * eye;
+
+    // OpenGL perspective projection
+    const double fovy = 0.8;
+    const double aspect = static_cast<double>(width) / height;
+    const double z_near = 0.1;
+    const double z_far = 20.;
+    const double cot = 1. / std::tan(fovy / 2);
+    Eigen::Matrix4d P = Eigen::Matrix4d::Zero();
+    P(0, 0) = cot / aspect;
+    P(1, 1) = cot;
+    P(2, 2) = (z_far + z_near) / (z_near - z_far);
+    P(2, 3) = 2 * z_far * z_near / (z_near - z_far);
+    P(3, 2) = -1;
+
+    return lagrange::texproc::depth_utils::CameraParameters(
+        view_from_world,
+        Eigen::Projective3d(P),
+        width,
+        height);
+}
+
+} // namespace
+
+TEST_CASE("Tiled depth rasterization", "[texproc]")
+{
+    namespace depth_utils = lagrange::texproc::depth_utils;
+
+    const lagrange::texproc::depth_utils::Mesh mesh = make_height_field(40);
+
+    // Resolutions are not multiples of the tile size, so the last row/column of tiles is partial
+    const unsigned int width = 203;
+    const unsigned int height = 141;
+    for (const Eigen::Vector3d eye :
+         {Eigen::Vector3d(0, 0, 4), Eigen::Vector3d(1, -2, 2.5), Eigen::Vector3d(-3, 0.5, 1)}) {
+        const auto camera = make_camera(eye, width, height);
+        const auto expected = lagrange::texproc::compute_depth_serial(mesh, camera);
+        const auto depth = depth_utils::compute_depth(mesh, camera);
+
+        REQUIRE(depth.res(0) == expected.res(0));
+        REQUIRE(depth.res(1) == expected.res(1));
+        size_t num_covered = 0;
+        for (size_t i = 0; i < depth.size(); i++) {
+            REQUIRE(
+                (depth[i] == expected[i] || (std::isinf(depth[i]) && std::isinf(expected[i]))));
+            if (std::isfinite(depth[i])) num_covered++;
+        }
+        REQUIRE(num_covered > 0);
+    }
+}
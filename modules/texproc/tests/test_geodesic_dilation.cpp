@@ -34,6 +34,7 @@
 #include <lagrange/utils/warnon.h>
 // clang-format on
 
+#include <catch2/benchmark/catch_benchmark.hpp>
 #include <catch2/catch_test_macros.hpp>
 #include <catch2/matchers/catch_matchers_floating_point.hpp>
 
@@ -520,3 +521,28 @@ TEST_CASE("texture dilation regression", "[texproc]")
         }
     }
 }
+
+TEST_CASE("texture dilation benchmark", "[texproc][!benchmark]")
+{
+    using lagrange::testing::load_surface_mesh;
+
+    auto mesh = load_surface_mesh<Scalar, Index>("open/core/blub/blub.obj");
+
+    lagrange::texproc::DilationOptions dilation_options;
+    dilation_options.dilation_radius = 32;
+
+    for (size_t size : {1024, 2048, 4096}) {
+        auto image = lagrange::image::experimental::create_image<float>(size, size, 3);
+        for (size_t i = 0; i < image.extent(0); ++i) {
+            for (size_t j = 0; j < image.extent(1); ++j) {
+                for (size_t c = 0; c < 3; ++c) {
+                    image(i, j, c) = static_cast<float>((i + j + c) % 256) / 255.f;
+                }
+            }
+        }
+        BENCHMARK(fmt::format("texture dilation {}x{}", size, size))
+        {
+            lagrange::texproc::geodesic_dilation(mesh, image.to_mdspan(), dilation_options);
+        };
+    }
+}
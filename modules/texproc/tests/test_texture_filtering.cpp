@@ -15,6 +15,8 @@
 #include "platform_subfolder.h"
 
 #include <lagrange/find_matching_attributes.h>
+#include <lagrange/solver/SolverCache.h>
+#include <lagrange/texproc/TextureSolverContext.h>
 #include <lagrange/texproc/texture_filtering.h>
 #include <lagrange/utils/build.h>
 
@@ -88,4 +90,78 @@ TEST_CASE("texture filtering", "[texproc][filtering]" LA_SLOW_DEBUG_FLAG)
                 fmt::format("open/texproc/{}/blub_sharp.exr", subfolder)));
         require_approx_mdspan(img.to_mdspan(), expected.to_mdspan());
     }
+
+    SECTION("solver cache")
+    {
+        lagrange::solver::SolverCache cache;
+        options.solver_cache = &cache;
+        auto subfolder = get_platform_subfolder();
+        tbb::task_arena arena(1);
+
+        // Smoothing and sharpening share the same system pattern, only the weights differ.
+        options.gradient_scale = 0;
+        arena.execute(
+            [&] { lagrange::texproc::texture_filtering(mesh, img.to_mdspan(), options); });
+        auto expected_smooth = load_image(
+            lagrange::testing::get_data_path(
+                fmt::format("open/texproc/{}/blub_smooth.exr", subfolder)));
+        require_approx_mdspan(img.to_mdspan(), expected_smooth.to_mdspan());
+
+        auto img2 =
+            load_image(lagrange::testing::get_data_path("open/texproc/blub_diffuse_64x64.png"));
+        options.gradient_scale = 5.;
+        arena.execute(
+            [&] { lagrange::texproc::texture_filtering(mesh, img2.to_mdspan(), options); });
+        auto expected_sharp = load_image(
+            lagrange::testing::get_data_path(
+                fmt::format("open/texproc/{}/blub_sharp.exr", subfolder)));
+        require_approx_mdspan(img2.to_mdspan(), expected_sharp.to_mdspan());
+        REQUIRE(cache.size() == 1);
+    }
+
+    SECTION("solver context")
+    {
+        lagrange::texproc::TextureSolverContextOptions context_options;
+        context_options.width = img.extent(0);
+        context_options.height = img.extent(1);
+        lagrange::texproc::TextureSolverContext<Scalar, Index> context(mesh, context_options);
+        auto subfolder = get_platform_subfolder();
+        tbb::task_arena arena(1);
+
+        // Both filters reuse the operators and factorization cached by the context.
+        options.gradient_scale = 0;
+        arena.execute(
+            [&] { lagrange::texproc::texture_filtering(context, img.to_mdspan(), options); });
+        auto expected_smooth = load_image(
+            lagrange::testing::get_data_path(
+                fmt::format("open/texproc/{}/blub_smooth.exr", subfolder)));
+        require_approx_mdspan(img.to_mdspan(), expected_smooth.to_mdspan());
+
+        auto img2 =
+            load_image(lagrange::testing::get_data_path("open/texproc/blub_diffuse_64x64.png"));
+        options.gradient_scale = 5.;
+        arena.execute(
+            [&] { lagrange::texproc::texture_filtering(context, img2.to_mdspan(), options); });
+        auto expected_sharp = load_image(
+            lagrange::testing::get_data_path(
+                fmt::format("open/texproc/{}/blub_sharp.exr", subfolder)));
+        require_approx_mdspan(img2.to_mdspan(), expected_sharp.to_mdspan());
+
+        // Cycling through more parameter sets than the context caches evicts older systems,
+        // which are rebuilt on demand.
+        for (double value_weight : {1e1, 1e2, 1e4, 1e5, 1e6, 1e3}) {
+            auto img4 =
+                load_image(lagrange::testing::get_data_path("open/texproc/blub_diffuse_64x64.png"));
+            options.value_weight = value_weight;
+            arena.execute(
+                [&] { lagrange::texproc::texture_filtering(context, img4.to_mdspan(), options); });
+            if (value_weight == 1e3) {
+                require_approx_mdspan(img4.to_mdspan(), expected_sharp.to_mdspan());
+            }
+        }
+
+        auto img3 = lagrange::image::experimental::create_image<float>(img.extent(0) + 1, 1, 1);
+        LA_REQUIRE_THROWS(
+            lagrange::texproc::texture_filtering(context, img3.to_mdspan(), options));
+    }
 }
@@ -158,6 +158,60 @@ TEST_CASE("Pumpkin pipeline", "[texproc]" LA_SLOW_DEBUG_FLAG LA_CORP_FLAG)
 #endif
 }
 
+TEST_CASE("Multi-view rasterization", "[texproc]" LA_SLOW_DEBUG_FLAG LA_CORP_FLAG)
+{
+    auto scene_options = lagrange::io::LoadOptions();
+    scene_options.stitch_vertices = true;
+    const auto scene = lagrange::io::load_scene<lagrange::scene::Scene32f>(
+        lagrange::testing::get_data_path("corp/texproc/prepared/pumpkin.glb"),
+        scene_options);
+
+    const auto& [mesh, _] = lagrange::scene::internal::single_mesh_from_scene(scene);
+    const auto cameras = lagrange::texproc::cameras_from_scene(scene);
+    REQUIRE(cameras.size() == 16);
+
+    std::vector<Array3Df> views;
+    std::vector<lagrange::image::experimental::View3D<const float>> view_refs;
+    for (const auto kk : lagrange::range(cameras.size())) {
+        views.emplace_back(load_image(
+            lagrange::testing::get_data_path(
+                fmt::format("corp/texproc/prepared/view_{:02d}.png", kk))));
+    }
+    for (const auto& view : views) view_refs.emplace_back(view.to_mdspan());
+
+    const size_t width = 256;
+    const size_t height = 256;
+    const auto expected = test_rasterization(mesh, cameras, views, width, height);
+
+    auto rasterizer_options = lagrange::texproc::TextureRasterizerOptions();
+    rasterizer_options.width = width;
+    rasterizer_options.height = height;
+    const auto rasterizer = lagrange::texproc::TextureRasterizer(mesh, rasterizer_options);
+
+    for (size_t max_views_in_flight : {0, 1, 3}) {
+        size_t next_view = 0;
+        rasterizer.weighted_textures_from_renders(
+            view_refs,
+            cameras,
+            [&](size_t i, Array3Df texture, Array3Df weight) {
+                REQUIRE(i == next_view++);
+                const auto& [expected_texture, expected_weight] = expected[i];
+                REQUIRE(texture.extent(0) == width);
+                REQUIRE(texture.extent(1) == height);
+                for (size_t x = 0; x < width; ++x) {
+                    for (size_t y = 0; y < height; ++y) {
+                        for (size_t c = 0; c < texture.extent(2); ++c) {
+                            REQUIRE(texture(x, y, c) == expected_texture(x, y, c));
+                        }
+                        REQUIRE(weight(x, y, 0) == expected_weight(x, y, 0));
+                    }
+                }
+            },
+            max_views_in_flight);
+        REQUIRE(next_view == cameras.size());
+    }
+}
+
 TEST_CASE("Check benchmark", "[texproc][!benchmark]" LA_CORP_FLAG)
 {
     auto scene_options = lagrange::io::LoadOptions();
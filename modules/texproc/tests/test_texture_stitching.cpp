@@ -16,6 +16,7 @@
 
 #include <lagrange/find_matching_attributes.h>
 #include <lagrange/map_attribute.h>
+#include <lagrange/texproc/TextureSolverContext.h>
 #include <lagrange/texproc/texture_stitching.h>
 #include <lagrange/utils/build.h>
 #include <lagrange/views.h>
@@ -124,6 +125,50 @@ TEST_CASE("texture stitching", "[texproc][stitching]" LA_SLOW_DEBUG_FLAG)
                 fmt::format("open/texproc/{}/blub_stitched_rnd.exr", subfolder)));
         require_approx_mdspan(img.to_mdspan(), expected.to_mdspan());
     }
+
+    SECTION("solver context")
+    {
+        lagrange::texproc::TextureSolverContextOptions context_options;
+        context_options.width = img.extent(0);
+        context_options.height = img.extent(1);
+        lagrange::texproc::TextureSolverContext<Scalar, Index> context(mesh, context_options);
+        auto subfolder = get_platform_subfolder();
+        auto expected = load_image(
+            lagrange::testing::get_data_path(
+                fmt::format("open/texproc/{}/blub_stitched.exr", subfolder)));
+
+        // Stack two copies of the texture to exercise more channels than a single solve group.
+        const size_t num_channels = img.extent(2);
+        auto stacked = lagrange::image::experimental::create_image<float>(
+            img.extent(0),
+            img.extent(1),
+            2 * num_channels);
+        for (size_t x = 0; x < img.extent(0); ++x) {
+            for (size_t y = 0; y < img.extent(1); ++y) {
+                for (size_t c = 0; c < num_channels; ++c) {
+                    stacked(x, y, c) = img(x, y, c);
+                    stacked(x, y, num_channels + c) = img(x, y, c);
+                }
+            }
+        }
+
+        tbb::task_arena arena(1);
+        arena.execute(
+            [&] { lagrange::texproc::texture_stitching(context, img.to_mdspan(), options); });
+        require_approx_mdspan(img.to_mdspan(), expected.to_mdspan());
+
+        // The second call reuses the factorization cached by the context.
+        arena.execute(
+            [&] { lagrange::texproc::texture_stitching(context, stacked.to_mdspan(), options); });
+        auto stacked_view = stacked.to_mdspan();
+        auto all = lagrange::image::experimental::full_extent_t();
+        require_approx_mdspan(
+            submdspan(stacked_view, all, all, std::tuple{size_t(0), num_channels}),
+            expected.to_mdspan());
+        require_approx_mdspan(
+            submdspan(stacked_view, all, all, std::tuple{num_channels, 2 * num_channels}),
+            expected.to_mdspan());
+    }
 }
 
 TEST_CASE("Penguin with flips", "[texproc][stitching]" LA_SLOW_DEBUG_FLAG LA_CORP_FLAG)
@@ -0,0 +1,147 @@
+/*
+ * Copyright 2025 Adobe. All rights reserved.
+ * This file is licensed to you under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License. You may obtain a copy
+ * of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR REPRESENTATIONS
+ * OF ANY KIND, either express or implied. See the License for the specific language
+ * governing permissions and limitations under the License.
+ */
+#include "../examples/io_helpers.h"
+
+#include <lagrange/texproc/texture_tiling.h>
+#include <lagrange/utils/build.h>
+
+#include <lagrange/testing/common.h>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <algorithm>
+#include <cmath>
+
+namespace {
+
+double mean_abs_difference(ConstView3Df a, ConstView3Df b)
+{
+    REQUIRE(a.extent(0) == b.extent(0));
+    REQUIRE(a.extent(1) == b.extent(1));
+    REQUIRE(a.extent(2) == b.extent(2));
+    double sum = 0;
+    for (size_t x = 0; x < a.extent(0); ++x) {
+        for (size_t y = 0; y < a.extent(1); ++y) {
+            for (size_t c = 0; c < a.extent(2); ++c) {
+                sum += std::abs(double(a(x, y, c)) - double(b(x, y, c)));
+            }
+        }
+    }
+    return sum / double(a.extent(0) * a.extent(1) * a.extent(2));
+}
+
+// Maximum difference between two images over each tile interior of a tiling.
+void require_tile_interiors_close(
+    ConstView3Df a,
+    ConstView3Df b,
+    size_t tile_size,
+    double max_error)
+{
+    REQUIRE(a.extent(0) == b.extent(0));
+    REQUIRE(a.extent(1) == b.extent(1));
+    REQUIRE(a.extent(2) == b.extent(2));
+    for (size_t y0 = 0; y0 < a.extent(1); y0 += tile_size) {
+        for (size_t x0 = 0; x0 < a.extent(0); x0 += tile_size) {
+            double error = 0;
+            for (size_t y = y0; y < std::min(y0 + tile_size, a.extent(1)); ++y) {
+                for (size_t x = x0; x < std::min(x0 + tile_size, a.extent(0)); ++x) {
+                    for (size_t c = 0; c < a.extent(2); ++c) {
+                        error =
+                            std::max(error, std::abs(double(a(x, y, c)) - double(b(x, y, c))));
+                    }
+                }
+            }
+            INFO("tile (" << x0 << ", " << y0 << ")");
+            REQUIRE(error < max_error);
+        }
+    }
+}
+
+} // namespace
+
+TEST_CASE("texture filtering tiled", "[texproc][tiling]" LA_SLOW_DEBUG_FLAG)
+{
+    using Scalar = double;
+    using Index = uint32_t;
+    auto mesh = lagrange::testing::load_surface_mesh<Scalar, Index>("open/core/blub/blub.obj");
+    auto img = load_image(lagrange::testing::get_data_path("open/texproc/blub_diffuse_64x64.png"));
+    auto expected = load_image(
+        lagrange::testing::get_data_path("open/texproc/blub_diffuse_64x64.png"));
+
+    lagrange::texproc::FilteringOptions options;
+    lagrange::texproc::TilingOptions tiling_options;
+
+    SECTION("single tile")
+    {
+        options.gradient_scale = 0;
+        lagrange::texproc::texture_filtering(mesh, expected.to_mdspan(), options);
+        tiling_options.tile_size = 64;
+        lagrange::texproc::texture_filtering_tiled(mesh, img.to_mdspan(), options, tiling_options);
+        REQUIRE(mean_abs_difference(img.to_mdspan(), expected.to_mdspan()) < 1e-5);
+    }
+
+    SECTION("multiple tiles, smoothing")
+    {
+        options.gradient_scale = 0;
+        lagrange::texproc::texture_filtering(mesh, expected.to_mdspan(), options);
+        tiling_options.tile_size = 32;
+        tiling_options.halo_size = 16;
+        tiling_options.max_tiles_in_flight = 2;
+        lagrange::texproc::texture_filtering_tiled(mesh, img.to_mdspan(), options, tiling_options);
+        REQUIRE(mean_abs_difference(img.to_mdspan(), expected.to_mdspan()) < 1e-2);
+        // Within about five 8-bit levels everywhere, so that a seam between tiles is caught
+        require_tile_interiors_close(img.to_mdspan(), expected.to_mdspan(), 32, 2e-2);
+    }
+
+    SECTION("multiple tiles, sharpening")
+    {
+        options.gradient_scale = 5;
+        lagrange::texproc::texture_filtering(mesh, expected.to_mdspan(), options);
+        tiling_options.tile_size = 32;
+        tiling_options.halo_size = 16;
+        lagrange::texproc::texture_filtering_tiled(mesh, img.to_mdspan(), options, tiling_options);
+        REQUIRE(mean_abs_difference(img.to_mdspan(), expected.to_mdspan()) < 1e-2);
+        require_tile_interiors_close(img.to_mdspan(), expected.to_mdspan(), 32, 2e-2);
+    }
+}
+
+TEST_CASE("texture compositing tiled", "[texproc][tiling]" LA_SLOW_DEBUG_FLAG)
+{
+    using Scalar = double;
+    using Index = uint32_t;
+    auto mesh = lagrange::testing::load_surface_mesh<Scalar, Index>("open/core/blub/blub.obj");
+    auto img = load_image(lagrange::testing::get_data_path("open/texproc/blub_diffuse_64x64.png"));
+
+    // Two copies of the same texture with complementary weights
+    auto weights0 = lagrange::image::experimental::create_image<float>(64, 64, 1);
+    auto weights1 = lagrange::image::experimental::create_image<float>(64, 64, 1);
+    for (size_t x = 0; x < 64; ++x) {
+        for (size_t y = 0; y < 64; ++y) {
+            weights0(x, y, 0) = float(x) / 63.f;
+            weights1(x, y, 0) = 1.f - float(x) / 63.f;
+        }
+    }
+    std::vector<lagrange::texproc::ConstWeightedTextureView<float>> textures = {
+        {img.to_mdspan(), weights0.to_mdspan()},
+        {img.to_mdspan(), weights1.to_mdspan()},
+    };
+
+    lagrange::texproc::CompositingOptions options;
+    auto expected = lagrange::texproc::texture_compositing(mesh, textures, options);
+
+    lagrange::texproc::TilingOptions tiling_options;
+    tiling_options.tile_size = 32;
+    tiling_options.halo_size = 16;
+    auto composite =
+        lagrange::texproc::texture_compositing_tiled(mesh, textures, options, tiling_options);
+    REQUIRE(mean_abs_difference(composite.to_mdspan(), expected.to_mdspan()) < 1e-2);
+}
@@ -48,6 +48,7 @@ int main(int argc, char** argv)
         double voxel_size = 0.001;
         bool relative = true;
         int num_spheres = 50;
+        double max_error = 1.0;
         bool overlap = true;
     } args;
 
@@ -56,6 +57,10 @@ int main(int argc, char** argv)
     app.add_option("output", args.output, "Output mesh.");
     app.add_option("-s,--voxel-size", args.voxel_size, "Voxel size.");
     app.add_option("-n,--num-spheres", args.num_spheres, "Max number of spheres");
+    app.add_option(
+        "-e,--max-error",
+        args.max_error,
+        "Stop once the largest uncovered sphere is smaller than this (in voxels).");
     app.add_flag("--overlap,!--no-overlap", args.overlap, "Allow overlaps");
     app.add_option(
         "-r,--relative",
@@ -80,8 +85,11 @@ int main(int argc, char** argv)
     auto grid = lagrange::volume::mesh_to_volume(*mesh, args.voxel_size);
 
     lagrange::logger().info("Filling with spheres");
-    Eigen::Matrix<float, Eigen::Dynamic, 4, Eigen::RowMajor> spheres;
-    lagrange::volume::fill_with_spheres(*grid, spheres, args.num_spheres, args.overlap);
+    lagrange::volume::FillWithSpheresOptions fill_options;
+    fill_options.max_spheres = static_cast<size_t>(std::max(args.num_spheres, 1));
+    fill_options.max_error = args.max_error;
+    fill_options.overlapping = args.overlap;
+    auto spheres = lagrange::volume::fill_with_spheres(*grid, fill_options);
 
     lagrange::logger().info("Converting to triangle mesh");
     std::vector<std::unique_ptr<MeshType>> meshes;
@@ -12,6 +12,7 @@
 #pragma once
 
 #include <lagrange/Logger.h>
+#include <lagrange/volume/types.h>
 
 // clang-format off
 #include <lagrange/utils/warnoff.h>
@@ -25,6 +26,50 @@
 namespace lagrange {
 namespace volume {
 
+///
+/// Options for sphere packing.
+///
+struct FillWithSpheresOptions
+{
+    /// Maximum number of spheres to place (target count).
+    size_t max_spheres = 50;
+
+    /// Error budget. The packing stops early once the largest sphere that still fits in the region
+    /// not covered by existing spheres has a radius smaller than this value. Candidates closer than
+    /// this value to the surface are discarded.
+    double max_error = 1.0;
+
+    /// Whether `max_error` is relative to the grid voxel size.
+    bool relative = true;
+
+    /// Whether to allow overlapping spheres. If true, each sphere touches the surface of the input
+    /// volume. Otherwise, spheres are shrunk to avoid overlapping previously placed spheres.
+    bool overlapping = false;
+
+    /// Number of interior points sampled as candidate sphere centers.
+    size_t num_candidates = 10000;
+
+    /// Seed used to sample candidate sphere centers.
+    unsigned seed = 0;
+};
+
+///
+/// Fill a solid volume with spheres of varying radii. Spheres are placed greedily, at the
+/// candidate point furthest from both the surface and the previously placed spheres. Candidate
+/// radii are computed in parallel, and overlap updates only visit candidates near each new sphere
+/// using a uniform grid.
+///
+/// @param[in]  grid        Input volume. Must be a level set (signed distance field).
+/// @param[in]  options     Packing options.
+///
+/// @tparam     GridScalar  Grid scalar type. Can only be float or double.
+///
+/// @return     N x 4 array of sphere centers + radii, in the order they were placed.
+///
+template <typename GridScalar>
+auto fill_with_spheres(const Grid<GridScalar>& grid, const FillWithSpheresOptions& options = {})
+    -> Eigen::Matrix<float, Eigen::Dynamic, 4, Eigen::RowMajor>;
+
 ///
 /// Fill a solid volume with spheres of varying radii.
 ///
@@ -0,0 +1,42 @@
+/*
+ * Copyright 2025 Adobe. All rights reserved.
+ * This file is licensed to you under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License. You may obtain a copy
+ * of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR REPRESENTATIONS
+ * OF ANY KIND, either express or implied. See the License for the specific language
+ * governing permissions and limitations under the License.
+ */
+#pragma once
+
+#include <lagrange/utils/span.h>
+#include <lagrange/volume/types.h>
+
+namespace lagrange::volume {
+
+/// Boolean operation between solids represented by signed distance fields.
+enum class BooleanOperation {
+    Union, ///< Union of all inputs.
+    Intersection, ///< Intersection of all inputs.
+    Difference, ///< First input minus the union of all other inputs.
+};
+
+///
+/// Computes a boolean operation between an arbitrary number of signed distance fields. Inputs are
+/// combined pairwise in a balanced tree, and independent pairs are processed in parallel. Inputs
+/// whose transform differs from the first grid are resampled to match it.
+///
+/// @param[in]  grids       Input grids. Must be level sets (signed distance fields).
+/// @param[in]  operation   Boolean operation to compute.
+///
+/// @tparam     GridScalar  Grid scalar type. Can only be float or double.
+///
+/// @return     New grid holding the result of the operation.
+///
+template <typename GridScalar>
+auto grid_boolean(span<const Grid<GridScalar>* const> grids, BooleanOperation operation)
+    -> typename Grid<GridScalar>::Ptr;
+
+} // namespace lagrange::volume
@@ -0,0 +1,55 @@
+/*
+ * Copyright 2025 Adobe. All rights reserved.
+ * This file is licensed to you under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License. You may obtain a copy
+ * of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR REPRESENTATIONS
+ * OF ANY KIND, either express or implied. See the License for the specific language
+ * governing permissions and limitations under the License.
+ */
+#pragma once
+
+#include <lagrange/volume/types.h>
+
+namespace lagrange::volume {
+
+/// Morphological operation applied to the solid represented by a signed distance field.
+enum class MorphologyOperation {
+    Dilate, ///< Grow the solid by the given radius.
+    Erode, ///< Shrink the solid by the given radius.
+    Open, ///< Erode then dilate. Removes thin features and small components.
+    Close, ///< Dilate then erode. Fills small holes and gaps.
+};
+
+/// Grid morphology options.
+struct GridMorphologyOptions
+{
+    /// Operation to apply.
+    MorphologyOperation operation = MorphologyOperation::Dilate;
+
+    /// Radius of the operation. Must be non-negative.
+    double radius = 1.0;
+
+    /// Whether the radius is relative to the grid voxel size.
+    bool relative = true;
+};
+
+///
+/// Applies a morphological operation to a signed distance field. The narrow band is first widened
+/// by the operation radius using fast sweeping, and the offset surface is then re-voxelized with
+/// the same narrow band width as the input. Both steps are multi-threaded.
+///
+/// @param[in]  grid        Input grid. Must be a level set (signed distance field).
+/// @param[in]  options     Morphology options.
+///
+/// @tparam     GridScalar  Grid scalar type. Can only be float or double.
+///
+/// @return     New grid holding the result of the operation.
+///
+template <typename GridScalar>
+auto apply_grid_morphology(const Grid<GridScalar>& grid, const GridMorphologyOptions& options = {})
+    -> typename Grid<GridScalar>::Ptr;
+
+} // namespace lagrange::volume
@@ -12,6 +12,7 @@
 #pragma once
 
 #include <lagrange/SurfaceMesh.h>
+#include <lagrange/utils/function_ref.h>
 #include <lagrange/volume/types.h>
 
 #ifdef LAGRANGE_ENABLE_LEGACY_FUNCTIONS
@@ -51,4 +52,60 @@ template <typename MeshType, typename GridScalar>
 auto volume_to_mesh(const Grid<GridScalar>& grid, const VolumeToMeshOptions& options = {})
     -> SurfaceMesh<typename MeshType::Scalar, typename MeshType::Index>;
 
+/// Options for tiled isosurfacing of large grids.
+struct VolumeToMeshTiledOptions : public VolumeToMeshOptions
+{
+    /// Size (in voxels) of the cubic blocks meshed independently. Rounded up to a multiple of the
+    /// OpenVDB leaf node size. Peak memory usage is proportional to the number of blocks in flight
+    /// times the block size.
+    int tile_size = 128;
+
+    /// Maximum number of blocks meshed concurrently. If 0, uses the number of threads of the
+    /// current task arena.
+    size_t max_concurrent_tiles = 0;
+};
+
+///
+/// Mesh the isosurface of a OpenVDB sparse voxel grid block by block, handing each finished block
+/// to a callback. Blocks are meshed in parallel from a local copy of the grid around each block, so
+/// that the full output mesh never needs to be held in memory.
+///
+/// Each facet of the isosurface is output in exactly one block, and vertices shared by adjacent
+/// blocks have bitwise identical positions (and normals), so blocks can be stitched by merging
+/// vertices with identical positions. Callbacks are invoked sequentially, in a deterministic
+/// order.
+///
+/// @note       Adaptive meshing is not supported in tiled mode, `options.adaptivity` is ignored.
+///
+/// @param[in]  grid        Input grid.
+/// @param[in]  callback    Callback receiving each non-empty meshed block.
+/// @param[in]  options     Isosurfacing options.
+///
+/// @tparam     MeshType    Output mesh type.
+/// @tparam     GridScalar  Grid scalar type. Can only be float or double.
+///
+template <typename MeshType, typename GridScalar>
+void volume_to_mesh_tiled(
+    const Grid<GridScalar>& grid,
+    function_ref<void(SurfaceMesh<typename MeshType::Scalar, typename MeshType::Index>&&)>
+        callback,
+    const VolumeToMeshTiledOptions& options = {});
+
+///
+/// Mesh the isosurface of a OpenVDB sparse voxel grid block by block, and stitch the blocks into a
+/// single mesh. Intermediate memory usage is bounded by the block size, but the output mesh is
+/// held in memory.
+///
+/// @param[in]  grid        Input grid.
+/// @param[in]  options     Isosurfacing options.
+///
+/// @tparam     MeshType    Output mesh type.
+/// @tparam     GridScalar  Grid scalar type. Can only be float or double.
+///
+/// @return     Meshed isosurface.
+///
+template <typename MeshType, typename GridScalar>
+auto volume_to_mesh_tiled(const Grid<GridScalar>& grid, const VolumeToMeshTiledOptions& options = {})
+    -> SurfaceMesh<typename MeshType::Scalar, typename MeshType::Index>;
+
 } // namespace lagrange::volume
@@ -0,0 +1,62 @@
+/*
+ * Copyright 2025 Adobe. All rights reserved.
+ * This file is licensed to you under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License. You may obtain a copy
+ * of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR REPRESENTATIONS
+ * OF ANY KIND, either express or implied. See the License for the specific language
+ * governing permissions and limitations under the License.
+ */
+#pragma once
+
+#include <lagrange/SurfaceMesh.h>
+#include <lagrange/utils/span.h>
+#include <lagrange/volume/grid_boolean.h>
+#include <lagrange/volume/grid_morphology.h>
+#include <lagrange/volume/mesh_to_volume.h>
+#include <lagrange/volume/volume_to_mesh.h>
+
+#include <optional>
+
+namespace lagrange::volume {
+
+/// Volumetric boolean options.
+struct VolumetricBooleanOptions
+{
+    /// Boolean operation to compute between the input meshes.
+    BooleanOperation operation = BooleanOperation::Union;
+
+    /// Optional morphological operation applied to the result of the boolean operation.
+    std::optional<GridMorphologyOptions> morphology;
+
+    /// Voxelization options. A negative voxel size is interpreted as being relative to the
+    /// diagonal of the bbox of all input meshes, so that every input shares the same grid.
+    MeshToVolumeOptions mesh_to_volume;
+
+    /// Isosurfacing options.
+    VolumeToMeshOptions volume_to_mesh;
+};
+
+///
+/// Computes a boolean operation between closed meshes by voxelizing them into signed distance
+/// fields, combining the fields, optionally applying a morphological operation (e.g. to thicken
+/// or smooth the result), and meshing the resulting isosurface. Input meshes are voxelized in
+/// parallel.
+///
+/// @param[in]  meshes      Input meshes. Each must be a triangle mesh, a quad mesh, or a
+///                         quad-dominant mesh.
+/// @param[in]  options     Boolean options.
+///
+/// @tparam     Scalar      Mesh scalar type.
+/// @tparam     Index       Mesh index type.
+///
+/// @return     Meshed isosurface of the result.
+///
+template <typename Scalar, typename Index>
+auto volumetric_boolean(
+    span<const SurfaceMesh<Scalar, Index>* const> meshes,
+    const VolumetricBooleanOptions& options = {}) -> SurfaceMesh<Scalar, Index>;
+
+} // namespace lagrange::volume
@@ -0,0 +1,319 @@
+/*
+ * Copyright 2025 Adobe. All rights reserved.
+ * This file is licensed to you under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License. You may obtain a copy
+ * of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR REPRESENTATIONS
+ * OF ANY KIND, either express or implied. See the License for the specific language
+ * governing permissions and limitations under the License.
+ */
+#include <lagrange/volume/fill_with_spheres.h>
+
+#include <lagrange/Logger.h>
+#include <lagrange/utils/Error.h>
+#include <lagrange/utils/assert.h>
+#include <lagrange/volume/GridTypes.h>
+
+// clang-format off
+#include <lagrange/utils/warnoff.h>
+#include <openvdb/tools/LevelSetUtil.h>
+#include <openvdb/tools/VolumeToSpheres.h>
+#include <openvdb/tree/LeafManager.h>
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <lagrange/utils/warnon.h>
+// clang-format on
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <queue>
+#include <vector>
+
+namespace lagrange::volume {
+
+namespace {
+
+// Splitmix64 finalizer. Used to sample candidates deterministically, independently of the order
+// in which voxels are visited.
+uint64_t mix_bits(uint64_t x)
+{
+    x ^= x >> 30;
+    x *= 0xbf58476d1ce4e5b9ULL;
+    x ^= x >> 27;
+    x *= 0x94d049bb133111ebULL;
+    x ^= x >> 31;
+    return x;
+}
+
+uint64_t hash_coord(const openvdb::Coord& ijk, uint64_t seed)
+{
+    uint64_t h = mix_bits(seed + 0x9e3779b97f4a7c15ULL);
+    h = mix_bits(h ^ static_cast<uint32_t>(ijk.x()));
+    h = mix_bits(h ^ static_cast<uint32_t>(ijk.y()));
+    h = mix_bits(h ^ static_cast<uint32_t>(ijk.z()));
+    return h;
+}
+
+// Maps a hash to a uniform number in [0, 1).
+double to_unit(uint64_t h)
+{
+    return static_cast<double>(h >> 11) * 0x1.0p-53;
+}
+
+///
+/// Samples interior voxels of a level set. Each interior voxel is kept with the same probability,
+/// so that approximately `num_samples` voxels are returned.
+///
+template <typename GridScalar>
+std::vector<openvdb::Coord>
+sample_interior_voxels(const Grid<GridScalar>& grid, size_t num_samples, unsigned seed)
+{
+    auto mask = openvdb::tools::sdfInteriorMask(grid);
+    const auto num_interior = mask->activeVoxelCount();
+    if (num_interior == 0) {
+        return {};
+    }
+    const double prob = std::min(1.0, double(num_samples) / double(num_interior));
+
+    // Voxels from leaf nodes, visited in parallel.
+    using BoolTree = typename std::decay_t<decltype(*mask)>::TreeType;
+    openvdb::tree::LeafManager<const BoolTree> leaf_manager(mask->tree());
+    std::vector<std::vector<openvdb::Coord>> leaf_samples(leaf_manager.leafCount());
+    leaf_manager.foreach([&](const auto& leaf, size_t idx) {
+        for (auto it = leaf.cbeginValueOn(); it; ++it) {
+            if (to_unit(hash_coord(it.getCoord(), seed)) < prob) {
+                leaf_samples[idx].push_back(it.getCoord());
+            }
+        }
+    });
+
+    std::vector<openvdb::Coord> samples;
+    for (const auto& s : leaf_samples) {
+        samples.insert(samples.end(), s.begin(), s.end());
+    }
+
+    // Active tiles cover large interior regions. Draw random voxels in each of them.
+    auto tile_it = mask->tree().cbeginValueOn();
+    tile_it.setMaxDepth(BoolTree::ValueOnCIter::LEAF_DEPTH - 1);
+    for (; tile_it; ++tile_it) {
+        const openvdb::CoordBBox bbox = tile_it.getBoundingBox();
+        const openvdb::Coord dim = bbox.dim();
+        uint64_t h = hash_coord(bbox.min(), seed);
+        const auto count =
+            static_cast<size_t>(std::floor(prob * double(bbox.volume()) + to_unit(h)));
+        for (size_t k = 0; k < count; ++k) {
+            openvdb::Coord ijk = bbox.min();
+            for (int d = 0; d < 3; ++d) {
+                h = mix_bits(h);
+                ijk[d] += static_cast<int>(h % static_cast<uint64_t>(dim[d]));
+            }
+            samples.push_back(ijk);
+        }
+    }
+
+    return samples;
+}
+
+///
+/// Uniform grid over a static set of points, stored in compressed row format.
+///
+class PointGrid
+{
+public:
+    PointGrid(const std::vector<Eigen::Vector3f>& points, float min_cell_size)
+    {
+        la_debug_assert(!points.empty());
+        for (const auto& p : points) {
+            m_bbox.extend(p);
+        }
+
+        // Aim for roughly one point per cell.
+        const Eigen::Vector3f extent = m_bbox.sizes();
+        const float volume = std::max(extent.prod(), 0.f);
+        m_cell_size = std::max(std::cbrt(volume / float(points.size())), min_cell_size);
+        for (int d = 0; d < 3; ++d) {
+            m_dims[d] = std::max(1, static_cast<int>(std::floor(extent[d] / m_cell_size)) + 1);
+        }
+
+        const size_t num_cells = size_t(m_dims[0]) * size_t(m_dims[1]) * size_t(m_dims[2]);
+        m_offsets.assign(num_cells + 1, 0);
+        std::vector<size_t> point_cells(points.size());
+        for (size_t i = 0; i < points.size(); ++i) {
+            point_cells[i] = cell_index(cell_coord(points[i]));
+            ++m_offsets[point_cells[i] + 1];
+        }
+        for (size_t c = 0; c < num_cells; ++c) {
+            m_offsets[c + 1] += m_offsets[c];
+        }
+        m_indices.resize(points.size());
+        std::vector<size_t> cursor(m_offsets.begin(), m_offsets.end() - 1);
+        for (size_t i = 0; i < points.size(); ++i) {
+            m_indices[cursor[point_cells[i]]++] = static_cast<uint32_t>(i);
+        }
+    }
+
+    ///
+    /// Calls a function on every point stored in a cell overlapping a ball. Cells are visited in
+    /// parallel, so the callback must be thread-safe.
+    ///
+    template <typename Func>
+    void parallel_foreach_near(const Eigen::Vector3f& center, float radius, Func&& func) const
+    {
+        const Eigen::Vector3i lo = cell_coord((center.array() - radius).matrix());
+        const Eigen::Vector3i hi = cell_coord((center.array() + radius).matrix());
+        tbb::parallel_for(tbb::blocked_range<int>(lo.z(), hi.z() + 1), [&](const auto& r) {
+            for (int z = r.begin(); z != r.end(); ++z) {
+                for (int y = lo.y(); y <= hi.y(); ++y) {
+                    for (int x = lo.x(); x <= hi.x(); ++x) {
+                        const size_t c = cell_index({x, y, z});
+                        for (size_t k = m_offsets[c]; k < m_offsets[c + 1]; ++k) {
+                            func(m_indices[k]);
+                        }
+                    }
+                }
+            }
+        });
+    }
+
+private:
+    Eigen::Vector3i cell_coord(const Eigen::Vector3f& p) const
+    {
+        Eigen::Vector3i ijk;
+        for (int d = 0; d < 3; ++d) {
+            const float t = std::floor((p[d] - m_bbox.min()[d]) / m_cell_size);
+            ijk[d] = static_cast<int>(std::clamp(t, 0.f, float(m_dims[d] - 1)));
+        }
+        return ijk;
+    }
+
+    size_t cell_index(const Eigen::Vector3i& ijk) const
+    {
+        return (size_t(ijk.z()) * size_t(m_dims[1]) + size_t(ijk.y())) * size_t(m_dims[0]) +
+               size_t(ijk.x());
+    }
+
+private:
+    Eigen::AlignedBox<float, 3> m_bbox;
+    float m_cell_size = 1.f;
+    std::array<int, 3> m_dims = {1, 1, 1};
+    std::vector<size_t> m_offsets;
+    std::vector<uint32_t> m_indices;
+};
+
+} // namespace
+
+template <typename GridScalar>
+auto fill_with_spheres(const Grid<GridScalar>& grid, const FillWithSpheresOptions& options)
+    -> Eigen::Matrix<float, Eigen::Dynamic, 4, Eigen::RowMajor>
+{
+    openvdb::initialize();
+
+    if (grid.getGridClass() != openvdb::GRID_LEVEL_SET) {
+        throw Error("Sphere packing can only be applied to signed distance fields.");
+    }
+
+    const float voxel_size = static_cast<float>(grid.voxelSize()[0]);
+    const float max_error =
+        static_cast<float>(options.relative ? options.max_error * voxel_size : options.max_error);
+
+    Eigen::Matrix<float, Eigen::Dynamic, 4, Eigen::RowMajor> spheres(0, 4);
+    if (options.max_spheres == 0) {
+        return spheres;
+    }
+
+    // 1. Sample candidate sphere centers inside the volume.
+    auto coords = sample_interior_voxels(grid, options.num_candidates, options.seed);
+    if (coords.empty()) {
+        logger().warn("Input volume has no interior voxels.");
+        return spheres;
+    }
+    std::vector<openvdb::Vec3R> positions(coords.size());
+    tbb::parallel_for(size_t(0), coords.size(), [&](size_t i) {
+        positions[i] = grid.indexToWorld(coords[i]);
+    });
+    coords.clear();
+
+    // 2. Compute the distance from each candidate to the surface. This search is multi-threaded.
+    std::vector<float> surface_distances;
+    {
+        auto csp = openvdb::tools::ClosestSurfacePoint<Grid<GridScalar>>::create(grid);
+        if (!csp || !csp->search(positions, surface_distances)) {
+            throw Error("Failed to compute the distance from candidates to the surface.");
+        }
+    }
+    la_debug_assert(surface_distances.size() == positions.size());
+
+    std::vector<Eigen::Vector3f> centers(positions.size());
+    for (size_t i = 0; i < positions.size(); ++i) {
+        centers[i] = Eigen::Vector3d(positions[i].x(), positions[i].y(), positions[i].z())
+                         .template cast<float>();
+    }
+    positions.clear();
+    logger().debug("Sampled {} candidate sphere centers", centers.size());
+
+    // 3. Greedily place spheres. The score of a candidate is the radius of the largest sphere
+    // centered at it that fits in the uncovered region, and only ever decreases. Stale heap
+    // entries are refreshed lazily when popped.
+    const PointGrid point_grid(centers, voxel_size);
+    std::vector<float> scores = surface_distances;
+    using Entry = std::pair<float, uint32_t>;
+    std::priority_queue<Entry> queue;
+    for (size_t i = 0; i < scores.size(); ++i) {
+        if (scores[i] >= max_error) {
+            queue.emplace(scores[i], static_cast<uint32_t>(i));
+        }
+    }
+
+    std::vector<Eigen::Vector4f> result;
+    float remaining_error = 0;
+    while (!queue.empty()) {
+        const auto [score, i] = queue.top();
+        queue.pop();
+        if (score > scores[i]) {
+            if (scores[i] >= max_error) {
+                queue.emplace(scores[i], i);
+            }
+            continue;
+        }
+        if (result.size() >= options.max_spheres) {
+            remaining_error = score;
+            break;
+        }
+
+        const float radius = options.overlapping ? surface_distances[i] : score;
+        const Eigen::Vector3f center = centers[i];
+        result.emplace_back(center.x(), center.y(), center.z(), radius);
+
+        // Only candidates within `radius + score` of the new sphere can see their score decrease,
+        // since no score exceeds the current maximum.
+        point_grid.parallel_foreach_near(center, radius + score, [&](uint32_t j) {
+            const float d = (centers[j] - center).norm() - radius;
+            if (d < scores[j]) {
+                scores[j] = d;
+            }
+        });
+    }
+
+    logger().debug(
+        "Placed {} spheres, largest uncovered candidate radius: {}",
+        result.size(),
+        remaining_error);
+
+    spheres.resize(static_cast<Eigen::Index>(result.size()), 4);
+    for (size_t k = 0; k < result.size(); ++k) {
+        spheres.row(static_cast<Eigen::Index>(k)) = result[k].transpose();
+    }
+    return spheres;
+}
+
+#define LA_X_fill_with_spheres(_, GridScalar)                                 \
+    template Eigen::Matrix<float, Eigen::Dynamic, 4, Eigen::RowMajor>         \
+    fill_with_spheres<GridScalar>(                                            \
+        const Grid<GridScalar>& grid,                                         \
+        const FillWithSpheresOptions& options);
+LA_VOLUME_GRID_X(fill_with_spheres, 0)
+
+} // namespace lagrange::volume
@@ -0,0 +1,117 @@
+/*
+ * Copyright 2025 Adobe. All rights reserved.
+ * This file is licensed to you under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License. You may obtain a copy
+ * of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR REPRESENTATIONS
+ * OF ANY KIND, either express or implied. See the License for the specific language
+ * governing permissions and limitations under the License.
+ */
+#include <lagrange/volume/grid_boolean.h>
+
+#include <lagrange/Logger.h>
+#include <lagrange/utils/Error.h>
+#include <lagrange/utils/assert.h>
+#include <lagrange/volume/GridTypes.h>
+
+// clang-format off
+#include <lagrange/utils/warnoff.h>
+#include <openvdb/tools/Composite.h>
+#include <openvdb/tools/GridTransformer.h>
+#include <tbb/parallel_invoke.h>
+#include <lagrange/utils/warnon.h>
+// clang-format on
+
+namespace lagrange::volume {
+
+namespace {
+
+///
+/// Returns a copy of the input grid expressed in the target transform.
+///
+template <typename GridScalar>
+auto copy_with_transform(const Grid<GridScalar>& grid, const openvdb::math::Transform& transform)
+    -> typename Grid<GridScalar>::Ptr
+{
+    if (grid.transform() == transform) {
+        return grid.deepCopy();
+    }
+    logger().debug("Resampling grid to match the transform of the first input");
+    auto result = Grid<GridScalar>::create(grid.background());
+    result->setTransform(transform.copy());
+    result->setGridClass(grid.getGridClass());
+    openvdb::tools::resampleToMatch<openvdb::tools::BoxSampler>(grid, *result);
+    return result;
+}
+
+///
+/// Recursively combines a range of grids. Both halves of the range are reduced in parallel, and
+/// the results are merged in place, which consumes the right-hand side.
+///
+template <typename GridScalar>
+auto reduce_grids(
+    span<const Grid<GridScalar>* const> grids,
+    const openvdb::math::Transform& transform,
+    BooleanOperation operation) -> typename Grid<GridScalar>::Ptr
+{
+    la_debug_assert(!grids.empty());
+    if (grids.size() == 1) {
+        return copy_with_transform(*grids[0], transform);
+    }
+
+    const size_t mid = grids.size() / 2;
+    typename Grid<GridScalar>::Ptr lhs;
+    typename Grid<GridScalar>::Ptr rhs;
+    tbb::parallel_invoke(
+        [&] { lhs = reduce_grids(grids.first(mid), transform, operation); },
+        [&] { rhs = reduce_grids(grids.subspan(mid), transform, operation); });
+
+    switch (operation) {
+    case BooleanOperation::Union: openvdb::tools::csgUnion(*lhs, *rhs); break;
+    case BooleanOperation::Intersection: openvdb::tools::csgIntersection(*lhs, *rhs); break;
+    default: throw Error("Unsupported reduction operation");
+    }
+    return lhs;
+}
+
+} // namespace
+
+template <typename GridScalar>
+auto grid_boolean(span<const Grid<GridScalar>* const> grids, BooleanOperation operation)
+    -> typename Grid<GridScalar>::Ptr
+{
+    openvdb::initialize();
+
+    la_runtime_assert(!grids.empty(), "At least one input grid is required");
+    for (const auto* grid : grids) {
+        la_runtime_assert(grid != nullptr, "Input grid is null");
+        if (grid->getGridClass() != openvdb::GRID_LEVEL_SET) {
+            throw Error("Boolean operations can only be applied to signed distance fields.");
+        }
+    }
+
+    const openvdb::math::Transform& transform = grids.front()->transform();
+    switch (operation) {
+    case BooleanOperation::Union:
+    case BooleanOperation::Intersection: return reduce_grids(grids, transform, operation);
+    case BooleanOperation::Difference: {
+        auto result = copy_with_transform(*grids.front(), transform);
+        if (grids.size() > 1) {
+            auto others = reduce_grids(grids.subspan(1), transform, BooleanOperation::Union);
+            openvdb::tools::csgDifference(*result, *others);
+        }
+        return result;
+    }
+    default: throw Error("Unsupported boolean operation");
+    }
+}
+
+#define LA_X_grid_boolean(_, GridScalar)                              \
+    template typename Grid<GridScalar>::Ptr grid_boolean<GridScalar>( \
+        span<const Grid<GridScalar>* const> grids,                    \
+        BooleanOperation operation);
+LA_VOLUME_GRID_X(grid_boolean, 0)
+
+} // namespace lagrange::volume
@@ -0,0 +1,96 @@
+/*
+ * Copyright 2025 Adobe. All rights reserved.
+ * This file is licensed to you under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License. You may obtain a copy
+ * of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR REPRESENTATIONS
+ * OF ANY KIND, either express or implied. See the License for the specific language
+ * governing permissions and limitations under the License.
+ */
+#include <lagrange/volume/grid_morphology.h>
+
+#include <lagrange/Logger.h>
+#include <lagrange/utils/Error.h>
+#include <lagrange/utils/assert.h>
+#include <lagrange/volume/GridTypes.h>
+
+// clang-format off
+#include <lagrange/utils/warnoff.h>
+#include <openvdb/tools/FastSweeping.h>
+#include <openvdb/tools/LevelSetRebuild.h>
+#include <lagrange/utils/warnon.h>
+// clang-format on
+
+#include <cmath>
+
+namespace lagrange::volume {
+
+namespace {
+
+///
+/// Moves the zero level set of a signed distance field by a signed distance. A positive offset
+/// grows the solid, a negative one shrinks it.
+///
+template <typename GridScalar>
+auto offset_level_set(const Grid<GridScalar>& grid, double offset) -> typename Grid<GridScalar>::Ptr
+{
+    const double voxel_size = grid.voxelSize()[0];
+    const float half_width = static_cast<float>(grid.background() / voxel_size);
+
+    // The offset surface must lie inside the narrow band before it can be extracted, so the band is
+    // widened by the offset distance first.
+    const int dilation = static_cast<int>(std::ceil(std::abs(offset) / voxel_size)) + 1;
+    auto widened = openvdb::tools::dilateSdf(grid, dilation);
+
+    auto result = openvdb::tools::levelSetRebuild(
+        *widened,
+        static_cast<float>(offset),
+        half_width,
+        half_width);
+    result->setName(grid.getName());
+    return result;
+}
+
+} // namespace
+
+template <typename GridScalar>
+auto apply_grid_morphology(const Grid<GridScalar>& grid, const GridMorphologyOptions& options)
+    -> typename Grid<GridScalar>::Ptr
+{
+    openvdb::initialize();
+
+    if (grid.getGridClass() != openvdb::GRID_LEVEL_SET) {
+        throw Error("Morphological operations can only be applied to signed distance fields.");
+    }
+    la_runtime_assert(options.radius >= 0, "Morphology radius must be non-negative");
+
+    double radius = options.radius;
+    if (options.relative) {
+        auto vs = grid.voxelSize();
+        radius *= (vs.x() + vs.y() + vs.z()) / 3.0;
+    }
+
+    switch (options.operation) {
+    case MorphologyOperation::Dilate: return offset_level_set(grid, radius);
+    case MorphologyOperation::Erode: return offset_level_set(grid, -radius);
+    case MorphologyOperation::Open: {
+        auto eroded = offset_level_set(grid, -radius);
+        return offset_level_set(*eroded, radius);
+    }
+    case MorphologyOperation::Close: {
+        auto dilated = offset_level_set(grid, radius);
+        return offset_level_set(*dilated, -radius);
+    }
+    default: throw Error("Unsupported morphology operation");
+    }
+}
+
+#define LA_X_apply_grid_morphology(_, GridScalar)                              \
+    template typename Grid<GridScalar>::Ptr apply_grid_morphology<GridScalar>( \
+        const Grid<GridScalar>& grid,                                          \
+        const GridMorphologyOptions& options);
+LA_VOLUME_GRID_X(apply_grid_morphology, 0)
+
+} // namespace lagrange::volume
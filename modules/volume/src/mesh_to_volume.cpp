@@ -24,6 +24,8 @@
 #include <lagrange/utils/warnoff.h>
 #include <openvdb/tools/ValueTransformer.h>
 #include <openvdb/tools/MeshToVolume.h>
+#include <openvdb/tools/SignedFloodFill.h>
+#include <openvdb/tree/LeafManager.h>
 #include <lagrange/utils/warnon.h>
 // clang-format on
 
@@ -83,6 +85,43 @@ protected:
     const openvdb::math::Transform& m_transform;
 };
 
+///
+/// Signs the active voxels of an unsigned narrow-band distance field using winding number queries,
+/// and propagates the sign to inactive voxels and tiles. Leaf nodes are processed in parallel, and
+/// all threads share the same winding number engine.
+///
+/// @param      grid        Unsigned distance field to sign in place.
+/// @param[in]  engine      Fast winding number engine built from the input mesh.
+///
+/// @tparam     GridScalar  Grid scalar type.
+///
+template <typename GridScalar>
+void sign_narrow_band_with_winding_number(
+    Grid<GridScalar>& grid,
+    const winding::FastWindingNumber& engine)
+{
+    using TreeType = typename Grid<GridScalar>::TreeType;
+    const openvdb::math::Transform& transform = grid.transform();
+
+    openvdb::tree::LeafManager<TreeType> leaf_manager(grid.tree());
+    leaf_manager.foreach([&](typename TreeType::LeafNodeType& leaf, size_t) {
+        for (auto it = leaf.beginValueOn(); it; ++it) {
+            const openvdb::Vec3d pos = transform.indexToWorld(it.getCoord());
+            const std::array<float, 3> p = {
+                static_cast<float>(pos[0]),
+                static_cast<float>(pos[1]),
+                static_cast<float>(pos[2])};
+            if (engine.is_inside(p)) {
+                it.setValue(-std::abs(*it));
+            }
+        }
+    });
+
+    // Inactive voxels and tiles take the sign of their active neighbors.
+    openvdb::tools::signedFloodFill(grid.tree());
+    grid.setGridClass(openvdb::GRID_LEVEL_SET);
+}
+
 } // namespace
 
 template <typename GridScalar, typename Scalar, typename Index>
@@ -159,28 +198,20 @@ auto mesh_to_volume(const SurfaceMesh<Scalar, Index>& mesh_, const MeshToVolumeO
             la_debug_assert(mesh.is_triangle_mesh());
             winding::FastWindingNumber engine(mesh);
 
-            // Use winding number to sign the distance field
-            logger().debug("Computing distance field with winding number signing");
+            // Compute the unsigned distance in the narrow band first, so that winding numbers only
+            // need to be evaluated for active voxels.
+            logger().debug("Computing unsigned distance field");
             const float exterior_bandwidth = 3.0f;
             const float interior_bandwidth = 3.0f;
-            openvdb::util::NullInterrupter null_interrupter;
             grid = openvdb::tools::meshToVolume<Grid<GridScalar>, MeshAdapterType>(
-                null_interrupter,
                 adapter,
                 *transform,
                 exterior_bandwidth,
                 interior_bandwidth,
-                0 /* flags */,
-                nullptr /* polygonIndexGrid */,
-                [transform, &engine](openvdb::Coord ijk) {
-                    openvdb::Vec3d pos = transform->indexToWorld(ijk);
-                    const std::array<float, 3> p = {
-                        static_cast<float>(pos[0]),
-                        static_cast<float>(pos[1]),
-                        static_cast<float>(pos[2])};
-                    return engine.is_inside(p);
-                },
-                openvdb::tools::EVAL_EVERY_VOXEL);
+                openvdb::tools::UNSIGNED_DISTANCE_FIELD);
+
+            logger().debug("Signing narrow band with winding number");
+            sign_narrow_band_with_winding_number<GridScalar>(*grid, engine);
         } else if (options.signing_method == MeshToVolumeOptions::Sign::Unsigned) {
             // Compute unsigned distance field
             const float exterior_bandwidth = 3.0f;
@@ -14,6 +14,9 @@
 #include <lagrange/Attribute.h>
 #include <lagrange/Logger.h>
 #include <lagrange/SurfaceMeshTypes.h>
+#include <lagrange/utils/assert.h>
+#include <lagrange/utils/hash.h>
+#include <lagrange/views.h>
 #include <lagrange/volume/GridTypes.h>
 #include <lagrange/volume/sample_vertex_normal.h>
 
@@ -22,9 +25,16 @@
 #include <openvdb/tools/GridOperators.h>
 #include <openvdb/tools/Interpolation.h>
 #include <openvdb/tools/VolumeToMesh.h>
+#include <tbb/parallel_for.h>
+#include <tbb/task_arena.h>
 #include <lagrange/utils/warnon.h>
 // clang-format on
 
+#include <array>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
 namespace lagrange::volume {
 
 template <typename MeshType, typename GridScalar>
@@ -86,6 +96,258 @@ auto volume_to_mesh(const Grid<GridScalar>& grid, const VolumeToMeshOptions& opt
     return mesh;
 }
 
+namespace {
+
+// Number of voxels copied around each block. Facets owned by a block only depend on voxels within
+// 2 voxels of the block, and gradients used for vertex normals need one more layer.
+constexpr int s_tile_margin = 3;
+
+///
+/// Copies the values of a grid inside an index-space bounding box into a new grid with the same
+/// transform, background and class. Inactive voxels with a non-background value (e.g. the interior
+/// of a level set) are copied as well, so that signs are preserved.
+///
+/// The box is visited one leaf-sized block at a time. Leaves fully inside the box are copied
+/// as a whole, leaves straddling its boundary are copied voxel by voxel, and blocks covered by a
+/// tile are filled with the tile value, so the cost scales with the number of allocated leaves.
+///
+template <typename GridScalar>
+typename Grid<GridScalar>::Ptr copy_grid_region(
+    const Grid<GridScalar>& grid,
+    const openvdb::CoordBBox& bbox)
+{
+    using LeafType = typename Grid<GridScalar>::TreeType::LeafNodeType;
+    constexpr int leaf_dim = static_cast<int>(LeafType::DIM);
+
+    auto region = Grid<GridScalar>::create(grid.background());
+    region->setTransform(grid.transform().copy());
+    region->setGridClass(grid.getGridClass());
+
+    const GridScalar background = grid.background();
+    const auto& src_tree = grid.tree();
+    auto& dst_tree = region->tree();
+
+    const openvdb::Coord first = bbox.min() & ~(leaf_dim - 1);
+    openvdb::Coord origin;
+    for (origin[0] = first[0]; origin[0] <= bbox.max()[0]; origin[0] += leaf_dim) {
+        for (origin[1] = first[1]; origin[1] <= bbox.max()[1]; origin[1] += leaf_dim) {
+            for (origin[2] = first[2]; origin[2] <= bbox.max()[2]; origin[2] += leaf_dim) {
+                openvdb::CoordBBox block(origin, origin.offsetBy(leaf_dim - 1));
+                if (const LeafType* leaf = src_tree.probeConstLeaf(origin)) {
+                    if (bbox.isInside(block)) {
+                        dst_tree.addLeaf(new LeafType(*leaf));
+                        continue;
+                    }
+                    LeafType* dst_leaf = dst_tree.touchLeaf(origin);
+                    for (auto it = leaf->cbeginValueAll(); it; ++it) {
+                        const openvdb::Coord ijk = it.getCoord();
+                        if (!bbox.isInside(ijk)) continue;
+                        if (it.isValueOn()) {
+                            dst_leaf->setValueOn(ijk, *it);
+                        } else if (*it != background) {
+                            dst_leaf->setValueOff(ijk, *it);
+                        }
+                    }
+                } else {
+                    // The block lies in a tile or in the background: fill it with a constant.
+                    GridScalar value;
+                    const bool active = src_tree.probeValue(origin, value);
+                    if (active || value != background) {
+                        block.intersect(bbox);
+                        dst_tree.fill(block, value, active);
+                    }
+                }
+            }
+        }
+    }
+    return region;
+}
+
+///
+/// Meshes a single block of the input grid. Only facets whose centroid rounds to a voxel inside
+/// the block are kept. Since facet geometry only depends on nearby voxel values, adjacent blocks
+/// agree on which one owns each facet.
+///
+template <typename MeshType, typename GridScalar>
+auto mesh_grid_tile(
+    const Grid<GridScalar>& grid,
+    const openvdb::CoordBBox& tile,
+    const VolumeToMeshTiledOptions& options)
+    -> SurfaceMesh<typename MeshType::Scalar, typename MeshType::Index>
+{
+    using Index = typename MeshType::Index;
+
+    openvdb::CoordBBox region = tile;
+    region.expand(s_tile_margin);
+    auto tile_grid = copy_grid_region(grid, region);
+
+    VolumeToMeshOptions tile_options = options;
+    tile_options.adaptivity = 0;
+    tile_options.normal_attribute_name = "";
+    auto mesh = volume_to_mesh<MeshType>(*tile_grid, tile_options);
+
+    const auto& transform = grid.transform();
+    auto vertices = vertex_view(mesh);
+    mesh.remove_facets([&](Index f) {
+        openvdb::Vec3d centroid(0, 0, 0);
+        const auto facet = mesh.get_facet_vertices(f);
+        for (Index v : facet) {
+            centroid += openvdb::Vec3d(vertices(v, 0), vertices(v, 1), vertices(v, 2));
+        }
+        centroid /= static_cast<double>(facet.size());
+        const openvdb::Coord owner = openvdb::Coord::round(transform.worldToIndex(centroid));
+        return !tile.isInside(owner);
+    });
+
+    std::vector<bool> is_used(mesh.get_num_vertices(), false);
+    for (Index v : mesh.get_corner_to_vertex().get_all()) {
+        is_used[v] = true;
+    }
+    mesh.remove_vertices([&](Index v) { return !is_used[v]; });
+
+    if (!options.normal_attribute_name.empty() && mesh.get_num_facets() > 0) {
+        sample_vertex_normal(mesh, *tile_grid, {options.normal_attribute_name});
+    }
+
+    return mesh;
+}
+
+} // namespace
+
+template <typename MeshType, typename GridScalar>
+void volume_to_mesh_tiled(
+    const Grid<GridScalar>& grid,
+    function_ref<void(SurfaceMesh<typename MeshType::Scalar, typename MeshType::Index>&&)>
+        callback,
+    const VolumeToMeshTiledOptions& options)
+{
+    openvdb::initialize();
+
+    using Scalar = typename MeshType::Scalar;
+    using Index = typename MeshType::Index;
+    using LeafType = typename Grid<GridScalar>::TreeType::LeafNodeType;
+
+    la_runtime_assert(options.tile_size > 0, "Tile size must be positive");
+    if (options.adaptivity != 0) {
+        logger().warn("Adaptive meshing is not supported in tiled mode, ignoring adaptivity.");
+    }
+
+    // Round the tile size up to a multiple of the leaf size, so that each leaf node belongs to a
+    // single tile.
+    constexpr int leaf_dim = static_cast<int>(LeafType::DIM);
+    const int tile_size = (options.tile_size + leaf_dim - 1) / leaf_dim * leaf_dim;
+
+    // Collect non-empty tiles from the leaf nodes of the grid.
+    auto tile_of = [&](int x) { return (x >= 0 ? x : x - tile_size + 1) / tile_size; };
+    std::vector<openvdb::Coord> tiles;
+    for (auto leaf = grid.tree().cbeginLeaf(); leaf; ++leaf) {
+        const openvdb::Coord origin = leaf->origin();
+        tiles.emplace_back(tile_of(origin[0]), tile_of(origin[1]), tile_of(origin[2]));
+    }
+    std::sort(tiles.begin(), tiles.end());
+    tiles.erase(std::unique(tiles.begin(), tiles.end()), tiles.end());
+    logger().debug("Meshing {} tiles of size {}", tiles.size(), tile_size);
+
+    const size_t chunk_size =
+        options.max_concurrent_tiles > 0
+            ? options.max_concurrent_tiles
+            : static_cast<size_t>(tbb::this_task_arena::max_concurrency());
+
+    std::vector<std::optional<SurfaceMesh<Scalar, Index>>> blocks;
+    for (size_t chunk_begin = 0; chunk_begin < tiles.size(); chunk_begin += chunk_size) {
+        const size_t chunk_end = std::min(chunk_begin + chunk_size, tiles.size());
+        blocks.clear();
+        blocks.resize(chunk_end - chunk_begin);
+        tbb::parallel_for(chunk_begin, chunk_end, [&](size_t t) {
+            const openvdb::Coord min(
+                tiles[t][0] * tile_size,
+                tiles[t][1] * tile_size,
+                tiles[t][2] * tile_size);
+            const openvdb::CoordBBox tile(min, min.offsetBy(tile_size - 1));
+            blocks[t - chunk_begin] = mesh_grid_tile<MeshType>(grid, tile, options);
+        });
+        for (auto& block : blocks) {
+            if (block->get_num_facets() > 0) {
+                callback(std::move(*block));
+            }
+            block.reset();
+        }
+    }
+}
+
+template <typename MeshType, typename GridScalar>
+auto volume_to_mesh_tiled(const Grid<GridScalar>& grid, const VolumeToMeshTiledOptions& options)
+    -> SurfaceMesh<typename MeshType::Scalar, typename MeshType::Index>
+{
+    using Scalar = typename MeshType::Scalar;
+    using Index = typename MeshType::Index;
+    using Position = std::array<Scalar, 3>;
+
+    struct PositionHash
+    {
+        size_t operator()(const Position& p) const
+        {
+            size_t h = std::hash<Scalar>{}(p[0]);
+            hash_combine(h, p[1]);
+            hash_combine(h, p[2]);
+            return h;
+        }
+    };
+
+    const bool with_normals = !options.normal_attribute_name.empty();
+    std::unordered_map<Position, Index, PositionHash> vertex_map;
+    std::vector<Scalar> positions;
+    std::vector<Scalar> normals;
+    std::vector<Index> facet_sizes;
+    std::vector<Index> facet_indices;
+
+    // Blocks are stitched by merging vertices with identical positions.
+    volume_to_mesh_tiled<MeshType>(
+        grid,
+        [&](SurfaceMesh<Scalar, Index>&& block) {
+            auto block_vertices = vertex_view(block);
+            std::vector<Index> block_to_mesh(block.get_num_vertices());
+            for (Index v = 0; v < block.get_num_vertices(); ++v) {
+                const Position p = {
+                    block_vertices(v, 0),
+                    block_vertices(v, 1),
+                    block_vertices(v, 2)};
+                auto [it, inserted] =
+                    vertex_map.try_emplace(p, static_cast<Index>(positions.size() / 3));
+                if (inserted) {
+                    positions.insert(positions.end(), p.begin(), p.end());
+                    if (with_normals) {
+                        auto n = block.template get_attribute<Scalar>(options.normal_attribute_name)
+                                     .get_row(v);
+                        normals.insert(normals.end(), n.begin(), n.end());
+                    }
+                }
+                block_to_mesh[v] = it->second;
+            }
+            for (Index f = 0; f < block.get_num_facets(); ++f) {
+                const auto facet = block.get_facet_vertices(f);
+                facet_sizes.push_back(static_cast<Index>(facet.size()));
+                for (Index v : facet) {
+                    facet_indices.push_back(block_to_mesh[v]);
+                }
+            }
+        },
+        options);
+
+    SurfaceMesh<Scalar, Index> mesh;
+    mesh.add_vertices(static_cast<Index>(positions.size() / 3), positions);
+    mesh.add_hybrid(facet_sizes, facet_indices);
+    if (with_normals) {
+        mesh.template create_attribute<Scalar>(
+            options.normal_attribute_name,
+            AttributeElement::Vertex,
+            AttributeUsage::Normal,
+            3,
+            normals);
+    }
+    return mesh;
+}
+
 #define LA_X_volume_to_mesh(GridScalar, Scalar, Index)                              \
     template SurfaceMesh<Scalar, Index> volume_to_mesh<SurfaceMesh<Scalar, Index>>( \
         const Grid<GridScalar>& grid,                                               \
@@ -93,4 +355,16 @@ auto volume_to_mesh(const Grid<GridScalar>& grid, const VolumeToMeshOptions& opt
 #define LA_X_volume_to_mesh_aux(_, GridScalar) LA_SURFACE_MESH_X(volume_to_mesh, GridScalar)
 LA_VOLUME_GRID_X(volume_to_mesh_aux, 0)
 
+#define LA_X_volume_to_mesh_tiled(GridScalar, Scalar, Index)                                 \
+    template void volume_to_mesh_tiled<SurfaceMesh<Scalar, Index>>(                         \
+        const Grid<GridScalar>& grid,                                                       \
+        function_ref<void(SurfaceMesh<Scalar, Index>&&)> callback,                          \
+        const VolumeToMeshTiledOptions& options);                                           \
+    template SurfaceMesh<Scalar, Index> volume_to_mesh_tiled<SurfaceMesh<Scalar, Index>>( \
+        const Grid<GridScalar>& grid,                                                       \
+        const VolumeToMeshTiledOptions& options);
+#define LA_X_volume_to_mesh_tiled_aux(_, GridScalar) \
+    LA_SURFACE_MESH_X(volume_to_mesh_tiled, GridScalar)
+LA_VOLUME_GRID_X(volume_to_mesh_tiled_aux, 0)
+
 } // namespace lagrange::volume
@@ -0,0 +1,82 @@
+/*
+ * Copyright 2025 Adobe. All rights reserved.
+ * This file is licensed to you under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License. You may obtain a copy
+ * of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR REPRESENTATIONS
+ * OF ANY KIND, either express or implied. See the License for the specific language
+ * governing permissions and limitations under the License.
+ */
+#include <lagrange/volume/volumetric_boolean.h>
+
+#include <lagrange/Logger.h>
+#include <lagrange/SurfaceMeshTypes.h>
+#include <lagrange/mesh_bbox.h>
+#include <lagrange/utils/assert.h>
+#include <lagrange/volume/GridTypes.h>
+
+// clang-format off
+#include <lagrange/utils/warnoff.h>
+#include <tbb/parallel_for.h>
+#include <lagrange/utils/warnon.h>
+// clang-format on
+
+#include <vector>
+
+namespace lagrange::volume {
+
+template <typename Scalar, typename Index>
+auto volumetric_boolean(
+    span<const SurfaceMesh<Scalar, Index>* const> meshes,
+    const VolumetricBooleanOptions& options) -> SurfaceMesh<Scalar, Index>
+{
+    using GridType = Grid<float>;
+    la_runtime_assert(!meshes.empty(), "At least one input mesh is required");
+
+    // All inputs must be voxelized with the same transform, so a relative voxel size is resolved
+    // once against the bbox of all meshes.
+    MeshToVolumeOptions m2v_options = options.mesh_to_volume;
+    if (m2v_options.voxel_size < 0) {
+        Eigen::AlignedBox<Scalar, 3> bbox;
+        for (const auto* mesh : meshes) {
+            la_runtime_assert(mesh != nullptr, "Input mesh is null");
+            bbox.extend(mesh_bbox<3>(*mesh));
+        }
+        const double diag = static_cast<double>(bbox.diagonal().norm());
+        logger().debug(
+            "Using a relative voxel size of {:.3f} x {:.3f} = {:.3f}",
+            std::abs(m2v_options.voxel_size),
+            diag,
+            std::abs(m2v_options.voxel_size) * diag);
+        m2v_options.voxel_size = std::abs(m2v_options.voxel_size) * diag;
+    }
+
+    std::vector<GridType::Ptr> grids(meshes.size());
+    tbb::parallel_for(size_t(0), meshes.size(), [&](size_t i) {
+        grids[i] = mesh_to_volume<float>(*meshes[i], m2v_options);
+    });
+
+    std::vector<const GridType*> grid_ptrs;
+    grid_ptrs.reserve(grids.size());
+    for (const auto& grid : grids) {
+        grid_ptrs.push_back(grid.get());
+    }
+    auto result = grid_boolean<float>(grid_ptrs, options.operation);
+    grids.clear();
+
+    if (options.morphology.has_value()) {
+        result = apply_grid_morphology(*result, options.morphology.value());
+    }
+
+    return volume_to_mesh<SurfaceMesh<Scalar, Index>>(*result, options.volume_to_mesh);
+}
+
+#define LA_X_volumetric_boolean(_, Scalar, Index)                          \
+    template SurfaceMesh<Scalar, Index> volumetric_boolean<Scalar, Index>( \
+        span<const SurfaceMesh<Scalar, Index>* const> meshes,              \
+        const VolumetricBooleanOptions& options);
+LA_SURFACE_MESH_X(volumetric_boolean, 0)
+
+} // namespace lagrange::volume
@@ -10,10 +10,14 @@
  * governing permissions and limitations under the License.
  */
 #include <lagrange/create_mesh.h>
+#include <lagrange/mesh_convert.h>
 #include <lagrange/testing/common.h>
 #include <lagrange/volume/fill_with_spheres.h>
 #include <lagrange/volume/mesh_to_volume.h>
 
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_approx.hpp>
+
 TEST_CASE("fill_with_spheres: reproducibility", "[volume]")
 {
     auto mesh = lagrange::create_cube();
@@ -27,3 +31,110 @@ TEST_CASE("fill_with_spheres: reproducibility", "[volume]")
     REQUIRE(spheres1.rows() <= max_spheres);
     REQUIRE(spheres1 == spheres2);
 }
+
+namespace {
+
+using FillScalar = float;
+using FillIndex = uint32_t;
+
+auto make_sphere_grid(double voxel_size)
+{
+    auto mesh =
+        lagrange::to_surface_mesh_copy<FillScalar, FillIndex>(*lagrange::create_sphere());
+    lagrange::volume::MeshToVolumeOptions m2v_opt;
+    m2v_opt.voxel_size = voxel_size;
+    return lagrange::volume::mesh_to_volume(mesh, m2v_opt);
+}
+
+} // namespace
+
+TEST_CASE("fill_with_spheres: options", "[volume]")
+{
+    const double voxel_size = 0.05;
+    auto grid = make_sphere_grid(voxel_size);
+    lagrange::volume::FillWithSpheresOptions opt;
+
+    SECTION("single sphere")
+    {
+        opt.max_spheres = 1;
+        auto spheres = lagrange::volume::fill_with_spheres(*grid, opt);
+        REQUIRE(spheres.rows() == 1);
+        REQUIRE(spheres.row(0).head<3>().norm() < 3 * voxel_size);
+        REQUIRE(spheres(0, 3) == Catch::Approx(1).margin(3 * voxel_size));
+    }
+
+    SECTION("non overlapping")
+    {
+        opt.max_spheres = 100;
+        auto spheres = lagrange::volume::fill_with_spheres(*grid, opt);
+        REQUIRE(spheres.rows() == 100);
+        for (Eigen::Index i = 0; i < spheres.rows(); ++i) {
+            // Spheres must stay inside the unit sphere (up to discretization errors).
+            REQUIRE(spheres.row(i).head<3>().norm() + spheres(i, 3) < 1 + 2 * voxel_size);
+            for (Eigen::Index j = i + 1; j < spheres.rows(); ++j) {
+                const float d = (spheres.row(i).head<3>() - spheres.row(j).head<3>()).norm();
+                REQUIRE(d >= spheres(i, 3) + spheres(j, 3) - 1e-5f);
+            }
+        }
+        REQUIRE(spheres == lagrange::volume::fill_with_spheres(*grid, opt));
+    }
+
+    SECTION("overlapping")
+    {
+        opt.max_spheres = 20;
+        opt.overlapping = true;
+        auto spheres = lagrange::volume::fill_with_spheres(*grid, opt);
+        REQUIRE(spheres.rows() == 20);
+        for (Eigen::Index i = 0; i < spheres.rows(); ++i) {
+            REQUIRE(spheres.row(i).head<3>().norm() + spheres(i, 3) < 1 + 2 * voxel_size);
+        }
+    }
+
+    SECTION("error budget")
+    {
+        opt.max_spheres = 10000;
+        opt.max_error = 4;
+        auto spheres = lagrange::volume::fill_with_spheres(*grid, opt);
+        REQUIRE(spheres.rows() > 1);
+        REQUIRE(spheres.rows() < 10000);
+        REQUIRE(spheres.col(3).minCoeff() >= opt.max_error * voxel_size);
+    }
+}
+
+TEST_CASE("fill_with_spheres: benchmark", "[volume][!benchmark]")
+{
+    for (double voxel_size : {0.04, 0.02, 0.01}) {
+        auto grid = make_sphere_grid(voxel_size);
+        const auto num_voxels = grid->activeVoxelCount();
+
+        BENCHMARK(fmt::format("openvdb ({} voxels)", num_voxels))
+        {
+            Eigen::MatrixXf spheres;
+            lagrange::volume::fill_with_spheres(*grid, spheres, 200);
+            return spheres;
+        };
+
+        BENCHMARK(fmt::format("lagrange ({} voxels)", num_voxels))
+        {
+            lagrange::volume::FillWithSpheresOptions opt;
+            opt.max_spheres = 200;
+            return lagrange::volume::fill_with_spheres(*grid, opt);
+        };
+    }
+
+    auto mesh = lagrange::testing::load_surface_mesh<FillScalar, FillIndex>(
+        "open/core/dragon.obj");
+    auto grid = lagrange::volume::mesh_to_volume(mesh);
+    BENCHMARK("openvdb (dragon)")
+    {
+        Eigen::MatrixXf spheres;
+        lagrange::volume::fill_with_spheres(*grid, spheres, 200);
+        return spheres;
+    };
+    BENCHMARK("lagrange (dragon)")
+    {
+        lagrange::volume::FillWithSpheresOptions opt;
+        opt.max_spheres = 200;
+        return lagrange::volume::fill_with_spheres(*grid, opt);
+    };
+}
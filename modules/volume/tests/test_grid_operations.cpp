@@ -0,0 +1,168 @@
+/*
+ * Copyright 2025 Adobe. All rights reserved.
+ * This file is licensed to you under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License. You may obtain a copy
+ * of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR REPRESENTATIONS
+ * OF ANY KIND, either express or implied. See the License for the specific language
+ * governing permissions and limitations under the License.
+ */
+#include <lagrange/create_mesh.h>
+#include <lagrange/mesh_bbox.h>
+#include <lagrange/mesh_convert.h>
+#include <lagrange/testing/common.h>
+#include <lagrange/topology.h>
+#include <lagrange/transform_mesh.h>
+#include <lagrange/volume/grid_boolean.h>
+#include <lagrange/volume/grid_morphology.h>
+#include <lagrange/volume/mesh_to_volume.h>
+#include <lagrange/volume/volumetric_boolean.h>
+
+#include <catch2/catch_approx.hpp>
+
+namespace {
+
+using Scalar = float;
+using Index = uint32_t;
+using SurfaceMeshType = lagrange::SurfaceMesh<Scalar, Index>;
+
+SurfaceMeshType make_sphere(Scalar offset_x)
+{
+    auto mesh = lagrange::to_surface_mesh_copy<Scalar, Index>(*lagrange::create_sphere());
+    Eigen::Transform<Scalar, 3, Eigen::Affine> transform(
+        Eigen::Translation<Scalar, 3>(offset_x, 0, 0));
+    lagrange::transform_mesh(mesh, transform);
+    return mesh;
+}
+
+Scalar bbox_width(const SurfaceMeshType& mesh)
+{
+    auto bbox = lagrange::mesh_bbox<3>(mesh);
+    return bbox.max().x() - bbox.min().x();
+}
+
+} // namespace
+
+TEST_CASE("grid_morphology", "[volume]")
+{
+    auto mesh = make_sphere(0);
+    lagrange::volume::MeshToVolumeOptions m2v_opt;
+    m2v_opt.voxel_size = 0.05;
+    auto grid = lagrange::volume::mesh_to_volume(mesh, m2v_opt);
+    const Scalar width = bbox_width(lagrange::volume::volume_to_mesh<SurfaceMeshType>(*grid));
+
+    lagrange::volume::GridMorphologyOptions opt;
+    opt.relative = false;
+    opt.radius = 0.2;
+
+    SECTION("dilate")
+    {
+        opt.operation = lagrange::volume::MorphologyOperation::Dilate;
+        auto result = lagrange::volume::apply_grid_morphology(*grid, opt);
+        REQUIRE(result->getGridClass() == openvdb::GRID_LEVEL_SET);
+        auto out = lagrange::volume::volume_to_mesh<SurfaceMeshType>(*result);
+        REQUIRE(bbox_width(out) == Catch::Approx(width + 0.4).margin(0.1));
+    }
+
+    SECTION("erode")
+    {
+        opt.operation = lagrange::volume::MorphologyOperation::Erode;
+        auto result = lagrange::volume::apply_grid_morphology(*grid, opt);
+        auto out = lagrange::volume::volume_to_mesh<SurfaceMeshType>(*result);
+        REQUIRE(bbox_width(out) == Catch::Approx(width - 0.4).margin(0.1));
+    }
+
+    SECTION("close")
+    {
+        // A convex shape is left unchanged by a closing.
+        opt.operation = lagrange::volume::MorphologyOperation::Close;
+        auto result = lagrange::volume::apply_grid_morphology(*grid, opt);
+        auto out = lagrange::volume::volume_to_mesh<SurfaceMeshType>(*result);
+        REQUIRE(bbox_width(out) == Catch::Approx(width).margin(0.1));
+    }
+
+    SECTION("unsigned")
+    {
+        m2v_opt.signing_method = lagrange::volume::MeshToVolumeOptions::Sign::Unsigned;
+        auto udf = lagrange::volume::mesh_to_volume(mesh, m2v_opt);
+        LA_REQUIRE_THROWS(lagrange::volume::apply_grid_morphology(*udf, opt));
+    }
+}
+
+TEST_CASE("grid_boolean", "[volume]")
+{
+    lagrange::volume::MeshToVolumeOptions m2v_opt;
+    m2v_opt.voxel_size = 0.05;
+    auto grid_a = lagrange::volume::mesh_to_volume(make_sphere(0), m2v_opt);
+    auto grid_b = lagrange::volume::mesh_to_volume(make_sphere(1), m2v_opt);
+    auto grid_c = lagrange::volume::mesh_to_volume(make_sphere(2), m2v_opt);
+    std::vector<const lagrange::volume::Grid<float>*> grids = {
+        grid_a.get(),
+        grid_b.get(),
+        grid_c.get()};
+
+    auto mesh_a = lagrange::volume::volume_to_mesh<SurfaceMeshType>(*grid_a);
+    const Scalar width = bbox_width(mesh_a);
+
+    SECTION("union")
+    {
+        auto result = lagrange::volume::grid_boolean<float>(
+            grids,
+            lagrange::volume::BooleanOperation::Union);
+        auto out = lagrange::volume::volume_to_mesh<SurfaceMeshType>(*result);
+        REQUIRE(bbox_width(out) == Catch::Approx(width + 2).margin(0.1));
+        REQUIRE(lagrange::compute_euler(out) == 2);
+    }
+
+    SECTION("intersection")
+    {
+        grids.pop_back();
+        auto result = lagrange::volume::grid_boolean<float>(
+            grids,
+            lagrange::volume::BooleanOperation::Intersection);
+        auto out = lagrange::volume::volume_to_mesh<SurfaceMeshType>(*result);
+        REQUIRE(bbox_width(out) == Catch::Approx(width - 1).margin(0.1));
+    }
+
+    SECTION("difference")
+    {
+        grids.pop_back();
+        auto result = lagrange::volume::grid_boolean<float>(
+            grids,
+            lagrange::volume::BooleanOperation::Difference);
+        auto out = lagrange::volume::volume_to_mesh<SurfaceMeshType>(*result);
+        REQUIRE(bbox_width(out) == Catch::Approx(width - 1).margin(0.1));
+        REQUIRE(lagrange::is_closed(out));
+    }
+
+    SECTION("single input")
+    {
+        grids.resize(1);
+        auto result = lagrange::volume::grid_boolean<float>(
+            grids,
+            lagrange::volume::BooleanOperation::Union);
+        REQUIRE(result.get() != grid_a.get());
+        REQUIRE(result->activeVoxelCount() == grid_a->activeVoxelCount());
+    }
+}
+
+TEST_CASE("volumetric_boolean", "[volume]")
+{
+    auto mesh_a = make_sphere(0);
+    auto mesh_b = make_sphere(1);
+    std::vector<const SurfaceMeshType*> meshes = {&mesh_a, &mesh_b};
+
+    lagrange::volume::VolumetricBooleanOptions opt;
+    opt.mesh_to_volume.voxel_size = 0.05;
+    auto out = lagrange::volume::volumetric_boolean<Scalar, Index>(meshes, opt);
+    REQUIRE(out.get_num_facets() > 0);
+    REQUIRE(bbox_width(out) == Catch::Approx(3).margin(0.1));
+    REQUIRE(lagrange::compute_euler(out) == 2);
+
+    opt.morphology = lagrange::volume::GridMorphologyOptions{};
+    opt.morphology->radius = 2;
+    auto thick = lagrange::volume::volumetric_boolean<Scalar, Index>(meshes, opt);
+    REQUIRE(bbox_width(thick) == Catch::Approx(3.2).margin(0.1));
+}
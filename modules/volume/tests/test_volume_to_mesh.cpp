@@ -16,6 +16,7 @@
 #include <lagrange/mesh_convert.h>
 #include <lagrange/testing/common.h>
 #include <lagrange/testing/create_test_mesh.h>
+#include <lagrange/topology.h>
 #include <lagrange/views.h>
 #include <lagrange/volume/mesh_to_volume.h>
 #include <lagrange/volume/volume_to_mesh.h>
@@ -71,3 +72,46 @@ TEST_CASE("volume_to_mesh", "[volume]")
         }
     }
 }
+
+TEST_CASE("volume_to_mesh_tiled", "[volume]")
+{
+    using Scalar = float;
+    using Index = uint32_t;
+    using SurfaceMeshType = lagrange::SurfaceMesh<Scalar, Index>;
+    auto mesh_in = lagrange::to_surface_mesh_copy<Scalar, Index>(*lagrange::create_sphere(3));
+    lagrange::volume::MeshToVolumeOptions m2v_opt;
+    m2v_opt.voxel_size = 0.05;
+    auto grid = lagrange::volume::mesh_to_volume(mesh_in, m2v_opt);
+
+    lagrange::volume::VolumeToMeshTiledOptions v2m_opt;
+    v2m_opt.tile_size = 8;
+    auto mesh_ref = lagrange::volume::volume_to_mesh<SurfaceMeshType>(*grid, v2m_opt);
+
+    SECTION("callback")
+    {
+        size_t num_blocks = 0;
+        Index num_facets = 0;
+        lagrange::volume::volume_to_mesh_tiled<SurfaceMeshType>(
+            *grid,
+            [&](SurfaceMeshType&& block) {
+                REQUIRE(block.get_num_facets() > 0);
+                num_facets += block.get_num_facets();
+                ++num_blocks;
+            },
+            v2m_opt);
+        REQUIRE(num_blocks > 1);
+        REQUIRE(num_facets == mesh_ref.get_num_facets());
+    }
+
+    SECTION("stitched")
+    {
+        v2m_opt.max_concurrent_tiles = 3;
+        v2m_opt.normal_attribute_name = "normal";
+        auto mesh_out = lagrange::volume::volume_to_mesh_tiled<SurfaceMeshType>(*grid, v2m_opt);
+        REQUIRE(mesh_out.get_num_vertices() == mesh_ref.get_num_vertices());
+        REQUIRE(mesh_out.get_num_facets() == mesh_ref.get_num_facets());
+        REQUIRE(lagrange::compute_euler(mesh_out) == lagrange::compute_euler(mesh_ref));
+        REQUIRE(lagrange::is_closed(mesh_out));
+        REQUIRE(mesh_out.has_attribute("normal"));
+    }
+}
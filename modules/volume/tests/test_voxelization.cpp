@@ -70,6 +70,29 @@ TEST_CASE("voxelization: winding number", "[volume]")
     REQUIRE(mesh3.get_num_facets() > mesh2.get_num_facets());
 }
 
+TEST_CASE("voxelization: winding number sign", "[volume]")
+{
+    using Scalar = float;
+    using Index = uint32_t;
+    auto mesh = lagrange::to_surface_mesh_copy<Scalar, Index>(*lagrange::create_sphere());
+    lagrange::volume::MeshToVolumeOptions m2v_opt;
+    m2v_opt.voxel_size = 0.05;
+    m2v_opt.signing_method = lagrange::volume::MeshToVolumeOptions::Sign::WindingNumber;
+    auto grid = lagrange::volume::mesh_to_volume(mesh, m2v_opt);
+    REQUIRE(grid->getGridClass() == openvdb::GRID_LEVEL_SET);
+
+    // Interior values away from the narrow band must be negative, exterior values positive.
+    auto accessor = grid->getConstAccessor();
+    auto value_at = [&](double x, double y, double z) {
+        return accessor.getValue(grid->transform().worldToIndexNodeCentered({x, y, z}));
+    };
+    REQUIRE(value_at(0, 0, 0) < 0);
+    REQUIRE(value_at(0.5, 0, 0) < 0);
+    REQUIRE(value_at(0.9, 0, 0) < 0);
+    REQUIRE(value_at(1.1, 0, 0) > 0);
+    REQUIRE(value_at(2, 0, 0) > 0);
+}
+
 TEST_CASE("mesh_to_volume: polygonal mesh", "[volume]")
 {
     using Scalar = float;
@@ -0,0 +1,167 @@
+/*
+ * Copyright 2025 Adobe. All rights reserved.
+ * This file is licensed to you under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License. You may obtain a copy
+ * of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR REPRESENTATIONS
+ * OF ANY KIND, either express or implied. See the License for the specific language
+ * governing permissions and limitations under the License.
+ */
+
+#pragma once
+
+#include <lagrange/SurfaceMesh.h>
+#include <lagrange/utils/span.h>
+
+#include <array>
+#include <string_view>
+
+namespace lagrange {
+
+namespace winding {
+
+///
+/// Options for building a point cloud winding number acceleration structure.
+///
+struct PointCloudWindingNumberOptions
+{
+    /// Input normal attribute name. If empty, uses the first vertex attribute with usage `Normal`.
+    /// Normals are expected to point outward.
+    std::string_view input_normals;
+
+    /// Optional per-point area attribute name (vertex attribute with 1 channel). If empty, the area
+    /// of each point is estimated from the principal components of its nearest neighbors.
+    std::string_view input_areas;
+
+    /// Number of nearest neighbors used to estimate per-point areas.
+    size_t num_neighbors = 16;
+
+    /// Maximum number of points stored in a leaf of the hierarchy.
+    size_t leaf_size = 16;
+
+    /// Far-field accuracy parameter. A node is approximated by its dipole when the query point is
+    /// farther than `accuracy_scale` times the node radius. Larger values are more accurate but
+    /// slower.
+    float accuracy_scale = 2.f;
+};
+
+///
+/// Fast winding number computation for oriented point clouds. Each point is treated as a dipole
+/// weighted by its area, and distant clusters of points are aggregated in a hierarchy, following
+/// "Fast Winding Numbers for Soups and Clouds" by Barill et al. (2018).
+///
+class PointCloudWindingNumber
+{
+public:
+    ///
+    /// Constructs an acceleration structure on a given point cloud to speed up winding number
+    /// queries. Facets of the input mesh, if any, are ignored.
+    ///
+    /// @note       Internally, point coordinates, normals and areas are converted to `float`.
+    ///
+    /// @param[in]  points   Point cloud with a per-vertex normal attribute.
+    /// @param[in]  options  Construction options.
+    ///
+    /// @tparam     Scalar   Mesh scalar type.
+    /// @tparam     Index    Mesh index type.
+    ///
+    template <typename Scalar, typename Index>
+    PointCloudWindingNumber(
+        const SurfaceMesh<Scalar, Index>& points,
+        const PointCloudWindingNumberOptions& options = {});
+
+    ///
+    /// Constructs a new instance.
+    ///
+    PointCloudWindingNumber();
+
+    ///
+    /// Destroys the object.
+    ///
+    ~PointCloudWindingNumber();
+
+    ///
+    /// Constructs a new instance.
+    ///
+    /// @param      other  Instance to move from.
+    ///
+    PointCloudWindingNumber(PointCloudWindingNumber&& other) noexcept;
+
+    ///
+    /// Assignment operator.
+    ///
+    /// @param      other  Instance to move from.
+    ///
+    /// @return     The result of the assignment.
+    ///
+    PointCloudWindingNumber& operator=(PointCloudWindingNumber&& other) noexcept;
+
+    ///
+    /// Constructs a new instance.
+    ///
+    /// @param[in]  other  Instance to copy from.
+    ///
+    PointCloudWindingNumber(const PointCloudWindingNumber& other) = delete;
+
+    ///
+    /// Assignment operator.
+    ///
+    /// @param[in]  other  Instance to copy from.
+    ///
+    /// @return     The result of the assignment.
+    ///
+    PointCloudWindingNumber& operator=(const PointCloudWindingNumber& other) = delete;
+
+    ///
+    /// Determines whether the specified query point is inside the volume.
+    ///
+    /// @param[in]  pos   Query position.
+    ///
+    /// @return     True if the specified point is inside, False otherwise.
+    ///
+    bool is_inside(const std::array<float, 3>& pos) const;
+
+    ///
+    /// Computes the generalized winding number at the query point.
+    ///
+    /// @param[in]  pos   Query position.
+    ///
+    /// @return     Winding number at the query point (close to 1 inside, 0 outside).
+    ///
+    float winding_number(const std::array<float, 3>& pos) const;
+
+    ///
+    /// Computes the winding numbers of a batch of query points in parallel.
+    ///
+    /// @param[in]  positions  Flattened query positions (x0, y0, z0, x1, ...).
+    /// @param[out] out        Output winding numbers, one per query point.
+    ///
+    void batch_winding_number(span<const float> positions, span<float> out) const;
+
+    ///
+    /// Determines in parallel whether a batch of query points are inside the volume.
+    ///
+    /// @param[in]  positions  Flattened query positions (x0, y0, z0, x1, ...).
+    /// @param[out] out        Output flags, 1 if the point is inside, 0 otherwise.
+    ///
+    void batch_is_inside(span<const float> positions, span<uint8_t> out) const;
+
+    ///
+    /// Gets the per-point areas used by the engine, in the order of the input vertices.
+    ///
+    /// @return     Area of each input point.
+    ///
+    span<const float> get_point_areas() const;
+
+protected:
+    /// Internal implementation.
+    struct Impl;
+
+    /// PIMPL to hide internal data structures.
+    value_ptr<Impl> m_impl;
+};
+
+} // namespace winding
+} // namespace lagrange
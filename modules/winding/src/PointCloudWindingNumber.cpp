@@ -0,0 +1,425 @@
+/*
+ * Copyright 2025 Adobe. All rights reserved.
+ * This file is licensed to you under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License. You may obtain a copy
+ * of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR REPRESENTATIONS
+ * OF ANY KIND, either express or implied. See the License for the specific language
+ * governing permissions and limitations under the License.
+ */
+
+#include <lagrange/Attribute.h>
+#include <lagrange/SurfaceMeshTypes.h>
+#include <lagrange/compute_pointcloud_pca.h>
+#include <lagrange/internal/constants.h>
+#include <lagrange/internal/find_attribute_utils.h>
+#include <lagrange/utils/assert.h>
+#include <lagrange/utils/safe_cast.h>
+#include <lagrange/winding/PointCloudWindingNumber.h>
+
+// clang-format off
+#include <lagrange/utils/warnoff.h>
+#include <tbb/blocked_range.h>
+#include <tbb/enumerable_thread_specific.h>
+#include <tbb/parallel_for.h>
+#include <lagrange/utils/warnon.h>
+// clang-format on
+
+#include <Eigen/Geometry>
+
+#include <algorithm>
+#include <numeric>
+#include <queue>
+#include <vector>
+
+namespace lagrange {
+
+namespace winding {
+
+struct PointCloudWindingNumber::Impl
+{
+public:
+    using Vector = Eigen::Vector3f;
+    using Box = Eigen::AlignedBox3f;
+
+    struct Node
+    {
+        Box bbox;
+        Vector center = Vector::Zero(); ///< Area-weighted centroid of the points in the node.
+        Vector dipole = Vector::Zero(); ///< Sum of area-weighted normals in the node.
+        float radius = 0; ///< Radius of the ball centered at `center` enclosing the node points.
+        uint32_t begin = 0;
+        uint32_t end = 0;
+        int32_t left = -1;
+        int32_t right = -1;
+
+        bool is_leaf() const { return left < 0; }
+    };
+
+public:
+    void initialize(
+        std::vector<Vector> points,
+        std::vector<Vector> normals,
+        std::vector<float> areas,
+        const PointCloudWindingNumberOptions& options)
+    {
+        la_runtime_assert(options.leaf_size > 0, "Leaf size must be positive");
+        la_runtime_assert(options.accuracy_scale > 0.f, "Accuracy scale must be positive");
+
+        m_accuracy_scale = options.accuracy_scale;
+        m_points = std::move(points);
+        const size_t num_points = m_points.size();
+
+        m_order.resize(num_points);
+        std::iota(m_order.begin(), m_order.end(), 0u);
+        m_nodes.clear();
+        if (num_points == 0) {
+            return;
+        }
+        build_node(0, safe_cast<uint32_t>(num_points), options.leaf_size);
+
+        // Put points in tree order so that leaves are contiguous in memory.
+        {
+            std::vector<Vector> sorted(num_points);
+            for (size_t i = 0; i < num_points; ++i) {
+                sorted[i] = m_points[m_order[i]];
+            }
+            m_points.swap(sorted);
+        }
+
+        if (areas.empty()) {
+            areas = estimate_areas(normals, options.num_neighbors);
+        }
+        la_runtime_assert(areas.size() == num_points, "Number of areas doesn't match");
+        m_areas = std::move(areas);
+
+        m_area_normals.resize(num_points);
+        tbb::parallel_for(size_t(0), num_points, [&](size_t i) {
+            const uint32_t v = m_order[i];
+            m_area_normals[i] = m_areas[v] * normals[v].stableNormalized();
+        });
+
+        // Each node aggregates its own range directly, so nodes can be processed independently.
+        tbb::parallel_for(size_t(0), m_nodes.size(), [&](size_t n) { compute_moments(m_nodes[n]); });
+    }
+
+    float winding_number(const Vector& q) const
+    {
+        if (m_nodes.empty()) {
+            return 0.f;
+        }
+
+        const float beta2 = m_accuracy_scale * m_accuracy_scale;
+        float w = 0.f;
+
+        // The tree is balanced by construction, so its depth is logarithmic in the number of points.
+        std::array<int32_t, 128> stack;
+        size_t top = 0;
+        stack[top++] = 0;
+        while (top > 0) {
+            const Node& node = m_nodes[stack[--top]];
+            const Vector d = node.center - q;
+            const float dist2 = d.squaredNorm();
+            if (dist2 > beta2 * node.radius * node.radius) {
+                // Far field: approximate the whole cluster by a single dipole.
+                w += d.dot(node.dipole) / (dist2 * std::sqrt(dist2));
+            } else if (node.is_leaf()) {
+                for (uint32_t i = node.begin; i < node.end; ++i) {
+                    const Vector di = m_points[i] - q;
+                    const float r2 = di.squaredNorm();
+                    if (r2 > 0.f) {
+                        w += di.dot(m_area_normals[i]) / (r2 * std::sqrt(r2));
+                    }
+                }
+            } else {
+                la_debug_assert(top + 2 <= stack.size());
+                stack[top++] = node.left;
+                stack[top++] = node.right;
+            }
+        }
+        return w / (4.f * static_cast<float>(lagrange::internal::pi));
+    }
+
+    span<const float> get_point_areas() const { return m_areas; }
+
+protected:
+    int32_t build_node(uint32_t begin, uint32_t end, size_t leaf_size)
+    {
+        const int32_t id = safe_cast<int32_t>(m_nodes.size());
+        m_nodes.emplace_back();
+        Box bbox;
+        for (uint32_t i = begin; i < end; ++i) {
+            bbox.extend(m_points[m_order[i]]);
+        }
+        m_nodes[id].bbox = bbox;
+        m_nodes[id].begin = begin;
+        m_nodes[id].end = end;
+
+        if (end - begin <= leaf_size) {
+            return id;
+        }
+
+        // Median split along the longest axis of the node bounding box.
+        int axis = 0;
+        bbox.sizes().maxCoeff(&axis);
+        const uint32_t mid = begin + (end - begin) / 2;
+        std::nth_element(
+            m_order.begin() + begin,
+            m_order.begin() + mid,
+            m_order.begin() + end,
+            [&](uint32_t a, uint32_t b) { return m_points[a][axis] < m_points[b][axis]; });
+
+        const int32_t left = build_node(begin, mid, leaf_size);
+        const int32_t right = build_node(mid, end, leaf_size);
+        m_nodes[id].left = left;
+        m_nodes[id].right = right;
+        return id;
+    }
+
+    void compute_moments(Node& node) const
+    {
+        float total_area = 0.f;
+        Vector center = Vector::Zero();
+        Vector dipole = Vector::Zero();
+        for (uint32_t i = node.begin; i < node.end; ++i) {
+            const float a = m_areas[m_order[i]];
+            total_area += a;
+            center += a * m_points[i];
+            dipole += m_area_normals[i];
+        }
+        if (total_area > 0.f) {
+            center /= total_area;
+        } else {
+            center = node.bbox.center();
+        }
+
+        float radius2 = 0.f;
+        for (uint32_t i = node.begin; i < node.end; ++i) {
+            radius2 = std::max(radius2, (m_points[i] - center).squaredNorm());
+        }
+        node.center = center;
+        node.dipole = dipole;
+        node.radius = std::sqrt(radius2);
+    }
+
+    // Max-heap of (squared distance, sorted point index) holding the k nearest points found so far.
+    using NeighborHeap = std::priority_queue<std::pair<float, uint32_t>>;
+
+    void knn_search(const Vector& q, size_t k, int32_t node_id, NeighborHeap& heap) const
+    {
+        const Node& node = m_nodes[node_id];
+        if (heap.size() == k && node.bbox.squaredExteriorDistance(q) > heap.top().first) {
+            return;
+        }
+        if (node.is_leaf()) {
+            for (uint32_t i = node.begin; i < node.end; ++i) {
+                const float d2 = (m_points[i] - q).squaredNorm();
+                if (heap.size() < k) {
+                    heap.emplace(d2, i);
+                } else if (d2 < heap.top().first) {
+                    heap.pop();
+                    heap.emplace(d2, i);
+                }
+            }
+            return;
+        }
+
+        // Visit the closest child first to shrink the search radius early.
+        int32_t first = node.left;
+        int32_t second = node.right;
+        if (m_nodes[second].bbox.squaredExteriorDistance(q) <
+            m_nodes[first].bbox.squaredExteriorDistance(q)) {
+            std::swap(first, second);
+        }
+        knn_search(q, k, first, heap);
+        knn_search(q, k, second, heap);
+    }
+
+    ///
+    /// Estimates the area of each point from its k nearest neighbors: neighbors are projected onto
+    /// the tangent plane given by their principal components, and the disk containing them is
+    /// shared evenly among the neighbors.
+    ///
+    std::vector<float> estimate_areas(const std::vector<Vector>& normals, size_t num_neighbors) const
+    {
+        const size_t num_points = m_points.size();
+        const size_t k = std::min(std::max<size_t>(num_neighbors, 3), num_points);
+        std::vector<float> areas(num_points, 0.f);
+        if (k < 3) {
+            return areas;
+        }
+
+        struct Scratch
+        {
+            std::vector<float> coords;
+            std::vector<uint32_t> neighbors;
+        };
+        tbb::enumerable_thread_specific<Scratch> scratch;
+
+        tbb::parallel_for(
+            tbb::blocked_range<size_t>(0, num_points),
+            [&](const tbb::blocked_range<size_t>& range) {
+                auto& local = scratch.local();
+                for (size_t i = range.begin(); i != range.end(); ++i) {
+                    const Vector& p = m_points[i];
+                    NeighborHeap heap;
+                    knn_search(p, k, 0, heap);
+
+                    local.neighbors.clear();
+                    local.coords.clear();
+                    while (!heap.empty()) {
+                        const uint32_t j = heap.top().second;
+                        heap.pop();
+                        local.neighbors.push_back(j);
+                        local.coords.insert(
+                            local.coords.end(),
+                            m_points[j].data(),
+                            m_points[j].data() + 3);
+                    }
+
+                    // The eigenvector with the smallest eigenvalue approximates the normal.
+                    Vector n;
+                    ComputePointcloudPCAOptions pca_options;
+                    pca_options.shift_centroid = true;
+                    pca_options.normalize = true;
+                    auto pca = compute_pointcloud_pca<float>(local.coords, pca_options);
+                    n << pca.eigenvectors[0][0], pca.eigenvectors[1][0], pca.eigenvectors[2][0];
+                    if (!n.allFinite() || n.squaredNorm() == 0.f) {
+                        n = normals[m_order[i]].stableNormalized();
+                    }
+
+                    float radius2 = 0.f;
+                    for (uint32_t j : local.neighbors) {
+                        const Vector d = m_points[j] - p;
+                        const float h = d.dot(n);
+                        radius2 = std::max(radius2, d.squaredNorm() - h * h);
+                    }
+                    areas[m_order[i]] = static_cast<float>(lagrange::internal::pi) * radius2 /
+                                        static_cast<float>(local.neighbors.size());
+                }
+            });
+
+        return areas;
+    }
+
+protected:
+    std::vector<Vector> m_points; ///< Point positions, in tree order.
+    std::vector<Vector> m_area_normals; ///< Area-weighted unit normals, in tree order.
+    std::vector<float> m_areas; ///< Point areas, in input order.
+    std::vector<uint32_t> m_order; ///< Mapping from tree order to input order.
+    std::vector<Node> m_nodes;
+    float m_accuracy_scale = 2.f;
+};
+
+template <typename Scalar, typename Index>
+PointCloudWindingNumber::PointCloudWindingNumber(
+    const SurfaceMesh<Scalar, Index>& points,
+    const PointCloudWindingNumberOptions& options)
+    : m_impl(make_value_ptr<Impl>())
+{
+    la_runtime_assert(
+        points.get_dimension() == 3,
+        "Point cloud winding number engine only supports 3D points");
+
+    const AttributeId normal_id = internal::find_matching_attribute<Scalar>(
+        points,
+        options.input_normals,
+        AttributeElement::Vertex,
+        AttributeUsage::Normal,
+        3);
+    la_runtime_assert(normal_id != invalid_attribute_id(), "Input normal attribute not found!");
+
+    const size_t num_points = static_cast<size_t>(points.get_num_vertices());
+    auto coords = points.get_vertex_to_position().get_all();
+    auto normal_values = points.template get_attribute<Scalar>(normal_id).get_all();
+
+    std::vector<Impl::Vector> positions(num_points);
+    std::vector<Impl::Vector> normals(num_points);
+    for (size_t v = 0; v < num_points; ++v) {
+        for (size_t d = 0; d < 3; ++d) {
+            positions[v][d] = static_cast<float>(coords[v * 3 + d]);
+            normals[v][d] = static_cast<float>(normal_values[v * 3 + d]);
+        }
+    }
+
+    std::vector<float> areas;
+    if (!options.input_areas.empty()) {
+        const AttributeId area_id = internal::find_matching_attribute<Scalar>(
+            points,
+            options.input_areas,
+            AttributeElement::Vertex,
+            AttributeUsage::Scalar,
+            1);
+        la_runtime_assert(area_id != invalid_attribute_id(), "Input area attribute not found!");
+        auto area_values = points.template get_attribute<Scalar>(area_id).get_all();
+        areas.resize(num_points);
+        for (size_t v = 0; v < num_points; ++v) {
+            areas[v] = static_cast<float>(area_values[v]);
+        }
+    }
+
+    m_impl->initialize(std::move(positions), std::move(normals), std::move(areas), options);
+}
+
+PointCloudWindingNumber::PointCloudWindingNumber() = default;
+PointCloudWindingNumber::~PointCloudWindingNumber() = default;
+PointCloudWindingNumber::PointCloudWindingNumber(PointCloudWindingNumber&& other) noexcept =
+    default;
+PointCloudWindingNumber& PointCloudWindingNumber::operator=(
+    PointCloudWindingNumber&& other) noexcept = default;
+
+bool PointCloudWindingNumber::is_inside(const std::array<float, 3>& pos) const
+{
+    return winding_number(pos) > 0.5f;
+}
+
+float PointCloudWindingNumber::winding_number(const std::array<float, 3>& pos) const
+{
+    return m_impl->winding_number(Impl::Vector(pos[0], pos[1], pos[2]));
+}
+
+void PointCloudWindingNumber::batch_winding_number(span<const float> positions, span<float> out)
+    const
+{
+    la_runtime_assert(positions.size() % 3 == 0, "Query positions must be 3D");
+    la_runtime_assert(out.size() * 3 == positions.size(), "Output buffer size mismatch");
+    tbb::parallel_for(
+        tbb::blocked_range<size_t>(0, out.size()),
+        [&](const tbb::blocked_range<size_t>& range) {
+            for (size_t i = range.begin(); i != range.end(); ++i) {
+                out[i] = m_impl->winding_number(Impl::Vector::Map(positions.data() + 3 * i));
+            }
+        });
+}
+
+void PointCloudWindingNumber::batch_is_inside(span<const float> positions, span<uint8_t> out)
+    const
+{
+    la_runtime_assert(positions.size() % 3 == 0, "Query positions must be 3D");
+    la_runtime_assert(out.size() * 3 == positions.size(), "Output buffer size mismatch");
+    tbb::parallel_for(
+        tbb::blocked_range<size_t>(0, out.size()),
+        [&](const tbb::blocked_range<size_t>& range) {
+            for (size_t i = range.begin(); i != range.end(); ++i) {
+                out[i] =
+                    m_impl->winding_number(Impl::Vector::Map(positions.data() + 3 * i)) > 0.5f;
+            }
+        });
+}
+
+span<const float> PointCloudWindingNumber::get_point_areas() const
+{
+    return m_impl->get_point_areas();
+}
+
+// Iterate over mesh (scalar, index) types
+#define LA_X_point_cloud_winding_number(_, Scalar, Index)        \
+    template PointCloudWindingNumber::PointCloudWindingNumber( \
+        const SurfaceMesh<Scalar, Index>& points,              \
+        const PointCloudWindingNumberOptions& options);
+LA_SURFACE_MESH_X(point_cloud_winding_number, 0)
+
+} // namespace winding
+} // namespace lagrange
@@ -0,0 +1,196 @@
+/*
+ * Copyright 2025 Adobe. All rights reserved.
+ * This file is licensed to you under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License. You may obtain a copy
+ * of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR REPRESENTATIONS
+ * OF ANY KIND, either express or implied. See the License for the specific language
+ * governing permissions and limitations under the License.
+ */
+#include <lagrange/Attribute.h>
+#include <lagrange/compute_vertex_normal.h>
+#include <lagrange/internal/constants.h>
+#include <lagrange/mesh_bbox.h>
+#include <lagrange/testing/common.h>
+#include <lagrange/views.h>
+#include <lagrange/winding/FastWindingNumber.h>
+#include <lagrange/winding/PointCloudWindingNumber.h>
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_approx.hpp>
+
+// clang-format off
+#include <lagrange/utils/warnoff.h>
+#include <tbb/parallel_for.h>
+#include <lagrange/utils/warnon.h>
+// clang-format on
+
+#include <random>
+
+namespace {
+
+// Fibonacci sampling of the unit sphere with outward normals.
+lagrange::SurfaceMesh<double, uint32_t> make_sphere_points(uint32_t num_points)
+{
+    lagrange::SurfaceMesh<double, uint32_t> points;
+    points.add_vertices(num_points);
+    auto normal_id = points.create_attribute<double>(
+        "normal",
+        lagrange::AttributeElement::Vertex,
+        lagrange::AttributeUsage::Normal,
+        3);
+    auto P = vertex_ref(points);
+    auto N = attribute_matrix_ref<double>(points, normal_id);
+    const double golden_angle = lagrange::internal::pi * (3.0 - std::sqrt(5.0));
+    for (uint32_t i = 0; i < num_points; ++i) {
+        const double z = 1.0 - 2.0 * (i + 0.5) / num_points;
+        const double r = std::sqrt(1.0 - z * z);
+        const double theta = golden_angle * i;
+        P.row(i) << r * std::cos(theta), r * std::sin(theta), z;
+        N.row(i) = P.row(i);
+    }
+    return points;
+}
+
+} // namespace
+
+TEST_CASE("PointCloudWindingNumber: sphere", "[winding]")
+{
+    auto points = make_sphere_points(4000);
+
+    SECTION("estimated areas")
+    {
+        lagrange::winding::PointCloudWindingNumber engine(points);
+
+        // Estimated areas should roughly sum up to the area of the sphere.
+        double total_area = 0;
+        for (float a : engine.get_point_areas()) {
+            total_area += a;
+        }
+        REQUIRE(total_area == Catch::Approx(4 * lagrange::internal::pi).epsilon(0.3));
+
+        REQUIRE(engine.is_inside({0.f, 0.f, 0.f}));
+        REQUIRE(engine.is_inside({0.5f, -0.2f, 0.3f}));
+        REQUIRE_FALSE(engine.is_inside({2.f, 0.f, 0.f}));
+        REQUIRE_FALSE(engine.is_inside({0.f, -1.5f, 1.f}));
+    }
+
+    SECTION("input areas")
+    {
+        auto area_id = points.create_attribute<double>(
+            "area",
+            lagrange::AttributeElement::Vertex,
+            lagrange::AttributeUsage::Scalar,
+            1);
+        const double area = 4 * lagrange::internal::pi / points.get_num_vertices();
+        for (auto& a : points.ref_attribute<double>(area_id).ref_all()) {
+            a = area;
+        }
+
+        lagrange::winding::PointCloudWindingNumberOptions options;
+        options.input_areas = "area";
+        lagrange::winding::PointCloudWindingNumber engine(points, options);
+
+        REQUIRE(engine.winding_number({0.f, 0.f, 0.f}) == Catch::Approx(1.f).margin(1e-2));
+        REQUIRE(engine.winding_number({3.f, 2.f, 0.f}) == Catch::Approx(0.f).margin(1e-2));
+
+        // Batch queries must match single queries.
+        std::vector<float> queries = {0.f, 0.f, 0.f, 0.2f, 0.1f, 0.f, 3.f, 2.f, 0.f};
+        std::vector<float> winding_numbers(3);
+        std::vector<uint8_t> insides(3);
+        engine.batch_winding_number(queries, winding_numbers);
+        engine.batch_is_inside(queries, insides);
+        for (size_t i = 0; i < 3; ++i) {
+            std::array<float, 3> q = {queries[3 * i], queries[3 * i + 1], queries[3 * i + 2]};
+            REQUIRE(winding_numbers[i] == engine.winding_number(q));
+            REQUIRE(static_cast<bool>(insides[i]) == engine.is_inside(q));
+        }
+    }
+}
+
+TEST_CASE("PointCloudWindingNumber: mesh", "[winding]")
+{
+    using Scalar = float;
+    using Index = uint32_t;
+
+    auto mesh = lagrange::testing::load_surface_mesh<Scalar, Index>("open/core/ball.obj");
+    lagrange::winding::FastWindingNumber mesh_engine(mesh);
+
+    auto points = mesh;
+    lagrange::compute_vertex_normal(points);
+    points.clear_facets();
+    lagrange::winding::PointCloudWindingNumber point_engine(points);
+
+    // Both engines should agree away from the surface.
+    auto bbox = lagrange::mesh_bbox<3>(mesh);
+    std::mt19937 gen;
+    std::uniform_real_distribution<Scalar> px(bbox.min().x(), bbox.max().x());
+    std::uniform_real_distribution<Scalar> py(bbox.min().y(), bbox.max().y());
+    std::uniform_real_distribution<Scalar> pz(bbox.min().z(), bbox.max().z());
+    size_t num_samples = 1000;
+    size_t num_agree = 0;
+    for (size_t k = 0; k < num_samples; ++k) {
+        std::array<float, 3> q = {px(gen), py(gen), pz(gen)};
+        num_agree += (mesh_engine.is_inside(q) == point_engine.is_inside(q));
+    }
+    REQUIRE(num_agree >= num_samples * 95 / 100);
+}
+
+TEST_CASE("PointCloudWindingNumber: benchmark", "[winding][!benchmark]")
+{
+    using Scalar = float;
+    using Index = uint32_t;
+
+    auto mesh = lagrange::testing::load_surface_mesh<Scalar, Index>("open/core/dragon.obj");
+    auto points = mesh;
+    lagrange::compute_vertex_normal(points);
+    points.clear_facets();
+
+    auto bbox = lagrange::mesh_bbox<3>(mesh);
+    std::mt19937 gen;
+    std::uniform_real_distribution<Scalar> px(bbox.min().x(), bbox.max().x());
+    std::uniform_real_distribution<Scalar> py(bbox.min().y(), bbox.max().y());
+    std::uniform_real_distribution<Scalar> pz(bbox.min().z(), bbox.max().z());
+
+    size_t num_samples = 100000;
+    std::vector<float> queries(3 * num_samples);
+    for (size_t k = 0; k < num_samples; ++k) {
+        queries[3 * k] = px(gen);
+        queries[3 * k + 1] = py(gen);
+        queries[3 * k + 2] = pz(gen);
+    }
+    std::vector<uint8_t> insides(num_samples);
+
+    BENCHMARK("mesh build")
+    {
+        return lagrange::winding::FastWindingNumber(mesh);
+    };
+
+    BENCHMARK("point cloud build")
+    {
+        return lagrange::winding::PointCloudWindingNumber(points);
+    };
+
+    BENCHMARK_ADVANCED("mesh batch query")(Catch::Benchmark::Chronometer meter)
+    {
+        lagrange::winding::FastWindingNumber engine(mesh);
+        meter.measure([&]() {
+            tbb::parallel_for(size_t(0), num_samples, [&](size_t k) {
+                insides[k] = engine.is_inside(
+                    {queries[3 * k], queries[3 * k + 1], queries[3 * k + 2]});
+            });
+            return insides.back();
+        });
+    };
+
+    BENCHMARK_ADVANCED("point cloud batch query")(Catch::Benchmark::Chronometer meter)
+    {
+        lagrange::winding::PointCloudWindingNumber engine(points);
+        meter.measure([&]() {
+            engine.batch_is_inside(queries, insides);
+            return insides.back();
+        });
+    };
+}